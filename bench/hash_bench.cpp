@@ -0,0 +1,118 @@
+// Débit des hashers (GB/s) : gros messages en flux et beaucoup de petits
+// messages (taille d'un corps JSON produit) via SHA256Hasher::hashMany.
+//
+//   sa_bench_hash [--mb 256] [--small 200000] [--small-bytes 400]
+
+#include <adastra/crypto/hash/Blake2bHasher.hpp>
+#include <adastra/crypto/hash/SHA256Hasher.hpp>
+#include <adastra/crypto/random/RandomByters.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace adastra::crypto::hash;
+
+namespace
+{
+    struct Options
+    {
+        std::size_t mb = 256;
+        std::size_t small = 200000;
+        std::size_t smallBytes = 400;
+    };
+
+    Options parse(int argc, char **argv)
+    {
+        Options o;
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string k = argv[i];
+            const std::size_t v = std::strtoull(argv[i + 1], nullptr, 10);
+            if (k == "--mb")
+                o.mb = v;
+            else if (k == "--small")
+                o.small = v;
+            else if (k == "--small-bytes")
+                o.smallBytes = v;
+            else
+                std::fprintf(stderr, "option inconnue: %s\n", k.c_str());
+        }
+        return o;
+    }
+
+    template <typename Fn>
+    double seconds(Fn &&fn)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    void report(const char *name, std::size_t bytes, double s)
+    {
+        std::printf("%-32s %8.3f GB/s  (%zu MiB en %.3f s)\n", name, bytes / s / 1e9, bytes >> 20, s);
+    }
+
+    volatile std::uint8_t g_sink; // empêche l'élimination des calculs
+}
+
+int main(int argc, char **argv)
+{
+    const Options opt = parse(argc, argv);
+
+    // ---- flux : update() par morceaux de 1 MiB
+    std::vector<std::uint8_t> chunk(1 << 20);
+    adastra::crypto::random::RandomBytes::fill(chunk.data(), chunk.size());
+    const std::size_t streamBytes = opt.mb * chunk.size();
+
+    std::printf("SHA-256 : %s, BLAKE2b : %s\n",
+                SHA256Hasher::name(SHA256Hasher::backend()), Blake2bHasher::backend());
+
+    {
+        SHA256Hasher h;
+        const double s = seconds([&]
+                                 {
+            for (std::size_t i = 0; i < opt.mb; ++i)
+                h.update(chunk.data(), chunk.size());
+            g_sink = h.finalize()[0]; });
+        report("sha256 stream", streamBytes, s);
+    }
+    {
+        Blake2bHasher h;
+        const double s = seconds([&]
+                                 {
+            for (std::size_t i = 0; i < opt.mb; ++i)
+                h.update(chunk.data(), chunk.size());
+            g_sink = h.finalize()[0]; });
+        report("blake2b-512 stream", streamBytes, s);
+    }
+
+    // ---- petits messages : tailles variées autour de --small-bytes
+    std::vector<std::string> storage(opt.small);
+    std::size_t smallTotal = 0;
+    for (std::size_t i = 0; i < storage.size(); ++i)
+    {
+        const std::size_t n = opt.smallBytes / 2 + (i * 7919) % (opt.smallBytes + 1);
+        storage[i].assign(reinterpret_cast<const char *>(chunk.data()) + (i % 4096), n);
+        smallTotal += n;
+    }
+    const std::vector<std::string_view> inputs(storage.begin(), storage.end());
+    std::vector<SHA256Hasher::Digest> digests(inputs.size());
+
+    for (auto b : {Sha256Backend::Portable, Sha256Backend::Avx2, Sha256Backend::ShaNi})
+    {
+        if (!SHA256Hasher::supported(b))
+            continue;
+        const double s = seconds([&]
+                                 { SHA256Hasher::hashMany(inputs, digests, b); });
+        g_sink = digests.back()[0];
+        const std::string name = std::string("sha256 hashMany/") + SHA256Hasher::name(b);
+        report(name.c_str(), smallTotal, s);
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+// KeyValueStore : débit put/get (ops/s), commit groupé sous écrivains
+// concurrents, et temps d'ouverture selon le nombre de clés (avec et sans hints).
+//
+//   sa_bench_kv [--keys 1000000] [--value 100] [--threads 8] [--sync-ops 2000] [--dir /tmp/sa_kv_bench]
+
+#include <adastra/storage/database/KeyValueStore.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace adastra::storage::database;
+namespace fs = std::filesystem;
+
+namespace
+{
+    struct Options
+    {
+        std::size_t keys = 1000000;
+        std::size_t value = 100;
+        std::size_t threads = 8;
+        std::size_t syncOps = 2000; // puts durables par thread
+        std::string dir = "/tmp/sa_kv_bench";
+    };
+
+    Options parse(int argc, char **argv)
+    {
+        Options o;
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string k = argv[i];
+            const std::string v = argv[i + 1];
+            if (k == "--dir")
+                o.dir = v;
+            else if (k == "--keys")
+                o.keys = std::strtoull(v.c_str(), nullptr, 10);
+            else if (k == "--value")
+                o.value = std::strtoull(v.c_str(), nullptr, 10);
+            else if (k == "--threads")
+                o.threads = std::strtoull(v.c_str(), nullptr, 10);
+            else if (k == "--sync-ops")
+                o.syncOps = std::strtoull(v.c_str(), nullptr, 10);
+            else
+                std::fprintf(stderr, "option inconnue: %s\n", k.c_str());
+        }
+        return o;
+    }
+
+    template <typename Fn>
+    double seconds(Fn &&fn)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    void report(const char *name, std::size_t ops, double s)
+    {
+        std::printf("%-34s %12.0f ops/s  (%zu ops en %.3f s)\n", name, ops / s, ops, s);
+    }
+
+    std::string keyOf(std::size_t i)
+    {
+        return "cart:" + std::to_string(i);
+    }
+
+    void removeHints(const std::string &dir)
+    {
+        for (const auto &e : fs::directory_iterator(dir))
+            if (e.path().extension() == ".hint")
+                fs::remove(e.path());
+    }
+
+    volatile std::size_t g_sink; // empêche l'élimination des lectures
+}
+
+int main(int argc, char **argv)
+{
+    const Options opt = parse(argc, argv);
+    const std::string value(opt.value, 'v');
+
+    KeyValueOptions fast;
+    fast.syncWrites = false;
+    fast.backgroundCompaction = false;
+
+    // ---- put / get sur un thread, sans fsync par écriture
+    fs::remove_all(opt.dir);
+    {
+        KeyValueStore kv(opt.dir, fast);
+        const double put = seconds([&]
+                                   {
+            for (std::size_t i = 0; i < opt.keys; ++i)
+                kv.put(keyOf(i), value);
+            kv.sync(); });
+        report("put (sync() final)", opt.keys, put);
+
+        std::vector<std::size_t> order(opt.keys);
+        std::mt19937_64 rng(7);
+        for (auto &o : order)
+            o = rng() % opt.keys;
+
+        const double get = seconds([&]
+                                   {
+            std::size_t total = 0;
+            for (const std::size_t i : order)
+                total += kv.get(keyOf(i))->size();
+            g_sink = total; });
+        report("get aléatoire, 1 thread", opt.keys, get);
+
+        const double getMt = seconds([&]
+                                     {
+            std::vector<std::thread> ts;
+            for (std::size_t t = 0; t < opt.threads; ++t)
+                ts.emplace_back([&, t]
+                                {
+                    std::size_t total = 0;
+                    for (std::size_t i = t; i < order.size(); i += opt.threads)
+                        total += kv.get(keyOf(order[i]))->size();
+                    g_sink = total; });
+            for (auto &t : ts)
+                t.join(); });
+        const std::string name = "get aléatoire, " + std::to_string(opt.threads) + " threads";
+        report(name.c_str(), opt.keys, getMt);
+    }
+
+    // ---- écritures durables : un fdatasync partagé par les écrivains en attente
+    for (const std::size_t threads : {std::size_t{1}, opt.threads})
+    {
+        fs::remove_all(opt.dir + "-sync");
+        KeyValueOptions durable;
+        durable.backgroundCompaction = false;
+        KeyValueStore kv(opt.dir + "-sync", durable);
+
+        const double s = seconds([&]
+                                 {
+            std::vector<std::thread> ts;
+            for (std::size_t t = 0; t < threads; ++t)
+                ts.emplace_back([&, t]
+                                {
+                    for (std::size_t i = 0; i < opt.syncOps; ++i)
+                        kv.put("session:" + std::to_string(t) + ":" + std::to_string(i), value); });
+            for (auto &t : ts)
+                t.join(); });
+
+        const auto st = kv.stats();
+        const std::string name = "put durable, " + std::to_string(threads) + " threads";
+        report(name.c_str(), threads * opt.syncOps, s);
+        std::printf("%-34s %12.1f puts/fsync\n", "", static_cast<double>(st.puts) / std::max<std::uint64_t>(1, st.syncs));
+    }
+    fs::remove_all(opt.dir + "-sync");
+
+    // ---- ouverture : index reconstruit depuis les hints, puis en relisant les segments
+    std::printf("\n%12s %14s %14s\n", "clés", "hints (ms)", "scan (ms)");
+    for (std::size_t keys = std::max<std::size_t>(1, opt.keys / 100); keys <= opt.keys; keys *= 10)
+    {
+        fs::remove_all(opt.dir);
+        {
+            KeyValueStore kv(opt.dir, fast);
+            for (std::size_t i = 0; i < keys; ++i)
+                kv.put(keyOf(i), value);
+        }
+
+        double withHints = 0, scanned = 0;
+        {
+            KeyValueStore kv(opt.dir, fast);
+            withHints = kv.stats().openSeconds;
+        }
+        removeHints(opt.dir);
+        {
+            KeyValueStore kv(opt.dir, fast);
+            scanned = kv.stats().openSeconds;
+        }
+        std::printf("%12zu %14.1f %14.1f\n", keys, withHints * 1000, scanned * 1000);
+    }
+    fs::remove_all(opt.dir);
+    return 0;
+}
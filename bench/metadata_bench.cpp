@@ -0,0 +1,145 @@
+// MetadataStore : mises à jour ponctuelles (ops/s), taille des colonnes compressées
+// et débit des scans (sum, top, atLeast) comparé à un tableau u32 brut.
+//
+//   sa_bench_metadata [--rows 5000000] [--updates 2000000] [--top 100] [--dir /tmp/sa_metadata_bench]
+
+#include <adastra/storage/database/MetadataStore.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace adastra::storage::database;
+namespace fs = std::filesystem;
+
+namespace
+{
+    struct Options
+    {
+        std::size_t rows = 5000000;
+        std::size_t updates = 2000000;
+        std::size_t top = 100;
+        std::string dir = "/tmp/sa_metadata_bench";
+    };
+
+    Options parse(int argc, char **argv)
+    {
+        Options o;
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string k = argv[i];
+            const std::string v = argv[i + 1];
+            if (k == "--dir")
+                o.dir = v;
+            else if (k == "--rows")
+                o.rows = std::strtoull(v.c_str(), nullptr, 10);
+            else if (k == "--updates")
+                o.updates = std::strtoull(v.c_str(), nullptr, 10);
+            else if (k == "--top")
+                o.top = std::strtoull(v.c_str(), nullptr, 10);
+            else
+                std::fprintf(stderr, "option inconnue: %s\n", k.c_str());
+        }
+        return o;
+    }
+
+    template <typename Fn>
+    double seconds(Fn &&fn)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    void report(const char *name, std::size_t ops, double s, const char *unit)
+    {
+        std::printf("%-34s %12.0f %s  (%zu en %.3f s)\n", name, ops / s, unit, ops, s);
+    }
+
+    volatile std::uint64_t g_sink; // empêche l'élimination des scans
+}
+
+int main(int argc, char **argv)
+{
+    const Options opt = parse(argc, argv);
+    fs::remove_all(opt.dir);
+
+    // Vues à longue traîne : la plupart des produits en ont peu, quelques-uns beaucoup.
+    std::mt19937_64 rng(7);
+    std::vector<std::uint32_t> raw(opt.rows);
+    for (auto &v : raw)
+        v = static_cast<std::uint32_t>(std::pow(std::generate_canonical<double, 53>(rng), 8.0) * 100000);
+
+    MetadataStore store(opt.dir, {"views"});
+    const auto views = store.column("views");
+
+    const double load = seconds([&]
+                                {
+        for (std::size_t i = 0; i < raw.size(); ++i)
+            if (raw[i] != 0)
+                store.set(views, static_cast<std::uint32_t>(i), raw[i]);
+        store.flush(); });
+    report("chargement + fusion", opt.rows, load, "lignes/s");
+
+    const auto st = store.stats();
+    std::printf("%-34s %12.2f octets/ligne (u32 brut : 4)\n", "colonne compressée",
+                static_cast<double>(st.packedBytes) / opt.rows);
+
+    // ---- mises à jour ponctuelles : delta en mémoire, fusions en tâche de fond
+    std::vector<std::uint32_t> slots(opt.updates);
+    for (auto &s : slots)
+        s = static_cast<std::uint32_t>(rng() % opt.rows);
+    const double upd = seconds([&]
+                               {
+        for (const auto s : slots)
+            store.add(views, s);
+        store.flush(); });
+    report("add() + fusion finale", opt.updates, upd, "ops/s");
+    for (const auto s : slots)
+        ++raw[s];
+
+    // ---- scans
+    const auto scan = [&](const char *name, const std::function<std::uint64_t()> &fn)
+    {
+        constexpr int kRuns = 5;
+        const double s = seconds([&]
+                                 {
+            for (int i = 0; i < kRuns; ++i)
+                g_sink = fn(); });
+        report(name, kRuns * opt.rows, s, "lignes/s");
+    };
+
+    scan("sum, colonne compressée", [&]
+         { return store.sum(views); });
+    scan("sum, u32 brut", [&]
+         {
+        std::uint64_t total = 0;
+        for (const auto v : raw)
+            total += v;
+        return total; });
+
+    scan("top, colonne compressée", [&]
+         { return store.top(views, opt.top).size(); });
+    scan("top (partial_sort), u32 brut", [&]
+         {
+        std::vector<std::uint32_t> idx(raw.size());
+        for (std::size_t i = 0; i < idx.size(); ++i)
+            idx[i] = static_cast<std::uint32_t>(i);
+        const std::size_t k = std::min(opt.top, idx.size());
+        std::partial_sort(idx.begin(), idx.begin() + k, idx.end(), [&](std::uint32_t a, std::uint32_t b)
+                          { return raw[a] > raw[b]; });
+        return std::uint64_t{idx[0]}; });
+
+    scan("atLeast(50000), colonne", [&]
+         { return store.atLeast(views, 50000).size(); });
+
+    fs::remove_all(opt.dir);
+    return 0;
+}
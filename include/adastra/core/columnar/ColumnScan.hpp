@@ -0,0 +1,54 @@
+#ifndef COLUMN_SCAN_HPP
+#define COLUMN_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace adastra::core::columnar
+{
+    // Liste triée des lignes retenues par un scan.
+    using Selection = std::vector<std::uint32_t>;
+
+    // Un bit par ligne, 64 lignes par mot.
+    using Bitmask = std::vector<std::uint64_t>;
+
+    enum class MaskOp
+    {
+        Assign,
+        And
+    };
+
+    constexpr std::size_t wordsFor(std::size_t rows) { return (rows + 63) / 64; }
+
+    // Noyaux de prédicats : écrivent (ou combinent en AND) un bit par ligne dans `words`.
+    // Les bornes sont inclusives ; une valeur NaN ne passe jamais un filtre flottant.
+    void maskRange(std::span<const float> column, float lo, float hi,
+                   std::span<std::uint64_t> words, MaskOp op = MaskOp::Assign);
+    void maskRange(std::span<const std::uint32_t> column, std::uint32_t lo, std::uint32_t hi,
+                   std::span<std::uint64_t> words, MaskOp op = MaskOp::Assign);
+    void maskEqual(std::span<const std::uint32_t> column, std::uint32_t value,
+                   std::span<std::uint64_t> words, MaskOp op = MaskOp::Assign);
+    void maskEqual(std::span<const std::uint8_t> column, std::uint8_t value,
+                   std::span<std::uint64_t> words, MaskOp op = MaskOp::Assign);
+
+    // Ajoute à `out` les index (base + i) des bits à 1 sur les `rows` premières lignes.
+    void appendSelection(std::span<const std::uint64_t> words, std::size_t rows,
+                         std::uint32_t base, Selection &out);
+
+    // Prédicat appliqué sur la tranche [begin, begin + rows) d'une ou plusieurs colonnes.
+    using Predicate = std::function<void(std::size_t begin, std::size_t rows,
+                                         std::span<std::uint64_t> words, MaskOp op)>;
+
+    // Évalue la conjonction des prédicats sur `rows` lignes.
+    // Au-delà de `parallelThreshold` lignes, le travail est découpé par blocs sur le TaskScheduler partagé.
+    Selection select(std::size_t rows, const std::vector<Predicate> &predicates,
+                     std::size_t parallelThreshold = 1u << 16);
+
+    // Jeu d'instructions retenu au démarrage ("avx2", "sse2" ou "scalar").
+    const char *activeIsa();
+}
+
+#endif // COLUMN_SCAN_HPP
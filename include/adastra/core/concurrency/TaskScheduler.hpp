@@ -0,0 +1,342 @@
+#ifndef TASK_SCHEDULER_HPP
+#define TASK_SCHEDULER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace adastra::core::concurrency
+{
+    // Interactive : travail dont une requête attend le résultat (scan, ingestion).
+    // Background : rafraîchissements, persistance... exécutés quand aucune tâche
+    // interactive n'est visible.
+    enum class TaskPriority : std::uint8_t
+    {
+        Interactive = 0,
+        Background = 1
+    };
+
+    struct SchedulerOptions
+    {
+        unsigned workers = 0;    // 0 = cœurs utilisables par le processus
+        bool pinWorkers = false; // worker i fixé sur le i-ème cœur autorisé (Linux)
+    };
+
+    struct ParallelOptions
+    {
+        std::size_t grain = 1;   // itérations minimales par tranche
+        unsigned maxWorkers = 0; // participants max, appelant compris (0 = un par cœur)
+        TaskPriority priority = TaskPriority::Interactive;
+    };
+
+    struct SchedulerStats
+    {
+        unsigned workers = 0;
+        unsigned cores = 0;
+        std::uint64_t submitted = 0;
+        std::uint64_t executed = 0;
+        std::uint64_t stolen = 0; // tâches prises dans la file d'un autre worker
+        std::size_t queuedInteractive = 0;
+        std::size_t queuedBackground = 0;
+    };
+
+    class TaskScheduler;
+
+    namespace detail
+    {
+        struct Unit
+        {
+        };
+
+        template <typename T>
+        using Stored = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+        template <typename T>
+        struct FutureState
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool ready = false;
+            std::optional<Stored<T>> value;
+            std::exception_ptr error;
+            std::vector<std::function<void()>> continuations;
+
+            // value/error sont écrits avant : le verrou les publie avec `ready`.
+            void finish()
+            {
+                std::vector<std::function<void()>> next;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ready = true;
+                    next.swap(continuations);
+                }
+                cv.notify_all();
+                for (auto &c : next)
+                    c();
+            }
+
+            void onReady(std::function<void()> continuation)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!ready)
+                    {
+                        continuations.push_back(std::move(continuation));
+                        return;
+                    }
+                }
+                continuation();
+            }
+        };
+
+        template <typename T, typename Fn>
+        void fulfil(FutureState<T> &state, Fn &&fn)
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    fn();
+                    state.value.emplace();
+                }
+                else
+                {
+                    state.value.emplace(fn());
+                }
+            }
+            catch (...)
+            {
+                state.error = std::current_exception();
+            }
+            state.finish();
+        }
+    }
+
+    // Résultat d'une tâche soumise au TaskScheduler. Le résultat se consomme une
+    // fois : soit get(), soit then() qui le passe à la continuation.
+    template <typename T>
+    class TaskFuture
+    {
+    public:
+        TaskFuture() = default;
+        TaskFuture(TaskScheduler *scheduler, std::shared_ptr<detail::FutureState<T>> state)
+            : scheduler_(scheduler), state_(std::move(state)) {}
+
+        bool valid() const { return state_ != nullptr; }
+        bool ready() const
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            return state_->ready;
+        }
+
+        // Depuis un worker, l'attente exécute d'autres tâches au lieu de bloquer le thread.
+        void wait() const;
+
+        // Relance l'exception de la tâche le cas échéant.
+        T get();
+
+        // Planifie fn(résultat) (ou fn() pour void) sur le scheduler dès que ce
+        // résultat est prêt. Une exception saute la continuation et se propage.
+        template <typename F>
+        auto then(F &&fn, TaskPriority priority = TaskPriority::Background);
+
+    private:
+        TaskScheduler *scheduler_ = nullptr;
+        std::shared_ptr<detail::FutureState<T>> state_;
+    };
+
+    // Pool de threads à vol de travail partagé par les sous-systèmes : chaque
+    // worker a sa file par priorité, pousse et reprend ses propres tâches en LIFO
+    // (cache chaud) et vole les plus anciennes des autres en FIFO quand il n'a
+    // plus rien. Les tâches soumises hors du pool sont réparties en tourniquet.
+    //
+    // parallelFor / parallelReduce font participer l'appelant : un appel imbriqué
+    // depuis un worker ne peut pas bloquer le pool.
+    class TaskScheduler
+    {
+    public:
+        using Task = std::function<void()>;
+
+        explicit TaskScheduler(SchedulerOptions options = {});
+        ~TaskScheduler(); // exécute les tâches déjà en file, puis arrête les workers
+
+        TaskScheduler(const TaskScheduler &) = delete;
+        TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+        void post(Task task, TaskPriority priority = TaskPriority::Background);
+
+        template <typename F>
+        auto submit(F &&fn, TaskPriority priority = TaskPriority::Background)
+        {
+            using R = std::invoke_result_t<std::decay_t<F> &>;
+            auto state = std::make_shared<detail::FutureState<R>>();
+            auto holder = std::make_shared<std::decay_t<F>>(std::forward<F>(fn));
+            post([state, holder]
+                 { detail::fulfil(*state, [&]() -> R
+                                  { return (*holder)(); }); },
+                 priority);
+            return TaskFuture<R>(this, std::move(state));
+        }
+
+        // body(lo, hi) sur des tranches [lo, hi) d'au moins options.grain itérations.
+        template <typename Body>
+        void parallelFor(std::size_t first, std::size_t last, Body &&body, ParallelOptions options = {})
+        {
+            if (last <= first)
+                return;
+
+            const std::size_t grain = std::max<std::size_t>(1, options.grain);
+            const std::size_t chunks = (last - first + grain - 1) / grain;
+            runChunks(chunks, [&](std::size_t c)
+                      {
+                const std::size_t lo = first + c * grain;
+                body(lo, std::min(last, lo + grain)); }, options);
+        }
+
+        // reduce(...reduce(identity, map(tranche 0))..., map(tranche n)) : l'ordre des
+        // tranches est conservé, le résultat ne dépend pas du nombre de threads.
+        template <typename T, typename Map, typename Reduce>
+        T parallelReduce(std::size_t first, std::size_t last, T identity, Map &&map, Reduce &&reduce,
+                         ParallelOptions options = {})
+        {
+            if (last <= first)
+                return identity;
+
+            const std::size_t grain = std::max<std::size_t>(1, options.grain);
+            const std::size_t chunks = (last - first + grain - 1) / grain;
+            std::vector<std::optional<T>> partial(chunks);
+            runChunks(chunks, [&](std::size_t c)
+                      {
+                const std::size_t lo = first + c * grain;
+                partial[c].emplace(map(lo, std::min(last, lo + grain))); }, options);
+
+            T result = std::move(identity);
+            for (auto &p : partial)
+                result = reduce(std::move(result), std::move(*p));
+            return result;
+        }
+
+        // Exécute une tâche en file s'il y en a une ; false sinon.
+        bool runOne();
+
+        unsigned workerCount() const { return static_cast<unsigned>(workers_.size()); }
+        unsigned cores() const { return cores_; }
+        bool onWorkerThread() const;
+        SchedulerStats stats() const;
+
+        // Pool du processus ; SA_WORKER_THREADS et SA_PIN_WORKERS=1 le configurent.
+        static TaskScheduler &shared();
+
+    private:
+        static constexpr std::size_t kPriorities = 2;
+
+        struct alignas(64) Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks[kPriorities];
+        };
+
+        void runChunks(std::size_t chunks, const std::function<void(std::size_t)> &fn,
+                       const ParallelOptions &options);
+        bool tryPop(std::size_t self, bool isWorker, Task &out);
+        void execute(Task &task);
+        void workerLoop(std::size_t index);
+
+        unsigned cores_ = 1;
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::atomic<std::size_t> queued_[kPriorities] = {};
+        std::atomic<std::size_t> nextQueue_{0};
+
+        std::mutex sleepMutex_;
+        std::condition_variable sleepCv_;
+        std::atomic<unsigned> sleepers_{0};
+        bool stopping_ = false;
+
+        std::atomic<std::uint64_t> submitted_{0};
+        std::atomic<std::uint64_t> executed_{0};
+        std::atomic<std::uint64_t> stolen_{0};
+
+        std::vector<std::thread> workers_;
+    };
+
+    template <typename T>
+    void TaskFuture<T>::wait() const
+    {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        if (!scheduler_ || !scheduler_->onWorkerThread())
+        {
+            state_->cv.wait(lock, [&]
+                            { return state_->ready; });
+            return;
+        }
+
+        while (!state_->ready)
+        {
+            lock.unlock();
+            const bool helped = scheduler_->runOne();
+            lock.lock();
+            if (!helped)
+                state_->cv.wait_for(lock, std::chrono::milliseconds(1), [&]
+                                    { return state_->ready; });
+        }
+    }
+
+    template <typename T>
+    T TaskFuture<T>::get()
+    {
+        wait();
+        if (state_->error)
+            std::rethrow_exception(state_->error);
+        if constexpr (!std::is_void_v<T>)
+            return std::move(*state_->value);
+    }
+
+    template <typename T>
+    template <typename F>
+    auto TaskFuture<T>::then(F &&fn, TaskPriority priority)
+    {
+        using Fn = std::decay_t<F>;
+        using R = typename std::conditional_t<std::is_void_v<T>,
+                                              std::invoke_result<Fn &>,
+                                              std::invoke_result<Fn &, T>>::type;
+
+        auto next = std::make_shared<detail::FutureState<R>>();
+        auto holder = std::make_shared<Fn>(std::forward<F>(fn));
+        auto prev = state_;
+        TaskScheduler *scheduler = scheduler_;
+
+        prev->onReady([scheduler, prev, next, holder, priority]
+                      { scheduler->post([prev, next, holder]
+                                        {
+                if (prev->error)
+                {
+                    next->error = prev->error;
+                    next->finish();
+                    return;
+                }
+                detail::fulfil(*next, [&]() -> R
+                               {
+                    if constexpr (std::is_void_v<T>)
+                        return (*holder)();
+                    else
+                        return (*holder)(std::move(*prev->value)); }); },
+                                        priority); });
+
+        return TaskFuture<R>(scheduler, std::move(next));
+    }
+}
+
+#endif // TASK_SCHEDULER_HPP
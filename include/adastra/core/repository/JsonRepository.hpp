@@ -1,22 +1,35 @@
 #ifndef JSON_REPOSITORY_HPP
 #define JSON_REPOSITORY_HPP
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
+#include <memory>
 #include <mutex>
 #include <optional>
-#include <fstream>
 #include <nlohmann/json.hpp>
-#include <adastra/utils/json/JsonUtils.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+#include <adastra/core/repository/RepositoryBackend.hpp>
 
 namespace adastra::core::repository
 {
+    // Collection de T (T::fromJson, toJson(), getId()) stockée par un RepositoryBackend.
+    //
+    // Avec un fichier JSON (par défaut), les ajouts restent en mémoire jusqu'à
+    // flush(), qui réécrit le fichier. Avec un backend incrémental (LocalDBBackend),
+    // add() écrit directement le document, flush() n'a plus rien à faire et
+    // findById()/findBy() interrogent le backend sans charger la collection.
     template <typename T>
     class JsonRepository
     {
     public:
         JsonRepository(const std::string &filePath, const std::string &sectionKey)
-            : path_(filePath), key_(sectionKey), isLoaded_(false) {}
+            : JsonRepository(std::make_shared<JsonFileBackend>(filePath, sectionKey)) {}
+
+        explicit JsonRepository(std::shared_ptr<RepositoryBackend> backend)
+            : backend_(std::move(backend)), isLoaded_(false) {}
 
         const std::vector<T> &getAll() const
         {
@@ -28,51 +41,170 @@ namespace adastra::core::repository
         void reload()
         {
             std::lock_guard<std::mutex> lock(mutex_);
-            data_ = adastra::utils::json::loadVectorFromJsonFile<T>(path_, key_);
+            data_ = load();
             isLoaded_ = true;
         }
 
         void add(const T &item)
         {
+            addAll({item});
+        }
+
+        // Avec un backend incrémental, tout le lot est écrit en une fois.
+        void addAll(const std::vector<T> &items)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (backend_->incremental())
+            {
+                std::vector<std::pair<std::uint64_t, nlohmann::json>> docs;
+                docs.reserve(items.size());
+                for (const auto &item : items)
+                    docs.emplace_back(static_cast<std::uint64_t>(item.getId()), item.toJson());
+                backend_->upsert(docs);
+
+                if (!isLoaded_)
+                    return; // rechargé depuis le backend au prochain getAll()
+            }
+            else
+            {
+                loadIfNeeded();
+            }
+            data_.insert(data_.end(), items.begin(), items.end());
+        }
+
+        std::optional<T> findById(std::uint64_t id) const
+        {
+            if (backend_->incremental())
+            {
+                auto doc = backend_->findById(id);
+                return doc ? std::optional<T>(T::fromJson(*doc)) : std::nullopt;
+            }
+
             std::lock_guard<std::mutex> lock(mutex_);
             loadIfNeeded();
-            data_.push_back(item);
+            const auto it = std::find_if(data_.begin(), data_.end(), [&](const T &item)
+                                         { return static_cast<std::uint64_t>(item.getId()) == id; });
+            return it != data_.end() ? std::optional<T>(*it) : std::nullopt;
         }
 
-        void flush() const
+        // Éléments dont le champ JSON `field` vaut `value`. Sur un backend
+        // incrémental la requête s'appuie sur ses index.
+        std::vector<T> findBy(const std::string &field, const nlohmann::json &value,
+                              std::size_t limit = 100, std::size_t offset = 0) const
         {
+            std::vector<T> out;
+            if (backend_->incremental())
+            {
+                for (const auto &doc : backend_->findBy(field, value, limit, offset))
+                    out.push_back(T::fromJson(doc));
+                return out;
+            }
+
             std::lock_guard<std::mutex> lock(mutex_);
-            nlohmann::json root;
-            root[key_] = nlohmann::json::array();
+            loadIfNeeded();
             for (const auto &item : data_)
             {
-                root[key_].push_back(item.toJson());
+                if (out.size() >= limit)
+                    break;
+                const nlohmann::json doc = item.toJson();
+                const auto it = doc.find(field);
+                if (it == doc.end() || *it != value)
+                    continue;
+                if (offset > 0)
+                    --offset;
+                else
+                    out.push_back(item);
             }
+            return out;
+        }
 
-            std::ofstream out(path_);
-            if (!out)
+        void flush() const
+        {
+            if (backend_->incremental())
+                return; // chaque add() est déjà enregistré
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            const std::uint64_t version = ++writes_->requested;
+
+            std::lock_guard<std::mutex> writing(writes_->mutex);
+            backend_->replaceAll(toDocuments(data_));
+            writes_->written = std::max(writes_->written, version);
+        }
+
+        // Comme flush(), mais l'écriture se fait sur le TaskScheduler partagé à partir
+        // d'une copie prise sous verrou. Si plusieurs flushAsync() se chevauchent,
+        // seule la copie la plus récente est écrite.
+        adastra::core::concurrency::TaskFuture<void> flushAsync() const
+        {
+            auto &scheduler = adastra::core::concurrency::TaskScheduler::shared();
+            if (backend_->incremental())
+                return scheduler.submit([] {});
+
+            std::vector<T> copy;
+            std::uint64_t version;
             {
-                throw std::runtime_error("Erreur lors de l'ouverture du fichier JSON en écriture : " + path_);
+                std::lock_guard<std::mutex> lock(mutex_);
+                copy = data_;
+                version = ++writes_->requested;
             }
 
-            out << root.dump(2);
+            return scheduler.submit(
+                [writes = writes_, backend = backend_, copy = std::move(copy), version]
+                {
+                    std::lock_guard<std::mutex> lock(writes->mutex);
+                    if (version <= writes->written)
+                        return;
+                    backend->replaceAll(toDocuments(copy));
+                    writes->written = version;
+                },
+                adastra::core::concurrency::TaskPriority::Background);
         }
 
+        const std::shared_ptr<RepositoryBackend> &backend() const { return backend_; }
+
     private:
+        struct PendingWrites
+        {
+            std::mutex mutex;
+            std::uint64_t requested = 0; // sous mutex_
+            std::uint64_t written = 0;
+        };
+
+        static std::vector<nlohmann::json> toDocuments(const std::vector<T> &items)
+        {
+            std::vector<nlohmann::json> docs;
+            docs.reserve(items.size());
+            for (const auto &item : items)
+            {
+                docs.push_back(item.toJson());
+            }
+            return docs;
+        }
+
+        std::vector<T> load() const
+        {
+            std::vector<T> items;
+            for (const auto &doc : backend_->loadAll())
+            {
+                items.push_back(T::fromJson(doc));
+            }
+            return items;
+        }
+
         void loadIfNeeded() const
         {
             if (!isLoaded_)
             {
-                data_ = adastra::utils::json::loadVectorFromJsonFile<T>(path_, key_);
+                data_ = load();
                 isLoaded_ = true;
             }
         }
 
-        std::string path_;
-        std::string key_;
+        std::shared_ptr<RepositoryBackend> backend_;
         mutable std::vector<T> data_;
         mutable bool isLoaded_;
         mutable std::mutex mutex_;
+        std::shared_ptr<PendingWrites> writes_ = std::make_shared<PendingWrites>();
     };
 }
 
@@ -0,0 +1,140 @@
+#ifndef REPOSITORY_BACKEND_HPP
+#define REPOSITORY_BACKEND_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <adastra/utils/json/JsonFileLoader.hpp>
+#include <adastra/utils/json/JsonUtils.hpp>
+
+namespace adastra::core::repository
+{
+    // Champ "id" d'un document : nombre ou chaîne de chiffres (les ids Snowflake
+    // sont émis en chaîne, au-delà de 2^53). 0 si absent ; std::invalid_argument
+    // si ce n'est pas un entier positif.
+    inline std::uint64_t documentId(const nlohmann::json &doc)
+    {
+        const auto it = doc.find("id");
+        if (it == doc.end() || it->is_null())
+            return 0;
+        if (it->is_number_unsigned())
+            return it->get<std::uint64_t>();
+        if (it->is_number_integer() && it->get<std::int64_t>() >= 0)
+            return static_cast<std::uint64_t>(it->get<std::int64_t>());
+        if (it->is_string())
+        {
+            const auto &s = it->get_ref<const std::string &>();
+            std::uint64_t id = 0;
+            const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), id);
+            if (ec == std::errc() && ptr == s.data() + s.size() && !s.empty())
+                return id;
+        }
+        throw std::invalid_argument("Document: id invalide " + it->dump());
+    }
+
+    // Stockage d'une collection de documents JSON identifiés par un id, derrière
+    // JsonRepository : un fichier JSON réécrit en entier, ou une base qui
+    // enregistre et interroge les documents un par un (LocalDBBackend).
+    class RepositoryBackend
+    {
+    public:
+        virtual ~RepositoryBackend() = default;
+
+        // true : upsert() persiste chaque document et les requêtes sont servies par
+        // le backend ; false : seul replaceAll() persiste la collection entière.
+        virtual bool incremental() const = 0;
+
+        virtual std::vector<nlohmann::json> loadAll() = 0;
+        virtual void replaceAll(const std::vector<nlohmann::json> &items) = 0;
+        virtual void upsert(const std::vector<std::pair<std::uint64_t, nlohmann::json>> &items) = 0;
+
+        virtual std::optional<nlohmann::json> findById(std::uint64_t id) = 0;
+        // Documents dont le champ de premier niveau `field` vaut `value` (par id
+        // croissant pour une base, dans l'ordre du fichier sinon).
+        virtual std::vector<nlohmann::json> findBy(const std::string &field, const nlohmann::json &value,
+                                                   std::size_t limit, std::size_t offset) = 0;
+        virtual std::size_t count() = 0;
+    };
+
+    // Section `key` d'un fichier JSON ({"<key>": [...]}), relue via JsonFileLoader.
+    class JsonFileBackend : public RepositoryBackend
+    {
+    public:
+        JsonFileBackend(std::string filePath, std::string sectionKey)
+            : path_(std::move(filePath)), key_(std::move(sectionKey)) {}
+
+        bool incremental() const override { return false; }
+
+        std::vector<nlohmann::json> loadAll() override
+        {
+            const nlohmann::json j = adastra::utils::json::JsonFileLoader::loadJsonFromFile(path_);
+            const auto &array = adastra::utils::json::getJsonArrayOrThrow(j, key_);
+            return std::vector<nlohmann::json>(array.begin(), array.end());
+        }
+
+        void replaceAll(const std::vector<nlohmann::json> &items) override
+        {
+            nlohmann::json root;
+            root[key_] = items;
+
+            std::ofstream out(path_);
+            if (!out)
+            {
+                throw std::runtime_error("Erreur lors de l'ouverture du fichier JSON en écriture : " + path_);
+            }
+
+            out << root.dump(2);
+        }
+
+        void upsert(const std::vector<std::pair<std::uint64_t, nlohmann::json>> &) override
+        {
+            throw std::logic_error("JsonFileBackend: écriture document par document non supportée");
+        }
+
+        std::optional<nlohmann::json> findById(std::uint64_t id) override
+        {
+            for (auto &item : loadAll())
+                if (documentId(item) == id)
+                    return std::move(item);
+            return std::nullopt;
+        }
+
+        std::vector<nlohmann::json> findBy(const std::string &field, const nlohmann::json &value,
+                                           std::size_t limit, std::size_t offset) override
+        {
+            std::vector<nlohmann::json> out;
+            for (auto &item : loadAll())
+            {
+                if (out.size() >= limit)
+                    break;
+                const auto it = item.find(field);
+                if (it == item.end() || *it != value)
+                    continue;
+                if (offset > 0)
+                {
+                    --offset;
+                    continue;
+                }
+                out.push_back(std::move(item));
+            }
+            return out;
+        }
+
+        std::size_t count() override { return loadAll().size(); }
+
+        const std::string &path() const { return path_; }
+
+    private:
+        std::string path_;
+        std::string key_;
+    };
+}
+
+#endif // REPOSITORY_BACKEND_HPP
@@ -0,0 +1,73 @@
+#ifndef ID_SLOT_INDEX_HPP
+#define ID_SLOT_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace adastra::core::structures
+{
+    // Index immuable id -> position (slot) dans un tableau.
+    // Ids denses : table directe indexée par l'id. Ids épars : table de hachage
+    // à adressage ouvert (sondage linéaire). Dans les deux cas, find() est O(1).
+    // L'id 0 est réservé (« pas d'id ») et n'est jamais indexé.
+    class IdSlotIndex
+    {
+    public:
+        static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+        IdSlotIndex() = default;
+
+        // ids[i] est l'id du slot i. En cas de doublon, le premier slot gagne.
+        explicit IdSlotIndex(const std::vector<std::uint64_t> &ids);
+
+        std::uint32_t find(std::uint64_t id) const
+        {
+            if (!sparse_)
+                return id < dense_.size() ? dense_[id] : npos;
+
+            std::size_t i = mix(id) & mask_;
+            for (;;)
+            {
+                const Entry &e = table_[i];
+                if (e.id == id)
+                    return e.slot;
+                if (e.id == 0)
+                    return npos;
+                i = (i + 1) & mask_;
+            }
+        }
+
+        std::size_t size() const { return size_; }
+        std::size_t duplicates() const { return duplicates_; }
+        bool isDense() const { return !sparse_; }
+
+    private:
+        struct Entry
+        {
+            std::uint64_t id = 0;
+            std::uint32_t slot = npos;
+        };
+
+        static std::uint64_t mix(std::uint64_t x)
+        {
+            // finaliseur de splitmix64
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        bool sparse_ = false;
+        std::vector<std::uint32_t> dense_;
+        std::vector<Entry> table_;
+        std::size_t mask_ = 0;
+        std::size_t size_ = 0;
+        std::size_t duplicates_ = 0;
+    };
+}
+
+#endif // ID_SLOT_INDEX_HPP
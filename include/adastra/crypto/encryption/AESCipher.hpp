@@ -0,0 +1,47 @@
+#ifndef AES_CIPHER_HPP
+#define AES_CIPHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace adastra::crypto::encryption
+{
+    // AES-256-GCM via OpenSSL EVP (AES-NI/PCLMUL quand le CPU les a). La clé est
+    // installée une fois par instance, seul le nonce change par message.
+    // Une instance n'est pas partageable entre threads : une par thread.
+    //
+    // Sans OpenSSL (SA_HAS_OPENSSL absent), le constructeur lance std::runtime_error.
+    class AESCipher
+    {
+    public:
+        static constexpr std::size_t kKeySize = 32;
+        static constexpr std::size_t kNonceSize = 12;
+        static constexpr std::size_t kTagSize = 16;
+
+        using Nonce = std::array<std::uint8_t, kNonceSize>;
+        using Tag = std::array<std::uint8_t, kTagSize>;
+
+        // Lance std::invalid_argument si la clé ne fait pas 32 octets.
+        explicit AESCipher(std::span<const std::uint8_t> key);
+        ~AESCipher();
+
+        AESCipher(const AESCipher &) = delete;
+        AESCipher &operator=(const AESCipher &) = delete;
+
+        // `out` doit avoir la taille de `plain` (peut être le même tampon).
+        void encrypt(const Nonce &nonce, std::span<const std::uint8_t> aad,
+                     std::span<const std::uint8_t> plain, std::uint8_t *out, Tag &tag);
+
+        // false si le tag ne correspond pas ; `out` est alors à ignorer.
+        bool decrypt(const Nonce &nonce, std::span<const std::uint8_t> aad,
+                     std::span<const std::uint8_t> cipher, const Tag &tag, std::uint8_t *out);
+
+    private:
+        void *enc_ = nullptr; // EVP_CIPHER_CTX*
+        void *dec_ = nullptr;
+    };
+}
+
+#endif // AES_CIPHER_HPP
@@ -0,0 +1,87 @@
+#ifndef FILE_ENCRYPTION_HPP
+#define FILE_ENCRYPTION_HPP
+
+#include <adastra/crypto/encryption/AESCipher.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace adastra::crypto::encryption
+{
+    // Conteneur chiffré par blocs, lisible à n'importe quel offset :
+    //
+    //   en-tête (32 o) : "SAGCMv1\0" | blockSize (u32 LE) | réservé (u32) | fileId (16 o aléatoires)
+    //   bloc i         : nonce (12 o aléatoires) | chiffré (blockSize o, moins pour le dernier) | tag (16 o)
+    //
+    // AAD du bloc i = en-tête || i (u64 BE) || final (u8). Un bloc ne peut donc
+    // être ni déplacé, ni greffé depuis un autre fichier, et une troncature est
+    // détectée : le dernier bloc est toujours plus court que blockSize (vide au
+    // besoin) et seul lui est marqué final.
+    struct ContainerHeader
+    {
+        static constexpr std::size_t kSize = 32;
+        static constexpr std::size_t kRecordOverhead = AESCipher::kNonceSize + AESCipher::kTagSize;
+        // blockSize : puissance de deux, au plus 8 Mio (l'en-tête n'est pas authentifié
+        // avant la lecture d'un bloc, il ne doit pas dicter une allocation arbitraire).
+        static constexpr std::size_t kMaxBlockSize = std::size_t{8} << 20;
+        static bool validBlockSize(std::size_t size) { return size != 0 && size <= kMaxBlockSize && (size & (size - 1)) == 0; }
+
+        std::uint32_t blockSize = 0;
+        std::array<std::uint8_t, 16> fileId{};
+
+        std::array<std::uint8_t, kSize> serialize() const;
+
+        // Lance std::runtime_error si l'en-tête n'est pas reconnu ou si blockSize est invalide.
+        static ContainerHeader parse(std::span<const std::uint8_t> bytes);
+
+        std::uint64_t recordSize() const { return blockSize + kRecordOverhead; }
+        std::uint64_t recordOffset(std::uint64_t index) const { return kSize + index * recordSize(); }
+
+        std::vector<std::uint8_t> aad(std::uint64_t index, bool final) const;
+    };
+
+    struct EncryptionOptions
+    {
+        std::size_t blockSize = 1024 * 1024; // voir ContainerHeader::validBlockSize
+        unsigned workers = 2;        // threads de chiffrement
+        std::size_t queueDepth = 8;  // blocs en vol entre les étages
+    };
+
+    struct EncryptionStats
+    {
+        std::uint64_t plainBytes = 0;
+        std::uint64_t blocks = 0;
+    };
+
+    // Chiffrement en pipeline : un thread lit, `workers` threads chiffrent,
+    // le thread appelant écrit dans l'ordre. Les E/S et AES-GCM se recouvrent.
+    class FileEncryptor
+    {
+    public:
+        // Remplit le tampon ; renvoie moins que demandé seulement en fin de flux.
+        using Source = std::function<std::size_t(std::uint8_t *, std::size_t)>;
+        using Sink = std::function<void(const std::uint8_t *, std::size_t)>;
+
+        FileEncryptor(std::span<const std::uint8_t> key, EncryptionOptions options = {});
+        ~FileEncryptor();
+
+        EncryptionStats encrypt(const Source &source, const Sink &sink) const;
+
+        // Écrit dans `out`.part puis renomme : `out` n'existe que complet.
+        // Lance std::runtime_error sur erreur d'E/S.
+        EncryptionStats encryptFile(const std::string &in, const std::string &out) const;
+
+        const EncryptionOptions &options() const { return options_; }
+
+    private:
+        std::array<std::uint8_t, AESCipher::kKeySize> key_;
+        EncryptionOptions options_;
+    };
+}
+
+#endif // FILE_ENCRYPTION_HPP
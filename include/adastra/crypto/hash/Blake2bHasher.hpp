@@ -0,0 +1,51 @@
+#ifndef BLAKE2B_HASHER_HPP
+#define BLAKE2B_HASHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace adastra::crypto::hash
+{
+    // BLAKE2b (RFC 7693) incrémental, empreinte de 1 à 64 octets, clé optionnelle
+    // (mode MAC). La compression utilise AVX2 quand le CPU le permet.
+    class Blake2bHasher
+    {
+    public:
+        static constexpr std::size_t kMaxDigestSize = 64;
+        static constexpr std::size_t kMaxKeySize = 64;
+        static constexpr std::size_t kBlockSize = 128;
+
+        // Lance std::invalid_argument si digestSize ou la clé sont hors limites.
+        explicit Blake2bHasher(std::size_t digestSize = kMaxDigestSize,
+                               std::span<const std::uint8_t> key = {});
+
+        void reset();
+        Blake2bHasher &update(const void *data, std::size_t size);
+        Blake2bHasher &update(std::string_view data) { return update(data.data(), data.size()); }
+
+        // Écrit digestSize() octets dans `out` puis remet le hasher à zéro.
+        void finalize(std::span<std::uint8_t> out);
+        std::vector<std::uint8_t> finalize();
+
+        std::size_t digestSize() const { return digestSize_; }
+
+        static std::vector<std::uint8_t> hash(std::string_view data, std::size_t digestSize = kMaxDigestSize);
+
+        // "avx2" ou "portable".
+        static const char *backend();
+
+    private:
+        std::uint64_t h_[8];
+        std::uint64_t t_[2];
+        std::uint8_t buffer_[kBlockSize];
+        std::size_t buffered_ = 0;
+        std::size_t digestSize_;
+        std::uint8_t key_[kMaxKeySize];
+        std::size_t keySize_;
+    };
+}
+
+#endif // BLAKE2B_HASHER_HPP
@@ -0,0 +1,27 @@
+#ifndef HASH_UTILS_HPP
+#define HASH_UTILS_HPP
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace adastra::crypto::hash
+{
+    // Hexadécimal minuscule.
+    std::string toHex(std::span<const std::uint8_t> bytes);
+
+    // nullopt si la longueur est impaire ou si un caractère n'est pas hexadécimal.
+    std::optional<std::vector<std::uint8_t>> fromHex(std::string_view hex);
+
+    // Comparaison en temps constant (pour les MAC, jetons, ...) ; false si les
+    // tailles diffèrent.
+    bool constantTimeEquals(std::span<const std::uint8_t> a, std::span<const std::uint8_t> b);
+
+    std::string sha256Hex(std::string_view data);
+    std::string blake2bHex(std::string_view data, std::size_t digestSize = 32);
+}
+
+#endif // HASH_UTILS_HPP
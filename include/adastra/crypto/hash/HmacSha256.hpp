@@ -0,0 +1,36 @@
+#ifndef HMAC_SHA256_HPP
+#define HMAC_SHA256_HPP
+
+#include <adastra/crypto/hash/SHA256Hasher.hpp>
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace adastra::crypto::hash
+{
+    // HMAC-SHA256 (RFC 2104) avec la clé préparée une fois : les états SHA-256
+    // après absorption de K^ipad et K^opad sont gardés, chaque MAC ne fait que
+    // les copier. mac() est const et utilisable depuis plusieurs threads.
+    class HmacSha256
+    {
+    public:
+        using Digest = SHA256Hasher::Digest;
+
+        explicit HmacSha256(std::span<const std::uint8_t> key);
+        explicit HmacSha256(std::string_view key)
+            : HmacSha256(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t *>(key.data()), key.size())) {}
+
+        Digest mac(const void *data, std::size_t size) const;
+        Digest mac(std::string_view data) const { return mac(data.data(), data.size()); }
+
+        // Compare en temps constant le MAC de `data` à `expected`.
+        bool verify(std::string_view data, std::span<const std::uint8_t> expected) const;
+
+    private:
+        SHA256Hasher inner_;
+        SHA256Hasher outer_;
+    };
+}
+
+#endif // HMAC_SHA256_HPP
@@ -0,0 +1,61 @@
+#ifndef SHA256_HASHER_HPP
+#define SHA256_HASHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace adastra::crypto::hash
+{
+    // Implémentations de la compression SHA-256, choisie une fois à l'exécution.
+    //  - ShaNi    : instructions SHA d'Intel/AMD, un message à la fois ;
+    //  - Avx2     : 8 messages en parallèle (hashMany seulement) ;
+    //  - Portable : C++ pur.
+    enum class Sha256Backend
+    {
+        Portable,
+        Avx2,
+        ShaNi
+    };
+
+    // SHA-256 incrémental : update() autant que nécessaire puis finalize(),
+    // qui remet le hasher à zéro pour un nouveau message.
+    class SHA256Hasher
+    {
+    public:
+        static constexpr std::size_t kDigestSize = 32;
+        static constexpr std::size_t kBlockSize = 64;
+        using Digest = std::array<std::uint8_t, kDigestSize>;
+
+        SHA256Hasher() { reset(); }
+
+        void reset();
+        SHA256Hasher &update(const void *data, std::size_t size);
+        SHA256Hasher &update(std::string_view data) { return update(data.data(), data.size()); }
+        Digest finalize();
+
+        static Digest hash(const void *data, std::size_t size);
+        static Digest hash(std::string_view data) { return hash(data.data(), data.size()); }
+
+        // Hache chaque inputs[i] dans out[i] (out.size() >= inputs.size()).
+        // Pensé pour beaucoup de petits messages (un corps JSON par produit) :
+        // sans SHA-NI, les messages passent 8 par 8 dans les voies AVX2.
+        static void hashMany(std::span<const std::string_view> inputs, std::span<Digest> out);
+        static void hashMany(std::span<const std::string_view> inputs, std::span<Digest> out, Sha256Backend backend);
+
+        // Meilleure implémentation disponible sur ce CPU.
+        static Sha256Backend backend();
+        static bool supported(Sha256Backend backend);
+        static const char *name(Sha256Backend backend);
+
+    private:
+        std::uint32_t state_[8];
+        std::uint8_t buffer_[kBlockSize];
+        std::size_t buffered_ = 0;
+        std::uint64_t length_ = 0;
+    };
+}
+
+#endif // SHA256_HASHER_HPP
@@ -0,0 +1,162 @@
+#ifndef JWT_VERIFIER_HPP
+#define JWT_VERIFIER_HPP
+
+#include <adastra/crypto/hash/HmacSha256.hpp>
+#include <adastra/crypto/signature/KeyPairGenerator.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace adastra::crypto::jwt
+{
+    enum class JwtError
+    {
+        None,
+        Malformed,      // découpage, base64url ou JSON invalide
+        UnsupportedAlg, // alg absent, "none", ou différent de celui de la clé
+        UnknownKey,     // kid sans clé enregistrée
+        BadSignature,
+        Expired,
+        MissingExpiry, // pas d'exp alors que requireExpiry
+        NotYetValid,
+        WrongIssuer,
+        WrongAudience
+    };
+
+    const char *describe(JwtError error);
+
+    // Claims enregistrés (RFC 7519 §4.1) extraits une fois, plus le payload complet.
+    struct JwtClaims
+    {
+        std::string subject;
+        std::string issuer;
+        std::vector<std::string> audience;
+        std::string keyId;
+        std::int64_t expiresAt = 0; // epoch s, 0 = absent
+        std::int64_t notBefore = 0;
+        std::int64_t issuedAt = 0;
+        nlohmann::json payload;
+    };
+
+    struct JwtResult
+    {
+        JwtError error = JwtError::Malformed;
+        std::shared_ptr<const JwtClaims> claims;
+
+        explicit operator bool() const { return error == JwtError::None; }
+    };
+
+    struct JwtOptions
+    {
+        std::string issuer;   // vide = non vérifié
+        std::string audience; // vide = non vérifié
+        std::int64_t leewaySeconds = 30;
+        bool requireExpiry = true;
+
+        // Jetons déjà validés gardés jusqu'à leur exp (0 = pas de cache).
+        std::size_t cacheCapacity = 4096;
+        std::size_t cacheShards = 16;
+        // Durée de cache d'un jeton sans exp (requireExpiry = false).
+        std::int64_t cacheTtlSeconds = 300;
+
+        // Au-delà, le jeton est refusé avant tout décodage.
+        std::size_t maxTokenSize = 8192;
+    };
+
+    struct JwtStats
+    {
+        std::uint64_t cacheHits = 0;
+        std::uint64_t verified = 0; // jetons passés par la vérification complète
+        std::uint64_t rejected = 0;
+    };
+
+    // Validation de JWT compacts signés HS256 ou EdDSA (Ed25519).
+    //
+    // Chaque clé est préparée à l'enregistrement (états HMAC ipad/opad, clé
+    // publique) ; le jeton n'est vérifié complètement qu'à sa première
+    // présentation. Ensuite un cache SHA-256(jeton) -> claims, découpé en shards
+    // et borné (éviction FIFO), évite décodage, JSON et signature jusqu'à exp.
+    //
+    // Les clés s'enregistrent avant de servir : addHmacKey/addEd25519Key ne sont
+    // pas synchronisés avec verify().
+    class JwtVerifier
+    {
+    public:
+        explicit JwtVerifier(JwtOptions options = {});
+
+        // `kid` vide : clé utilisée pour les jetons sans en-tête kid.
+        void addHmacKey(std::string kid, std::string_view secret);
+        void addEd25519Key(std::string kid, const signature::PublicKey &key);
+
+        JwtResult verify(std::string_view token);
+
+        // Vide le cache, par ex. après une rotation ou révocation de clé.
+        void clearCache();
+
+        JwtStats stats() const;
+        const JwtOptions &options() const { return options_; }
+
+    private:
+        using Digest = hash::SHA256Hasher::Digest;
+
+        enum class Alg
+        {
+            HS256,
+            EdDSA
+        };
+
+        struct Key
+        {
+            Alg alg;
+            std::optional<hash::HmacSha256> hmac;
+            signature::PublicKey publicKey{};
+        };
+
+        struct DigestHash
+        {
+            std::size_t operator()(const Digest &d) const noexcept;
+        };
+
+        struct Entry
+        {
+            std::shared_ptr<const JwtClaims> claims;
+            std::int64_t cachedUntil; // epoch s
+        };
+
+        struct Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<Digest, Entry, DigestHash> entries;
+            std::vector<Digest> fifo;
+            std::size_t next = 0;
+        };
+
+        JwtResult verifyFull(std::string_view token, std::int64_t now);
+        JwtError checkTimes(const JwtClaims &claims, std::int64_t now) const;
+        Shard &shardOf(const Digest &d);
+        void remember(const Digest &d, std::shared_ptr<const JwtClaims> claims);
+        JwtResult reject(JwtError error);
+
+        JwtOptions options_;
+        std::unordered_map<std::string, Key> keys_;
+
+        std::size_t perShard_ = 0;
+        std::vector<std::unique_ptr<Shard>> shards_;
+
+        std::atomic<std::uint64_t> hits_{0};
+        std::atomic<std::uint64_t> verified_{0};
+        std::atomic<std::uint64_t> rejected_{0};
+    };
+}
+
+#endif // JWT_VERIFIER_HPP
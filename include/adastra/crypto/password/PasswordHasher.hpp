@@ -0,0 +1,59 @@
+#ifndef PASSWORD_HASHER_HPP
+#define PASSWORD_HASHER_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace adastra::crypto::password
+{
+    enum class PasswordAlgorithm
+    {
+        Scrypt,
+        Pbkdf2Sha256
+    };
+
+    struct PasswordParams
+    {
+        PasswordAlgorithm algorithm = PasswordAlgorithm::Scrypt;
+
+        // scrypt : N = 2^logN ; mémoire ~ 128 * r * N octets (32 Mio par défaut,
+        // 256 Mio au plus), p <= 4.
+        unsigned scryptLogN = 15;
+        unsigned scryptR = 8;
+        unsigned scryptP = 1;
+
+        unsigned pbkdf2Iterations = 600000;
+    };
+
+    // Hachage de mots de passe via OpenSSL (scrypt ou PBKDF2-HMAC-SHA256), sel
+    // aléatoire de 16 octets, format auto-descriptif :
+    //   $scrypt$ln=15,r=8,p=1$<sel>$<clé>
+    //   $pbkdf2-sha256$i=600000$<sel>$<clé>
+    // (sel et clé en base64url). verify() relit les paramètres du hash stocké :
+    // changer PasswordParams n'invalide pas les anciens hashes.
+    //
+    // Coûteux par conception (dizaines de ms) : à appeler hors des threads
+    // HTTP, voir CredentialHashingService.
+    class PasswordHasher
+    {
+    public:
+        explicit PasswordHasher(PasswordParams params = {});
+
+        std::string hash(std::string_view password) const;
+
+        // false si le mot de passe ne correspond pas ou si `encoded` est illisible
+        // ou hors des bornes de paramètres acceptées.
+        bool verify(std::string_view password, std::string_view encoded) const;
+
+        // true si `encoded` n'utilise pas les paramètres courants.
+        bool needsRehash(std::string_view encoded) const;
+
+        const PasswordParams &params() const { return params_; }
+
+    private:
+        PasswordParams params_;
+    };
+}
+
+#endif // PASSWORD_HASHER_HPP
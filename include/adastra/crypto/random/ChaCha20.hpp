@@ -0,0 +1,25 @@
+#ifndef CHACHA20_HPP
+#define CHACHA20_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace adastra::crypto::random
+{
+    // Flux ChaCha20 (20 tours, variante d'origine : compteur 64 bits + nonce 64 bits).
+    // Sur x86-64 les blocs sont calculés 4 par 4 (SSE2) ou 8 par 8 (AVX2),
+    // choisi une fois à l'exécution.
+    struct ChaCha20
+    {
+        static constexpr std::size_t kBlockSize = 64;
+
+        // Écrit `count` blocs de flux à partir de `counter` dans `out`.
+        static void blocks(const std::uint32_t key[8], std::uint64_t counter, std::uint64_t nonce,
+                           std::uint8_t *out, std::size_t count);
+
+        // "avx2", "sse2" ou "scalar".
+        static const char *backend();
+    };
+}
+
+#endif // CHACHA20_HPP
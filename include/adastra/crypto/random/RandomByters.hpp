@@ -0,0 +1,36 @@
+#ifndef RANDOM_BYTES_HPP
+#define RANDOM_BYTES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace adastra::crypto::random
+{
+    // Aléa cryptographique rapide : un DRBG ChaCha20 par thread, amorcé par
+    // SecureRandom (getrandom). Ni appel système ni verrou par tirage.
+    //
+    //  - effacement rapide de clé : chaque remplissage du tampon remplace la clé
+    //    par les 32 premiers octets produits, et les octets servis sont effacés ;
+    //  - réamorçage avec de l'entropie noyau tous les kReseedBytes octets ;
+    //  - après un fork(), l'enfant réamorce avant son premier tirage (sinon il
+    //    rejouerait le flux du parent).
+    class RandomBytes
+    {
+    public:
+        static constexpr std::size_t kPoolSize = 4096;
+        static constexpr std::uint64_t kReseedBytes = 1ULL << 20;
+
+        static void fill(void *out, std::size_t size);
+        static void fill(std::span<std::byte> out) { fill(out.data(), out.size()); }
+
+        static std::uint64_t u64()
+        {
+            std::uint64_t v;
+            fill(&v, sizeof(v));
+            return v;
+        }
+    };
+}
+
+#endif // RANDOM_BYTES_HPP
@@ -0,0 +1,19 @@
+#ifndef SECURE_RANDOM_HPP
+#define SECURE_RANDOM_HPP
+
+#include <cstddef>
+
+namespace adastra::crypto::random
+{
+    // Entropie du noyau (getrandom, /dev/urandom en repli). Un appel système par
+    // appel : à réserver aux graines et aux gros blocs, les petits tirages passent
+    // par RandomBytes.
+    class SecureRandom
+    {
+    public:
+        // Lance std::runtime_error si le noyau ne fournit pas les octets.
+        static void fill(void *out, std::size_t size);
+    };
+}
+
+#endif // SECURE_RANDOM_HPP
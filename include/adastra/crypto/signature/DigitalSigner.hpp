@@ -0,0 +1,39 @@
+#ifndef DIGITAL_SIGNER_HPP
+#define DIGITAL_SIGNER_HPP
+
+#include <adastra/crypto/signature/KeyPairGenerator.hpp>
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace adastra::crypto::signature
+{
+    // Signe avec une clé Ed25519 chargée une fois. sign() est utilisable depuis
+    // plusieurs threads.
+    //
+    // Sans OpenSSL (SA_HAS_OPENSSL absent), le constructeur lance std::runtime_error.
+    class DigitalSigner
+    {
+    public:
+        explicit DigitalSigner(const PrivateKey &key);
+        ~DigitalSigner();
+
+        DigitalSigner(const DigitalSigner &) = delete;
+        DigitalSigner &operator=(const DigitalSigner &) = delete;
+
+        Signature sign(std::span<const std::uint8_t> message) const;
+        Signature sign(std::string_view message) const
+        {
+            return sign({reinterpret_cast<const std::uint8_t *>(message.data()), message.size()});
+        }
+
+        const PublicKey &publicKey() const { return publicKey_; }
+
+    private:
+        void *key_ = nullptr; // EVP_PKEY*
+        PublicKey publicKey_{};
+    };
+}
+
+#endif // DIGITAL_SIGNER_HPP
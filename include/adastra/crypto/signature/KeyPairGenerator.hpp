@@ -0,0 +1,35 @@
+#ifndef KEY_PAIR_GENERATOR_HPP
+#define KEY_PAIR_GENERATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace adastra::crypto::signature
+{
+    // Ed25519 (RFC 8032) : clé privée = graine de 32 octets, clé publique de
+    // 32 octets, signature de 64 octets.
+    using PrivateKey = std::array<std::uint8_t, 32>;
+    using PublicKey = std::array<std::uint8_t, 32>;
+    using Signature = std::array<std::uint8_t, 64>;
+
+    struct KeyPair
+    {
+        PublicKey publicKey;
+        PrivateKey privateKey;
+    };
+
+    class KeyPairGenerator
+    {
+    public:
+        // Nouvelle paire à partir de l'entropie du noyau.
+        static KeyPair generate();
+
+        // Paire déterministe (clé stockée dans un secret, tests).
+        static KeyPair fromSeed(const PrivateKey &seed);
+
+        static PublicKey publicKeyOf(const PrivateKey &seed);
+    };
+}
+
+#endif // KEY_PAIR_GENERATOR_HPP
@@ -0,0 +1,112 @@
+#ifndef SIGNATURE_VERIFIER_HPP
+#define SIGNATURE_VERIFIER_HPP
+
+#include <adastra/crypto/hash/SHA256Hasher.hpp>
+#include <adastra/crypto/signature/KeyPairGenerator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace adastra::crypto::signature
+{
+    struct VerifierOptions
+    {
+        // Nombre de signatures valides mémorisées (0 = pas de cache).
+        std::size_t cacheCapacity = 1u << 16;
+        std::size_t cacheShards = 16;
+
+        // Participants max de verifyBatch sur le TaskScheduler partagé, appelant
+        // compris (0 = un par cœur).
+        unsigned workers = 0;
+    };
+
+    struct SignedMessage
+    {
+        const PublicKey *key;
+        std::span<const std::uint8_t> message;
+        const Signature *signature;
+    };
+
+    struct VerifierStats
+    {
+        std::uint64_t cacheHits = 0;
+        std::uint64_t verified = 0; // vérifications Ed25519 réellement faites
+        std::uint64_t rejected = 0;
+    };
+
+    // Vérification Ed25519 avec un cache des signatures déjà acceptées : un jeton
+    // présenté à chaque requête ne coûte qu'un SHA-256 et une recherche après la
+    // première fois. Seuls les succès sont mémorisés ; l'entrée porte sur
+    // (clé, signature, message), une autre signature du même message repasse par
+    // la vérification complète.
+    //
+    // Le cache est découpé en shards (verrou lecteur/écrivain chacun) et chaque
+    // shard évince en FIFO. Les gros lots de verifyBatch sont répartis sur le
+    // TaskScheduler partagé.
+    class SignatureVerifier
+    {
+    public:
+        explicit SignatureVerifier(VerifierOptions options = {});
+
+        SignatureVerifier(const SignatureVerifier &) = delete;
+        SignatureVerifier &operator=(const SignatureVerifier &) = delete;
+
+        bool verify(const PublicKey &key, std::span<const std::uint8_t> message, const Signature &signature);
+        bool verify(const PublicKey &key, std::string_view message, const Signature &signature)
+        {
+            return verify(key, {reinterpret_cast<const std::uint8_t *>(message.data()), message.size()}, signature);
+        }
+
+        // results[i] = validité de items[i] (results.size() >= items.size()).
+        // Les signatures absentes du cache sont réparties sur le pool partagé, le
+        // thread appelant y participe. Renvoie le nombre de signatures valides.
+        std::size_t verifyBatch(std::span<const SignedMessage> items, std::span<bool> results);
+
+        // Vide le cache, par ex. après la révocation d'une clé.
+        void clearCache();
+
+        VerifierStats stats() const;
+
+        // Vérification brute, sans cache.
+        static bool verifyUncached(const PublicKey &key, std::span<const std::uint8_t> message, const Signature &signature);
+
+    private:
+        using Digest = hash::SHA256Hasher::Digest;
+
+        struct DigestHash
+        {
+            std::size_t operator()(const Digest &d) const noexcept;
+        };
+
+        struct Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_set<Digest, DigestHash> entries;
+            std::vector<Digest> fifo; // ordre d'insertion, taille <= capacity
+            std::size_t next = 0;
+        };
+
+        static Digest cacheKey(const PublicKey &key, std::span<const std::uint8_t> message, const Signature &signature);
+        Shard &shardOf(const Digest &d);
+        bool cached(const Digest &d);
+        void remember(const Digest &d);
+        bool check(const SignedMessage &item, const Digest &d);
+
+        VerifierOptions options_;
+        std::size_t perShard_ = 0;
+        std::vector<std::unique_ptr<Shard>> shards_;
+
+        std::atomic<std::uint64_t> hits_{0};
+        std::atomic<std::uint64_t> verified_{0};
+        std::atomic<std::uint64_t> rejected_{0};
+    };
+}
+
+#endif // SIGNATURE_VERIFIER_HPP
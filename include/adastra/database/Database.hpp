@@ -0,0 +1,104 @@
+#ifndef DATABASE_HPP
+#define DATABASE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace adastra::database
+{
+    struct ConnectionOptions
+    {
+        bool readOnly = false;
+        // PRAGMA mmap_size : les pages lues sont servies par le cache du noyau.
+        std::int64_t mmapSize = std::int64_t{256} << 20;
+        // PRAGMA cache_size (Kio) : borne la mémoire par connexion, quelle que soit la taille de la base.
+        int cacheSizeKiB = 16 << 10;
+        int busyTimeoutMs = 5000;
+        // Requêtes préparées gardées par connexion (LRU).
+        std::size_t statementCache = 64;
+    };
+
+    // Requête préparée SQLite. Les indices de bind commencent à 1, ceux des colonnes à 0.
+    class Statement
+    {
+    public:
+        Statement(sqlite3 *db, std::string_view sql);
+        ~Statement();
+
+        Statement(const Statement &) = delete;
+        Statement &operator=(const Statement &) = delete;
+
+        Statement &bind(int index, std::int64_t value);
+        Statement &bind(int index, double value);
+        Statement &bind(int index, std::string_view text);
+        Statement &bindNull(int index);
+
+        // true tant qu'une ligne est disponible ; lance std::runtime_error sur erreur.
+        bool step();
+        // Exécute une requête sans résultat.
+        void run();
+
+        // Réarme la requête et efface les paramètres liés.
+        void reset();
+
+        bool isNull(int column) const;
+        std::int64_t columnInt64(int column) const;
+        double columnDouble(int column) const;
+        // Valide jusqu'au prochain step()/reset().
+        std::string_view columnText(int column) const;
+
+    private:
+        sqlite3 *db_;
+        sqlite3_stmt *stmt_ = nullptr;
+    };
+
+    // Connexion SQLite avec cache de requêtes préparées. Une connexion ne doit
+    // être utilisée que par un thread à la fois.
+    //
+    // Sans SQLite (SA_HAS_SQLITE absent), le constructeur lance std::runtime_error.
+    class Connection
+    {
+    public:
+        Connection(const std::string &path, ConnectionOptions options = {});
+        ~Connection();
+
+        Connection(const Connection &) = delete;
+        Connection &operator=(const Connection &) = delete;
+
+        // Une ou plusieurs instructions sans paramètres (schéma, PRAGMA...).
+        void exec(std::string_view sql);
+
+        // Requête préparée depuis le cache, déjà réarmée. La référence reste valide
+        // tant que moins de statementCache autres requêtes sont préparées.
+        Statement &prepare(const std::string &sql);
+
+        std::int64_t lastInsertId() const;
+        int changes() const;
+
+        const ConnectionOptions &options() const { return options_; }
+        sqlite3 *handle() const { return db_; }
+
+    private:
+        struct Cached
+        {
+            std::unique_ptr<Statement> statement;
+            std::list<std::string>::iterator lru;
+        };
+
+        sqlite3 *db_ = nullptr;
+        ConnectionOptions options_;
+        std::unordered_map<std::string, Cached> statements_;
+        std::list<std::string> lru_; // plus récent en tête
+    };
+}
+
+#endif // DATABASE_HPP
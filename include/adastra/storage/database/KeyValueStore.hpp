@@ -0,0 +1,200 @@
+#ifndef KEY_VALUE_STORE_HPP
+#define KEY_VALUE_STORE_HPP
+
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace adastra::storage::filesystem
+{
+    class MappedFile;
+}
+
+namespace adastra::storage::database
+{
+    struct KeyValueOptions
+    {
+        // Taille à partir de laquelle le segment actif est scellé (max 1 GiB).
+        std::uint64_t segmentBytes = std::uint64_t{64} << 20;
+        // put/remove ne rendent la main qu'une fois l'écriture durable ; les
+        // écrivains concurrents partagent le même fsync (commit groupé).
+        bool syncWrites = true;
+        // Fusion des segments scellés dès que cette part de leurs octets est morte...
+        double compactRatio = 0.5;
+        // ...et qu'elle représente au moins ce volume.
+        std::uint64_t compactMinBytes = std::uint64_t{16} << 20;
+        // Fusion et écriture des fichiers hint en tâche de fond (TaskScheduler partagé).
+        bool backgroundCompaction = true;
+    };
+
+    struct KeyValueStats
+    {
+        std::size_t keys = 0;
+        std::size_t segments = 0;
+        std::size_t indexCapacity = 0;   // cases de la table de hachage
+        std::uint64_t diskBytes = 0;
+        std::uint64_t deadBytes = 0;     // enregistrements écrasés, supprimés ou tombstones
+
+        std::uint64_t puts = 0;
+        std::uint64_t removes = 0;
+        std::uint64_t syncs = 0;         // fdatasync du commit groupé
+        std::uint64_t compactions = 0;
+        std::uint64_t reclaimedBytes = 0;
+
+        std::size_t hintSegments = 0;    // segments relus depuis leur hint à l'ouverture
+        std::size_t scannedSegments = 0; // segments relus en entier (sans hint, ou hint invalide)
+        double openSeconds = 0;
+    };
+
+    // Stockage clé/valeur embarqué de type Bitcask pour les paniers, sessions,
+    // likes et compteurs :
+    //  - les écritures sont ajoutées à la fin d'un segment (<id>.data), jamais
+    //    réécrites sur place ; une suppression ajoute un tombstone ;
+    //  - l'index est une table de hachage à adressage ouvert en mémoire (32
+    //    octets par clé, sans les clés : elles sont relues et comparées sur
+    //    disque), donc un get coûte une seule lecture (mmap pour les segments
+    //    scellés) ;
+    //  - chaque segment scellé reçoit un fichier hint (<id>.hint) qui permet de
+    //    reconstruire l'index à l'ouverture sans relire les valeurs ;
+    //  - la fusion réécrit les segments scellés en ne gardant que les valeurs
+    //    vivantes, puis supprime les anciens.
+    //
+    // Chaque enregistrement porte un CRC32C et un numéro de séquence : une fin de
+    // segment tronquée par un crash est ignorée, et l'ordre des écritures ne
+    // dépend pas de l'ordre des fichiers. Un seul processus par répertoire.
+    class KeyValueStore
+    {
+    public:
+        // Lance std::runtime_error si le répertoire ne peut pas être ouvert.
+        explicit KeyValueStore(std::string directory, KeyValueOptions options = {});
+        ~KeyValueStore(); // attend la fusion en cours puis synchronise le segment actif
+
+        KeyValueStore(const KeyValueStore &) = delete;
+        KeyValueStore &operator=(const KeyValueStore &) = delete;
+
+        // Clé de 64 Kio et valeur de 256 Mio au plus (std::length_error sinon).
+        void put(std::string_view key, std::string_view value);
+        std::optional<std::string> get(std::string_view key) const;
+        bool contains(std::string_view key) const;
+
+        // false si la clé n'existait pas (rien n'est alors écrit).
+        bool remove(std::string_view key);
+
+        // Ajoute delta au compteur décimal stocké sous `key` (0 s'il est absent) et
+        // retourne la nouvelle valeur ; atomique vis-à-vis des autres écritures.
+        // std::invalid_argument si la valeur existante n'est pas un entier.
+        std::int64_t increment(std::string_view key, std::int64_t delta = 1);
+
+        // Rend durables les écritures faites avec syncWrites = false.
+        void sync();
+
+        // Fusionne maintenant les segments scellés, quel que soit le taux de
+        // déchets ; retourne les octets récupérés.
+        std::uint64_t compact();
+
+        std::size_t size() const;
+        KeyValueStats stats() const;
+        const std::string &directory() const { return directory_; }
+
+    private:
+        struct Segment;
+        using SegmentPtr = std::shared_ptr<Segment>;
+
+        // Case de l'index ; segment == 0 : case vide.
+        struct Slot
+        {
+            std::uint64_t hash;
+            std::uint64_t seq;
+            std::uint32_t segment;
+            std::uint32_t offset;   // début de l'enregistrement dans le segment
+            std::uint32_t keyLen;
+            std::uint32_t valueLen; // kTombstone pendant l'ouverture uniquement
+        };
+
+        // Enregistrement lu dans un hint ou un segment.
+        struct Located
+        {
+            std::uint64_t seq;
+            std::uint32_t offset;
+            std::uint32_t keyLen;
+            std::uint32_t valueLen;
+        };
+
+        // ---- index (indexMutex_)
+        std::size_t findSlot(std::string_view key, std::uint64_t hash) const; // npos si absent
+        void upsert(std::string_view key, std::uint64_t hash, const Slot &slot);
+        void eraseAt(std::size_t pos);
+        void growIndex();
+        void markDead(std::uint32_t segment, std::uint64_t bytes);
+        std::size_t findRecord(std::uint64_t hash, std::uint32_t segment, std::uint32_t offset) const;
+        bool keyMatches(const Slot &slot, std::string_view key) const;
+        std::string readValue(const Slot &slot) const;
+
+        // ---- ouverture
+        void open();
+        void loadRecord(std::uint32_t segment, const Located &rec, std::string_view key);
+        bool loadHint(Segment &segment);
+        void scanSegment(Segment &segment);
+        void dropTombstones();
+
+        // ---- écriture (writeMutex_)
+        std::uint64_t append(std::string_view key, std::string_view value, bool tombstone);
+        void rotate();
+        SegmentPtr createSegment();
+        void waitDurable(std::unique_lock<std::mutex> &lock, std::uint64_t seq);
+
+        // ---- fond
+        void maybeScheduleMaintenance();
+        std::uint64_t maintenance(bool force);
+        void writeHint(Segment &segment);
+        std::uint64_t merge();
+
+        std::string directory_;
+        KeyValueOptions options_;
+
+        mutable std::shared_mutex indexMutex_;
+        std::vector<Slot> slots_;
+        std::size_t used_ = 0;
+        std::map<std::uint32_t, SegmentPtr> segments_;
+
+        std::mutex writeMutex_;
+        std::condition_variable synced_;
+        SegmentPtr active_;
+        std::uint32_t nextSegment_ = 1;
+        std::uint64_t nextSeq_ = 1;
+        std::uint64_t writtenSeq_ = 0;
+        std::uint64_t syncedSeq_ = 0;
+        bool syncing_ = false;
+
+        std::mutex maintenanceMutex_; // une seule fusion à la fois
+        std::atomic<bool> maintenanceQueued_{false};
+        std::atomic<std::size_t> unhinted_{0};        // segments scellés sans hint
+        std::atomic<std::uint64_t> deadBytes_{0};
+        std::atomic<std::uint64_t> nextCheck_{0};     // deadBytes_ qui relance une vérification
+        std::atomic<bool> closing_{false};
+        std::mutex maintenanceTaskMutex_; // maintenanceTask_
+        adastra::core::concurrency::TaskFuture<void> maintenanceTask_;
+
+        std::atomic<std::uint64_t> puts_{0};
+        std::atomic<std::uint64_t> removes_{0};
+        std::atomic<std::uint64_t> syncs_{0};
+        std::atomic<std::uint64_t> compactions_{0};
+        std::atomic<std::uint64_t> reclaimed_{0};
+        std::size_t hintSegments_ = 0;
+        std::size_t scannedSegments_ = 0;
+        double openSeconds_ = 0;
+    };
+}
+
+#endif // KEY_VALUE_STORE_HPP
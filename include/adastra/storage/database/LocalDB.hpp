@@ -0,0 +1,107 @@
+#ifndef LOCAL_DB_HPP
+#define LOCAL_DB_HPP
+
+#include <adastra/database/Database.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace adastra::storage::database
+{
+    struct LocalDBOptions
+    {
+        std::int64_t mmapSize = std::int64_t{1} << 30;
+        int cacheSizeKiB = 16 << 10;  // par connexion
+        int busyTimeoutMs = 5000;
+        std::size_t statementCache = 64;
+        // Écritures regroupées au plus dans une transaction.
+        std::size_t maxBatch = 512;
+        // synchronous=FULL : chaque commit est durable même en cas de coupure
+        // de courant ; NORMAL (défaut en WAL) peut perdre les derniers commits.
+        bool fullSync = false;
+    };
+
+    struct LocalDBStats
+    {
+        std::uint64_t writes = 0;       // appels à write()
+        std::uint64_t transactions = 0; // commits (une transaction regroupe plusieurs write())
+        std::uint64_t failedWrites = 0;
+        std::size_t readConnections = 0;
+    };
+
+    // Base SQLite locale en mode WAL : les lecteurs ne bloquent jamais l'écrivain
+    // ni les uns les autres.
+    //  - read() s'exécute sur une connexion en lecture seule propre au thread
+    //    appelant, ouverte au premier appel, avec son cache de requêtes préparées ;
+    //  - write() passe par un écrivain unique : les appels concurrents sont
+    //    regroupés dans une même transaction (un seul commit, un seul fsync).
+    //    Chaque appel a son SAVEPOINT : une exception annule ses écritures à lui
+    //    seulement, et se propage à son appelant.
+    class LocalDB
+    {
+    public:
+        using Connection = adastra::database::Connection;
+
+        // `schema` est exécuté dans la première transaction (CREATE ... IF NOT EXISTS).
+        // Lance std::runtime_error si la base ne peut pas être ouverte.
+        explicit LocalDB(std::string path, LocalDBOptions options = {}, const std::string &schema = {});
+        ~LocalDB();
+
+        LocalDB(const LocalDB &) = delete;
+        LocalDB &operator=(const LocalDB &) = delete;
+
+        // fn doit réinitialiser (reset()) les requêtes qu'il n'a pas lues jusqu'au
+        // bout : sinon la connexion du thread reste sur un instantané figé.
+        template <typename Fn>
+        decltype(auto) read(Fn &&fn) const
+        {
+            return fn(readConnection());
+        }
+
+        // Retourne une fois la transaction qui contient fn validée.
+        void write(std::function<void(Connection &)> fn);
+
+        const std::string &path() const { return path_; }
+        LocalDBStats stats() const;
+
+    private:
+        struct Job
+        {
+            std::function<void(Connection &)> fn;
+            std::exception_ptr error;
+            bool done = false;
+        };
+
+        Connection &readConnection() const;
+        adastra::database::ConnectionOptions connectionOptions(bool readOnly) const;
+        void runBatch(const std::vector<Job *> &batch);
+
+        std::string path_;
+        LocalDBOptions options_;
+        std::uint64_t instance_; // clé des connexions par thread, jamais réutilisée
+
+        std::unique_ptr<Connection> writer_; // utilisé par le thread qui mène le lot
+        std::mutex writeMutex_;
+        std::condition_variable written_;
+        std::deque<Job *> queue_;
+        bool writing_ = false;
+
+        mutable std::mutex readersMutex_;
+        mutable std::vector<std::shared_ptr<Connection>> readers_;
+
+        std::atomic<std::uint64_t> writes_{0};
+        std::atomic<std::uint64_t> transactions_{0};
+        std::atomic<std::uint64_t> failedWrites_{0};
+    };
+}
+
+#endif // LOCAL_DB_HPP
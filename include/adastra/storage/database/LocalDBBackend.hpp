@@ -0,0 +1,49 @@
+#ifndef LOCAL_DB_BACKEND_HPP
+#define LOCAL_DB_BACKEND_HPP
+
+#include <adastra/core/repository/RepositoryBackend.hpp>
+#include <adastra/storage/database/LocalDB.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace adastra::storage::database
+{
+    // Backend de JsonRepository sur une table LocalDB : une ligne par document
+    // (id INTEGER PRIMARY KEY, body TEXT JSON). Chaque champ de `indexedFields`
+    // reçoit un index sur json_extract(body, '$.<champ>'), utilisé par findBy() :
+    // les requêtes lisent quelques pages au lieu de charger la collection, qui
+    // peut donc dépasser la mémoire.
+    //
+    // Un document sans id (0) reçoit le prochain rowid.
+    class LocalDBBackend : public adastra::core::repository::RepositoryBackend
+    {
+    public:
+        // Lance std::invalid_argument si `table` ou un champ n'est pas un identifiant SQL simple.
+        LocalDBBackend(std::shared_ptr<LocalDB> db, std::string table, std::vector<std::string> indexedFields = {});
+
+        bool incremental() const override { return true; }
+
+        std::vector<nlohmann::json> loadAll() override;
+        void replaceAll(const std::vector<nlohmann::json> &items) override;
+        void upsert(const std::vector<std::pair<std::uint64_t, nlohmann::json>> &items) override;
+
+        std::optional<nlohmann::json> findById(std::uint64_t id) override;
+        std::vector<nlohmann::json> findBy(const std::string &field, const nlohmann::json &value,
+                                           std::size_t limit, std::size_t offset) override;
+
+        std::size_t count() override;
+
+        const std::shared_ptr<LocalDB> &db() const { return db_; }
+
+    private:
+        std::string quoted() const { return "\"" + table_ + "\""; }
+
+        std::shared_ptr<LocalDB> db_;
+        std::string table_;
+        std::string upsertSql_;
+    };
+}
+
+#endif // LOCAL_DB_BACKEND_HPP
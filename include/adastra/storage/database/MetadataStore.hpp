@@ -0,0 +1,131 @@
+#ifndef METADATA_STORE_HPP
+#define METADATA_STORE_HPP
+
+#include <adastra/core/columnar/ColumnScan.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace adastra::storage::database
+{
+    struct MetadataStoreOptions
+    {
+        // Mises à jour gardées en mémoire (toutes colonnes confondues) avant leur
+        // fusion dans les fichiers de colonnes.
+        std::size_t maxDelta = std::size_t{1} << 16;
+        // Fusion sur le TaskScheduler partagé ; sinon dans l'appel qui dépasse maxDelta.
+        bool backgroundMerge = true;
+    };
+
+    struct MetadataStats
+    {
+        std::size_t columns = 0;
+        std::size_t rows = 0;           // slots couverts (fichiers + delta)
+        std::size_t pendingUpdates = 0; // entrées du delta en mémoire
+        std::uint64_t packedBytes = 0;  // taille des fichiers de colonnes
+        std::uint64_t merges = 0;
+    };
+
+    // Compteurs entiers (vues, likes, commandes, ...) rangés par colonne et indexés
+    // par slot, sans passer par les documents JSON :
+    //  - chaque colonne est un fichier <nom>.col projeté en mémoire ; ses valeurs
+    //    sont découpées en blocs de 128, chacun stocké comme (minimum du bloc,
+    //    écarts au minimum sur la largeur en bits du plus grand écart) ;
+    //  - les blocs sont décodés en SSE2 (4 valeurs par instruction) dans un tampon
+    //    de 128 valeurs qui reste en L1 ; sum(), top() et atLeast() ne décodent que
+    //    les blocs qui peuvent contribuer au résultat ;
+    //  - set()/add() écrivent dans un delta en mémoire, appliqué par-dessus les
+    //    blocs à la lecture, puis fusionné en réécrivant les colonnes concernées.
+    //
+    // Le delta n'est écrit que par la fusion (flush(), maxDelta atteint ou
+    // destructeur) : un crash perd les mises à jour qui n'ont pas été fusionnées.
+    class MetadataStore
+    {
+    public:
+        using Column = std::size_t;
+
+        // Ouvre (ou crée) une colonne par nom de `columns` dans `directory`.
+        // Lance std::runtime_error si un fichier est illisible ou corrompu, et
+        // std::invalid_argument si un nom n'est pas [A-Za-z0-9_]+.
+        MetadataStore(std::string directory, std::vector<std::string> columns, MetadataStoreOptions options = {});
+        ~MetadataStore(); // attend la fusion en cours puis fusionne le reste du delta
+
+        MetadataStore(const MetadataStore &) = delete;
+        MetadataStore &operator=(const MetadataStore &) = delete;
+
+        // Index de la colonne `name` ; std::out_of_range si elle n'existe pas.
+        Column column(std::string_view name) const;
+
+        // Un slot jamais écrit vaut 0.
+        std::uint32_t get(Column c, std::uint32_t slot) const;
+        void set(Column c, std::uint32_t slot, std::uint32_t value);
+
+        // Ajoute delta (résultat borné à [0, UINT32_MAX]) et retourne la nouvelle valeur.
+        std::uint32_t add(Column c, std::uint32_t slot, std::int64_t delta = 1);
+
+        // Valeurs des slots [begin, begin + out.size()).
+        void read(Column c, std::uint32_t begin, std::span<std::uint32_t> out) const;
+
+        std::uint64_t sum(Column c) const;
+
+        // Les k slots de plus grande valeur non nulle, par valeur décroissante
+        // (à égalité, slot croissant).
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> top(Column c, std::size_t k) const;
+
+        // Slots dont la valeur est >= min, par ordre croissant.
+        adastra::core::columnar::Selection atLeast(Column c, std::uint32_t min) const;
+
+        // Fusionne tout le delta dans les fichiers avant de rendre la main.
+        void flush();
+
+        std::size_t rows() const;
+        MetadataStats stats() const;
+        const std::string &directory() const { return directory_; }
+
+    private:
+        struct ColumnFile;
+        using ColumnFilePtr = std::shared_ptr<const ColumnFile>;
+
+        struct ColumnState
+        {
+            std::string name;
+            ColumnFilePtr file;
+            std::map<std::uint32_t, std::uint32_t> delta; // slot -> valeur courante
+        };
+
+        // Parcourt les blocs de 128 slots de la colonne (mutex_ partagé tenu).
+        // fn(premier slot, nombre de valeurs, valeurs) ; skip(min, max) permet
+        // d'écarter sans le décoder un bloc que le delta ne modifie pas.
+        template <typename Fn, typename Skip>
+        void scan(const ColumnState &column, Fn &&fn, Skip &&skip) const;
+
+        std::uint32_t valueAt(const ColumnState &column, std::uint32_t slot) const;
+        void noteUpdate(std::unique_lock<std::shared_mutex> &lock);
+        void merge();
+
+        std::string directory_;
+        MetadataStoreOptions options_;
+
+        mutable std::shared_mutex mutex_; // columns_ (fichiers et delta)
+        std::vector<ColumnState> columns_;
+        std::size_t pending_ = 0;
+
+        std::mutex mergeMutex_; // une fusion à la fois
+        std::atomic<bool> mergeScheduled_{false};
+        adastra::core::concurrency::TaskFuture<void> backgroundMerge_;
+        std::atomic<std::uint64_t> merges_{0};
+    };
+}
+
+#endif // METADATA_STORE_HPP
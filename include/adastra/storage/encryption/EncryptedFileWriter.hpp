@@ -0,0 +1,68 @@
+#ifndef ENCRYPTED_FILE_WRITER_HPP
+#define ENCRYPTED_FILE_WRITER_HPP
+
+#include <adastra/crypto/encryption/FileEncryption.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace adastra::storage::encryption
+{
+    // Écriture en flux d'un fichier chiffré (format FileEncryption.hpp) : les
+    // write() de l'appelant alimentent le pipeline FileEncryptor qui tourne en
+    // arrière-plan (chiffrement et écriture disque en parallèle de l'appelant).
+    //
+    //   EncryptedFileWriter w("backup.sagcm", key);
+    //   w.write(data1); w.write(data2);
+    //   w.close(); // obligatoire pour un fichier valide
+    class EncryptedFileWriter
+    {
+    public:
+        EncryptedFileWriter(const std::string &path, std::span<const std::uint8_t> key,
+                            adastra::crypto::encryption::EncryptionOptions options = {});
+
+        // Sans close(), le pipeline est abandonné et le fichier partiel supprimé.
+        ~EncryptedFileWriter();
+
+        EncryptedFileWriter(const EncryptedFileWriter &) = delete;
+        EncryptedFileWriter &operator=(const EncryptedFileWriter &) = delete;
+
+        // Bloque si le pipeline a déjà maxBuffered octets en attente.
+        // Relance l'erreur du pipeline s'il a échoué.
+        void write(std::span<const std::uint8_t> data);
+        void write(const void *data, std::size_t size) { write({static_cast<const std::uint8_t *>(data), size}); }
+
+        // Termine le flux, attend l'écriture complète puis renomme le fichier.
+        adastra::crypto::encryption::EncryptionStats close();
+
+    private:
+        std::size_t pull(std::uint8_t *out, std::size_t size); // Source du pipeline
+
+        std::string path_;
+        std::size_t maxBuffered_;
+        adastra::crypto::encryption::FileEncryptor encryptor_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<std::vector<std::uint8_t>> pending_;
+        std::size_t pendingFront_ = 0; // octets déjà consommés de pending_.front()
+        std::size_t buffered_ = 0;
+        bool closing_ = false;
+        bool aborted_ = false;
+        bool closed_ = false;
+
+        std::thread worker_;
+        std::exception_ptr error_;
+        adastra::crypto::encryption::EncryptionStats stats_;
+    };
+}
+
+#endif // ENCRYPTED_FILE_WRITER_HPP
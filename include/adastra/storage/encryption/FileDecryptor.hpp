@@ -0,0 +1,60 @@
+#ifndef FILE_DECRYPTOR_HPP
+#define FILE_DECRYPTOR_HPP
+
+#include <adastra/crypto/encryption/FileEncryption.hpp>
+#include <adastra/storage/filesystem/MappedFile.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace adastra::storage::encryption
+{
+    // Lecture d'un conteneur chiffré (FileEncryption.hpp) à n'importe quel
+    // offset : seuls les blocs concernés sont lus et déchiffrés. Chaque bloc est
+    // authentifié ; un tag invalide (fichier modifié, tronqué, mauvaise clé)
+    // lance std::runtime_error.
+    class FileDecryptor
+    {
+    public:
+        // Lance si le fichier n'est pas un conteneur, si sa taille est incohérente
+        // ou si son dernier bloc n'est pas authentique (troncature, mauvaise clé).
+        FileDecryptor(const std::string &path, std::span<const std::uint8_t> key);
+        ~FileDecryptor();
+
+        FileDecryptor(const FileDecryptor &) = delete;
+        FileDecryptor &operator=(const FileDecryptor &) = delete;
+
+        // Déduits de la taille du fichier ; authentifiés par le constructeur (dernier bloc).
+        std::uint64_t plaintextSize() const { return plaintextSize_; }
+        std::uint64_t blockCount() const { return blockCount_; }
+        std::size_t blockSize() const { return header_.blockSize; }
+
+        // Clair des blocs [first, first + count).
+        std::vector<std::uint8_t> readBlocks(std::uint64_t first, std::uint64_t count) const;
+
+        // Clair de [offset, offset + length), tronqué à la fin du fichier.
+        std::vector<std::uint8_t> read(std::uint64_t offset, std::size_t length) const;
+
+        // Déchiffre tout vers `out` (écrit dans `out`.part puis renomme), les blocs
+        // étant répartis sur le TaskScheduler partagé (au plus `threads`
+        // participants, 0 = un par cœur).
+        void decryptTo(const std::string &out, unsigned threads = 0) const;
+
+    private:
+        // Déchiffre le bloc `index` dans `out` ; renvoie sa longueur en clair.
+        std::size_t decryptBlock(adastra::crypto::encryption::AESCipher &cipher, std::uint64_t index,
+                                 std::vector<std::uint8_t> &record, std::uint8_t *out) const;
+
+        adastra::storage::filesystem::MappedFile file_;
+        adastra::crypto::encryption::ContainerHeader header_;
+        std::array<std::uint8_t, adastra::crypto::encryption::AESCipher::kKeySize> key_;
+        std::uint64_t blockCount_ = 0;
+        std::uint64_t plaintextSize_ = 0;
+    };
+}
+
+#endif // FILE_DECRYPTOR_HPP
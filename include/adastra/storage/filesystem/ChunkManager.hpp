@@ -0,0 +1,95 @@
+#ifndef CHUNK_MANAGER_HPP
+#define CHUNK_MANAGER_HPP
+
+#include <adastra/storage/filesystem/ChunkStore.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace adastra::storage::filesystem
+{
+    // Tailles de chunk (octets) du découpage par contenu. avgSize doit être une
+    // puissance de deux, minSize <= avgSize <= maxSize.
+    struct ChunkingOptions
+    {
+        std::size_t minSize = 4 * 1024;
+        std::size_t avgSize = 16 * 1024;
+        std::size_t maxSize = 64 * 1024;
+    };
+
+    struct ChunkRef
+    {
+        Digest hash{};
+        std::uint32_t length = 0;
+    };
+
+    // Recette d'un contenu : la liste ordonnée de ses chunks dans le ChunkStore.
+    struct ChunkRecipe
+    {
+        std::uint64_t size = 0;
+        std::vector<ChunkRef> chunks;
+
+        nlohmann::json toJson() const;
+        static ChunkRecipe fromJson(const nlohmann::json &j); // lance si invalide
+    };
+
+    // Découpage FastCDC : gear hash roulant (table de 256 valeurs 64 bits) et
+    // chunking normalisé (masque plus strict avant avgSize, plus lâche après).
+    // Les frontières ne dépendent que du contenu : insérer quelques octets ne
+    // déplace que les chunks voisins.
+    class ContentDefinedChunker
+    {
+    public:
+        explicit ContentDefinedChunker(ChunkingOptions options = {});
+
+        // Longueur du prochain chunk au début de `data` (<= maxSize).
+        std::size_t cut(std::span<const std::uint8_t> data) const;
+
+        // Longueurs de tous les chunks de `data`.
+        std::vector<std::size_t> split(std::span<const std::uint8_t> data) const;
+
+        const ChunkingOptions &options() const { return options_; }
+
+    private:
+        ChunkingOptions options_;
+        std::uint64_t maskS_;   // avant avgSize (plus de bits)
+        std::uint64_t maskL_;   // après avgSize (moins de bits)
+        std::uint64_t maskS2_;  // maskS_ << 1, pour le pas de deux octets
+        std::uint64_t maskL2_;
+    };
+
+    struct StoreStats
+    {
+        std::size_t chunks = 0;
+        std::size_t chunksWritten = 0;
+        std::uint64_t bytesWritten = 0;
+        std::uint64_t bytesReused = 0;
+    };
+
+    // Découpe un contenu, écrit dans le ChunkStore les seuls chunks qu'il ne
+    // connaît pas encore et renvoie la recette pour le reconstituer.
+    class ChunkManager
+    {
+    public:
+        explicit ChunkManager(ChunkStore &store, ChunkingOptions options = {});
+
+        ChunkRecipe store(std::span<const std::uint8_t> data, StoreStats *stats = nullptr);
+        ChunkRecipe storeFile(const std::string &path, StoreStats *stats = nullptr);
+
+        // Lance std::runtime_error si un chunk manque ou est corrompu.
+        std::vector<std::uint8_t> assemble(const ChunkRecipe &recipe) const;
+
+        const ContentDefinedChunker &chunker() const { return chunker_; }
+
+    private:
+        ChunkStore &store_;
+        ContentDefinedChunker chunker_;
+    };
+}
+
+#endif // CHUNK_MANAGER_HPP
@@ -0,0 +1,71 @@
+#ifndef CHUNK_STORE_HPP
+#define CHUNK_STORE_HPP
+
+#include <adastra/storage/filesystem/FileHasher.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace adastra::storage::filesystem
+{
+    struct DigestHash
+    {
+        std::size_t operator()(const Digest &d) const noexcept
+        {
+            // Les octets d'un SHA-256 sont déjà uniformes.
+            std::size_t h;
+            static_assert(sizeof(h) <= sizeof(Digest));
+            std::memcpy(&h, d.data(), sizeof(h));
+            return h;
+        }
+    };
+
+    // Chunks adressés par leur SHA-256 : <root>/objects/ab/cdef....
+    // Un chunk intact n'est jamais réécrit ; l'écriture passe par un fichier
+    // temporaire synchronisé puis renommé, un lecteur ne voit jamais de chunk
+    // partiel et un chunk renommé survit à un crash.
+    class ChunkStore
+    {
+    public:
+        // Crée le répertoire si besoin et indexe les chunks existants. Avec
+        // `verify`, chaque chunk est relu et haché : ceux qui ne correspondent
+        // plus à leur nom sont supprimés (et réécrits au prochain put()).
+        explicit ChunkStore(std::string root, bool verify = false);
+
+        // true si le chunk a été écrit, false s'il existait déjà. Un chunk présent
+        // dont la taille sur disque ne correspond pas à `data` est réécrit.
+        bool put(const Digest &hash, std::span<const std::uint8_t> data);
+
+        bool contains(const Digest &hash) const;
+
+        // nullopt si absent ; lance si le contenu ne correspond plus au hash, après
+        // avoir retiré le chunk pour que le prochain put() le réécrive.
+        std::optional<std::vector<std::uint8_t>> get(const Digest &hash) const;
+
+        // Taille du chunk, 0 s'il est absent.
+        std::uint64_t sizeOf(const Digest &hash) const;
+
+        std::size_t chunkCount() const;
+        std::uint64_t totalBytes() const;
+
+        const std::string &root() const { return root_; }
+
+    private:
+        std::string pathOf(const Digest &hash) const;
+        void forget(const Digest &hash) const; // retire un chunk corrompu (fichier et index)
+
+        std::string root_;
+        mutable std::mutex mutex_;
+        // mutable : get() retire les chunks corrompus qu'il découvre.
+        mutable std::unordered_map<Digest, std::uint64_t, DigestHash> sizes_;
+        mutable std::uint64_t totalBytes_ = 0;
+    };
+}
+
+#endif // CHUNK_STORE_HPP
@@ -0,0 +1,68 @@
+#ifndef FILE_HASHER_HPP
+#define FILE_HASHER_HPP
+
+#include <adastra/crypto/hash/SHA256Hasher.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace adastra::storage::filesystem
+{
+    using Digest = adastra::crypto::hash::SHA256Hasher::Digest;
+
+    struct FileHashOptions
+    {
+        std::size_t chunkSize = 4 * 1024 * 1024;
+        unsigned threads = 0;  // participants max sur le TaskScheduler partagé, 0 = un par cœur
+        bool useMmap = true;   // sinon pread, un tampon par tâche
+    };
+
+    // Empreinte d'un fichier : SHA-256 de chaque chunk + racine de l'arbre de Merkle.
+    //   feuille = SHA-256(0x00 || chunk)
+    //   nœud    = SHA-256(0x01 || gauche || droite), un nœud impair remonte tel quel
+    struct FileDigest
+    {
+        std::uint64_t fileSize = 0;
+        std::size_t chunkSize = 0;
+        std::vector<Digest> chunks;
+        Digest root{};
+
+        std::string rootHex() const;
+
+        // Octets couverts par le chunk i.
+        std::uint64_t chunkOffset(std::size_t i) const { return static_cast<std::uint64_t>(i) * chunkSize; }
+    };
+
+    // Hache les gros fichiers chunk par chunk, les chunks étant répartis sur le
+    // TaskScheduler partagé. Le fichier est projeté en mémoire quand c'est possible.
+    class FileHasher
+    {
+    public:
+        explicit FileHasher(FileHashOptions options = {});
+
+        // Lance std::runtime_error si le fichier est illisible.
+        FileDigest hash(const std::string &path) const;
+
+        // Re-hache uniquement `chunks` (tous si vide) et renvoie les indices qui
+        // ne correspondent plus à `expected`. Si la taille a changé, les chunks
+        // ajoutés ou disparus sont aussi signalés.
+        std::vector<std::size_t> verify(const std::string &path, const FileDigest &expected,
+                                        std::span<const std::size_t> chunks = {}) const;
+
+        // Met à jour `digest` après modification des `chunks` indiqués (la taille
+        // doit être inchangée, sinon tout est recalculé), racine comprise.
+        void refresh(const std::string &path, FileDigest &digest, std::span<const std::size_t> chunks) const;
+
+        static Digest merkleRoot(std::span<const Digest> leaves);
+
+        const FileHashOptions &options() const { return options_; }
+
+    private:
+        FileHashOptions options_;
+    };
+}
+
+#endif // FILE_HASHER_HPP
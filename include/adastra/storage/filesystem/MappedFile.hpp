@@ -0,0 +1,45 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adastra::storage::filesystem
+{
+    // Fichier ouvert en lecture seule, projeté en mémoire si possible (mmap).
+    // Si la projection échoue (fichier spécial, système sans mmap, ...),
+    // data() est nul et read() retombe sur pread. read() fonctionne dans les
+    // deux cas et peut être appelé depuis plusieurs threads.
+    class MappedFile
+    {
+    public:
+        // Lance std::runtime_error si le fichier ne peut pas être ouvert.
+        explicit MappedFile(const std::string &path, bool map = true);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        const std::string &path() const { return path_; }
+        std::uint64_t size() const { return size_; }
+
+        // Contenu projeté, ou nullptr (voir read()).
+        const std::uint8_t *data() const { return data_; }
+        bool mapped() const { return data_ != nullptr; }
+
+        // Copie [offset, offset + length) dans `out` ; lance si la lecture est courte.
+        void read(std::uint64_t offset, void *out, std::size_t length) const;
+
+        // Indique au noyau que [offset, offset + length) sera lu bientôt.
+        void prefetch(std::uint64_t offset, std::size_t length) const;
+
+    private:
+        std::string path_;
+        int fd_ = -1;
+        std::uint64_t size_ = 0;
+        std::uint8_t *data_ = nullptr;
+    };
+}
+
+#endif // MAPPED_FILE_HPP
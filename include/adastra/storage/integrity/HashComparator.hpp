@@ -0,0 +1,26 @@
+#ifndef HASH_COMPARATOR_HPP
+#define HASH_COMPARATOR_HPP
+
+#include <adastra/storage/filesystem/ChunkManager.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace adastra::storage::integrity
+{
+    using adastra::storage::filesystem::ChunkRecipe;
+    using adastra::storage::filesystem::Digest;
+
+    class HashComparator
+    {
+    public:
+        // Comparaison en temps constant.
+        static bool equal(const Digest &a, const Digest &b);
+
+        // Indices des chunks de `after` absents de `before` : ce qu'il faut
+        // transférer ou re-vérifier pour passer de l'un à l'autre.
+        static std::vector<std::size_t> changedChunks(const ChunkRecipe &before, const ChunkRecipe &after);
+    };
+}
+
+#endif // HASH_COMPARATOR_HPP
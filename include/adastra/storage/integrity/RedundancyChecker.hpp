@@ -0,0 +1,49 @@
+#ifndef REDUNDANCY_CHECKER_HPP
+#define REDUNDANCY_CHECKER_HPP
+
+#include <adastra/storage/filesystem/ChunkManager.hpp>
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+namespace adastra::storage::integrity
+{
+    struct RedundancyReport
+    {
+        std::uint64_t logicalBytes = 0; // somme des contenus
+        std::uint64_t uniqueBytes = 0;  // octets réellement stockés
+        std::size_t chunks = 0;
+        std::size_t uniqueChunks = 0;
+
+        // logique / unique (1.0 = aucune déduplication).
+        double ratio() const { return uniqueBytes ? static_cast<double>(logicalBytes) / uniqueBytes : 1.0; }
+        double savedFraction() const { return logicalBytes ? 1.0 - static_cast<double>(uniqueBytes) / logicalBytes : 0.0; }
+
+        nlohmann::json toJson() const;
+    };
+
+    // Mesure la déduplication d'un ensemble de contenus : recettes déjà
+    // stockées, ou données brutes découpées à blanc (sans rien écrire).
+    class RedundancyChecker
+    {
+    public:
+        explicit RedundancyChecker(adastra::storage::filesystem::ChunkingOptions options = {});
+
+        void add(const adastra::storage::filesystem::ChunkRecipe &recipe);
+        void add(std::span<const std::uint8_t> data);
+
+        RedundancyReport report() const { return report_; }
+
+    private:
+        adastra::storage::filesystem::ContentDefinedChunker chunker_;
+        std::unordered_map<adastra::storage::filesystem::Digest, std::uint32_t,
+                           adastra::storage::filesystem::DigestHash>
+            seen_; // hash -> nombre de références
+        RedundancyReport report_;
+    };
+}
+
+#endif // REDUNDANCY_CHECKER_HPP
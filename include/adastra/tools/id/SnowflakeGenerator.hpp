@@ -0,0 +1,62 @@
+#ifndef SNOWFLAKE_GENERATOR_HPP
+#define SNOWFLAKE_GENERATOR_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace adastra::tools::id
+{
+    // Identifiants 64 bits ordonnés dans le temps :
+    //   [ 41 bits ms depuis kEpochMs | 10 bits nœud | 12 bits séquence ]
+    //
+    // Sans verrou : l'état (ms << 12 | séquence) tient dans un seul atomique.
+    // Si l'horloge recule ou si les 4096 séquences d'une ms sont épuisées, le
+    // générateur avance sur sa propre horloge logique (ms suivante) au lieu
+    // d'attendre ; il se recale dès que l'horloge murale le rattrape.
+    class SnowflakeGenerator
+    {
+    public:
+        static constexpr std::uint64_t kEpochMs = 1735689600000ULL; // 2025-01-01T00:00:00Z
+        static constexpr unsigned kNodeBits = 10;
+        static constexpr unsigned kSequenceBits = 12;
+        static constexpr std::uint16_t kMaxNodeId = (1u << kNodeBits) - 1;
+        static constexpr std::uint32_t kMaxSequence = (1u << kSequenceBits) - 1;
+
+        // Nombre de séquences réservées d'un coup par nextLocal().
+        static constexpr std::uint32_t kBlockSize = 64;
+
+        explicit SnowflakeGenerator(std::uint16_t nodeId = 0);
+
+        SnowflakeGenerator(const SnowflakeGenerator &) = delete;
+        SnowflakeGenerator &operator=(const SnowflakeGenerator &) = delete;
+
+        // Un id strictement croissant pour ce générateur : une lecture d'horloge + un CAS.
+        std::uint64_t next();
+
+        // Chemin rapide pour les créations en masse : chaque thread réserve un bloc
+        // de kBlockSize séquences (un CAS) puis le consomme sans état partagé.
+        // Les ids restent uniques et croissants par thread ; entre threads ils sont
+        // ordonnés à quelques ms près (horloge grossière).
+        std::uint64_t nextLocal();
+
+        std::uint16_t nodeId() const { return nodeId_; }
+
+        static std::uint64_t timestampMs(std::uint64_t id) { return (id >> (kNodeBits + kSequenceBits)) + kEpochMs; }
+        static std::uint16_t nodeOf(std::uint64_t id) { return static_cast<std::uint16_t>((id >> kSequenceBits) & kMaxNodeId); }
+
+        // Générateur partagé du processus ; nœud lu dans SA_NODE_ID (0 par défaut,
+        // std::invalid_argument si la valeur n'est pas un entier de 0 à kMaxNodeId).
+        static SnowflakeGenerator &shared();
+
+    private:
+        // Réserve `count` valeurs logiques consécutives, renvoie la première.
+        std::uint64_t reserve(std::uint64_t nowMs, std::uint32_t count);
+        std::uint64_t compose(std::uint64_t logical) const;
+
+        std::uint16_t nodeId_;
+        std::uint64_t instance_; // distingue les générateurs dans le cache par thread
+        alignas(64) std::atomic<std::uint64_t> state_{0}; // dernière valeur émise : (ms - kEpochMs) << 12 | séquence
+    };
+}
+
+#endif // SNOWFLAKE_GENERATOR_HPP
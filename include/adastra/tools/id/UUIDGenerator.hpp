@@ -0,0 +1,50 @@
+#ifndef UUID_GENERATOR_HPP
+#define UUID_GENERATOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace adastra::tools::id
+{
+    using Uuid = std::array<std::uint8_t, 16>;
+
+    // UUID v4 (aléatoire) et v7 (RFC 9562, ordonné dans le temps), tirés du pool
+    // RandomBytes par thread : pas d'appel système ni de verrou par UUID.
+    class UUIDGenerator
+    {
+    public:
+        static constexpr std::size_t kTextSize = 36;
+
+        static Uuid v4();
+
+        // [ 48 bits epoch ms | ver | 12 bits fraction de ms | var | 62 bits aléatoires ]
+        // La fraction de ms (méthode 3 de la RFC) ordonne les UUID à ~250 ns près.
+        static Uuid v7();
+
+        // Remplit `out` en un seul tirage aléatoire et une seule lecture d'horloge ;
+        // le lot est trié, donc croissant.
+        static void v7(std::span<Uuid> out);
+
+        // Forme canonique minuscule 8-4-4-4-12, sans allocation. `out` doit
+        // pouvoir recevoir kTextSize caractères (pas de '\0').
+        static void format(const Uuid &uuid, char *out);
+        static std::array<char, kTextSize> toChars(const Uuid &uuid);
+        static std::string toString(const Uuid &uuid);
+
+        static std::string v4String() { return toString(v4()); }
+        static std::string v7String() { return toString(v7()); }
+
+        // Accepte majuscules et minuscules ; false si le texte n'est pas un UUID.
+        static bool parse(std::string_view text, Uuid &out);
+
+        static unsigned version(const Uuid &uuid) { return uuid[6] >> 4; }
+
+        // Horodatage (epoch ms) d'un UUID v7.
+        static std::uint64_t timestampMs(const Uuid &uuid);
+    };
+}
+
+#endif // UUID_GENERATOR_HPP
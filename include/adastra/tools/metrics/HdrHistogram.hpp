@@ -0,0 +1,52 @@
+#ifndef HDR_HISTOGRAM_HPP
+#define HDR_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace adastra::tools::metrics
+{
+    // Histogramme à plage dynamique (HDR) : précision relative constante
+    // (`significantDigits` chiffres) de 1 à `highestTrackable`, mémoire fixe.
+    // Non synchronisé : un histogramme par thread, puis merge().
+    class HdrHistogram
+    {
+    public:
+        // highestTrackable <= 2^62, sinon std::invalid_argument.
+        explicit HdrHistogram(std::uint64_t highestTrackable = 60'000'000, int significantDigits = 3);
+
+        // Les valeurs hors plage sont ramenées dans [0, highestTrackable].
+        void record(std::uint64_t value, std::uint64_t count = 1);
+
+        // Ajoute les comptes de `other` (même configuration requise).
+        void merge(const HdrHistogram &other);
+
+        void reset();
+
+        std::uint64_t count() const { return total_; }
+        std::uint64_t min() const { return total_ ? min_ : 0; }
+        std::uint64_t max() const { return max_; }
+        double mean() const;
+
+        // Plus petite valeur v telle qu'au moins `percentile` % des valeurs sont <= v
+        // (à la précision du seau près).
+        std::uint64_t valueAtPercentile(double percentile) const;
+
+    private:
+        std::size_t indexOf(std::uint64_t value) const;
+        std::uint64_t highestEquivalent(std::size_t index) const;
+
+        std::uint64_t highest_;
+        unsigned subBucketHalfCountMagnitude_;
+        std::uint64_t subBucketHalfCount_;
+        std::uint64_t subBucketMask_;
+        std::vector<std::uint64_t> counts_;
+
+        std::uint64_t total_ = 0;
+        std::uint64_t min_ = UINT64_MAX;
+        std::uint64_t max_ = 0;
+        long double sum_ = 0;
+    };
+}
+
+#endif // HDR_HISTOGRAM_HPP
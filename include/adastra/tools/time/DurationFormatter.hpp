@@ -0,0 +1,14 @@
+#ifndef DURATION_FORMATTER_HPP
+#define DURATION_FORMATTER_HPP
+
+#include <chrono>
+#include <string>
+
+namespace adastra::tools::time
+{
+    // Durée lisible pour les logs et rapports, trois chiffres significatifs :
+    // "850 ns", "12.4 us", "3.21 ms", "4.50 s", "2m05s", "1h02m".
+    std::string formatDuration(std::chrono::nanoseconds d);
+}
+
+#endif // DURATION_FORMATTER_HPP
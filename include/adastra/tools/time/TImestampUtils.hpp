@@ -0,0 +1,48 @@
+#ifndef TIMESTAMP_UTILS_HPP
+#define TIMESTAMP_UTILS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace adastra::tools::time
+{
+    // Horloge murale grossière (CLOCK_REALTIME_COARSE, résolution de l'ordre
+    // du tick noyau, 1 à 4 ms) : lue dans le vDSO sans appel système. Suffit
+    // pour horodater, expirer ou dater une réponse ; pas pour mesurer.
+    std::int64_t coarseNowMs();
+    inline std::int64_t coarseNowSeconds() { return coarseNowMs() / 1000; }
+
+    // Jours depuis 1970-01-01 d'une date du calendrier grégorien (proleptique).
+    constexpr std::int64_t daysFromCivil(std::int64_t y, unsigned m, unsigned d)
+    {
+        y -= m <= 2;
+        const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(y - era * 400);
+        const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+    }
+
+    // "YYYY-MM-DD HH:MM:SS" ou "YYYY-MM-DDTHH:MM:SS", suivi éventuellement de
+    // "Z" : heure UTC -> secondes epoch. Format fixe, sans locale ni
+    // std::get_time ; nullopt si un champ sort de sa plage.
+    std::optional<std::int64_t> parseDateTime(std::string_view text);
+
+    // Tailles exactes des formats ci-dessous (sans zéro final).
+    constexpr std::size_t kDateTimeSize = 19; // 2025-06-27 11:47:26
+    constexpr std::size_t kIso8601Size = 20;  // 2025-06-27T11:47:26Z
+    constexpr std::size_t kHttpDateSize = 29; // Fri, 27 Jun 2025 11:47:26 GMT
+
+    // Écrivent exactement k*Size caractères dans `out`.
+    void formatDateTime(std::int64_t epochSeconds, char *out, char separator = ' ');
+    void formatIso8601(std::int64_t epochSeconds, char *out);
+    void formatHttpDate(std::int64_t epochSeconds, char *out); // RFC 9110 IMF-fixdate
+
+    std::string toDateTime(std::int64_t epochSeconds);
+    std::string toIso8601(std::int64_t epochSeconds);
+}
+
+#endif // TIMESTAMP_UTILS_HPP
@@ -0,0 +1,21 @@
+#ifndef TIME_HELPER_HPP
+#define TIME_HELPER_HPP
+
+#include <adastra/tools/time/TImestampUtils.hpp>
+#include <adastra/tools/time/DurationFormatter.hpp>
+
+#include <string_view>
+
+namespace adastra::tools::time
+{
+    // Instant courant déjà formaté, pour les en-têtes et les logs. Chaque thread
+    // garde sa copie et ne la reformate qu'au changement de seconde (horloge
+    // grossière) : pas de verrou, pas de strftime par requête.
+    //
+    // La vue reste valide jusqu'au prochain appel de la même fonction dans le
+    // même thread.
+    std::string_view httpDateNow(); // Fri, 27 Jun 2025 11:47:26 GMT
+    std::string_view iso8601Now();  // 2025-06-27T11:47:26Z
+}
+
+#endif // TIME_HELPER_HPP
@@ -0,0 +1,165 @@
+#ifndef TIMING_WHEEL_HPP
+#define TIMING_WHEEL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace adastra::tools::time
+{
+    // 0 = aucun minuteur (capacité atteinte, ou arrêt en cours).
+    using TimerId = std::uint64_t;
+    using TimerKind = std::uint16_t;
+
+    struct TimingWheelOptions
+    {
+        // Résolution : une échéance n'est jamais servie en avance, au plus ~1 tick en retard.
+        std::chrono::milliseconds tick{10};
+        // Threads qui exécutent les handlers ; 0 = sur le thread du ticker.
+        unsigned workers = 2;
+        // Payloads par appel de handler.
+        std::size_t batchSize = 1024;
+        // Minuteurs en attente au-delà desquels schedule() refuse.
+        std::size_t maxTimers = std::size_t{1} << 26;
+    };
+
+    struct TimingWheelStats
+    {
+        std::size_t pending = 0;
+        std::size_t capacity = 0;       // nœuds alloués (actifs + libres)
+        std::size_t bytesPerTimer = 0;
+        std::size_t queuedBatches = 0;  // lots en attente d'un worker
+
+        std::uint64_t scheduled = 0;
+        std::uint64_t cancelled = 0;
+        std::uint64_t expired = 0;
+        std::uint64_t batches = 0;
+        std::uint64_t rejected = 0;
+        std::uint64_t cascaded = 0;     // ré-insertions depuis les niveaux supérieurs
+    };
+
+    // Roue temporelle hiérarchique (4 niveaux de 256 cases, 2^32 ticks, soit
+    // ~497 jours à 10 ms) pour les TTL, réservations, sessions et fenêtres de
+    // débit. schedule() / cancel() / reschedule() sont en O(1) ; un seul thread
+    // fait avancer la roue et les échéances sont remises par lots aux handlers.
+    //
+    // Un minuteur ne porte pas de closure : seulement un payload de 64 bits
+    // (id de panier, de session...) et le TimerKind de son handler, soit 32
+    // octets par minuteur dans un tableau contigu, sans allocation par minuteur
+    // une fois la capacité atteinte.
+    //
+    // Un handler peut être appelé après cancel() si l'échéance était déjà
+    // collectée : il doit rester idempotent (revérifier l'état de l'objet).
+    class TimingWheel
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Handler = std::function<void(std::span<const std::uint64_t> payloads)>;
+
+        explicit TimingWheel(TimingWheelOptions options = {});
+        ~TimingWheel(); // les minuteurs en attente sont abandonnés, les lots déjà collectés servis
+
+        TimingWheel(const TimingWheel &) = delete;
+        TimingWheel &operator=(const TimingWheel &) = delete;
+
+        // Enregistre un handler ; à faire avant de planifier des minuteurs de ce type.
+        TimerKind addHandler(Handler handler);
+
+        // Échéance dans `delay` (arrondi au tick supérieur, plafonné à 2^32 - 1 ticks).
+        TimerId schedule(TimerKind kind, std::uint64_t payload, Clock::duration delay);
+
+        // false si le minuteur a déjà expiré, a été annulé ou n'existe pas.
+        bool cancel(TimerId id);
+
+        // Repousse (ou avance) l'échéance, par ex. à chaque accès d'une session.
+        bool reschedule(TimerId id, Clock::duration delay);
+
+        TimingWheelStats stats() const;
+        const TimingWheelOptions &options() const { return options_; }
+
+    private:
+        static constexpr unsigned kSlotBits = 8;
+        static constexpr unsigned kLevels = 4;
+        static constexpr std::uint32_t kSlots = 1u << kSlotBits;
+        static constexpr std::uint32_t kSlotMask = kSlots - 1;
+        static constexpr std::uint64_t kMaxDelta = (std::uint64_t{1} << (kSlotBits * kLevels)) - 1;
+        static constexpr std::uint32_t kNil = 0xFFFFFFFFu;
+
+        // Les kLevels * kSlots premiers nœuds sont les sentinelles des cases :
+        // chaque case est une liste doublement chaînée circulaire d'indices,
+        // ce qui permet de retirer un minuteur sans savoir où il se trouve.
+        struct Node
+        {
+            std::uint64_t payload;
+            std::uint64_t deadline; // en ticks depuis start_
+            std::uint32_t next;
+            std::uint32_t prev;
+            std::uint32_t generation;
+            TimerKind kind;
+            std::uint16_t live;
+        };
+
+        struct Batch
+        {
+            std::shared_ptr<const Handler> handler;
+            std::vector<std::uint64_t> payloads;
+        };
+
+        std::uint64_t ticksUntil(Clock::duration delay) const;
+        std::uint32_t allocate();
+        void release(std::uint32_t index);
+        void link(std::uint32_t index);   // place le nœud selon deadline et base_
+        void unlink(std::uint32_t index);
+        std::uint32_t lookup(TimerId id) const; // kNil si périmé
+        bool cascade(unsigned level);     // true si la case traitée est la 0
+        void expireSlot();
+        void advance(std::uint64_t target);
+        std::uint64_t nextWakeTick() const;
+        void collectBatches(std::vector<Batch> &out);
+        void dispatch(std::vector<Batch> &batches);
+        static void runBatch(const Batch &batch);
+
+        void tickerLoop();
+        void workerLoop();
+
+        TimingWheelOptions options_;
+        std::uint64_t tickNs_;
+        Clock::time_point start_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable tickerCv_;
+        std::vector<Node> nodes_;
+        std::uint32_t freeHead_ = kNil;
+        std::uint64_t base_ = 0;     // prochain tick à traiter
+        std::uint64_t wakeTick_ = 0; // réveil prévu du ticker ; 0 pendant un dispatch
+        std::size_t pending_ = 0;
+        std::vector<std::shared_ptr<const Handler>> handlers_;
+        std::vector<std::vector<std::uint64_t>> expiredByKind_;
+        bool stopping_ = false;
+
+        std::uint64_t scheduled_ = 0;
+        std::uint64_t cancelled_ = 0;
+        std::uint64_t expired_ = 0;
+        std::uint64_t batches_ = 0;
+        std::uint64_t rejected_ = 0;
+        std::uint64_t cascaded_ = 0;
+
+        mutable std::mutex queueMutex_;
+        std::condition_variable queueCv_;
+        std::deque<Batch> queue_;
+        bool draining_ = false;
+
+        std::vector<std::thread> workers_;
+        std::thread ticker_;
+    };
+}
+
+#endif // TIMING_WHEEL_HPP
@@ -0,0 +1,60 @@
+#ifndef BINARY_WRITER_HPP
+#define BINARY_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace adastra::utils::json
+{
+    // Écriture directe MessagePack / CBOR dans un tampon, sans passer par un DOM.
+    // Les deux écrivains ont la même interface : le code d'encodage d'un objet
+    // peut être écrit une fois en template pour les deux formats.
+    class MsgPackWriter
+    {
+    public:
+        explicit MsgPackWriter(std::string &out) : out_(out) {}
+
+        void map(std::size_t size);
+        void array(std::size_t size);
+        void string(std::string_view value);
+        void uint(std::uint64_t value);
+        void float32(float value);
+        void boolean(bool value);
+        void null();
+
+        // Valeur déjà encodée dans ce format (ex. encode(..., Encoding::MsgPack)).
+        void raw(std::string_view encoded) { out_.append(encoded); }
+
+    private:
+        void header(std::uint8_t fix, std::uint8_t fixMax, std::uint8_t b16, std::uint8_t b32, std::size_t size);
+        void be(std::uint64_t value, int bytes);
+
+        std::string &out_;
+    };
+
+    class CborWriter
+    {
+    public:
+        explicit CborWriter(std::string &out) : out_(out) {}
+
+        void map(std::size_t size) { head(5, size); }
+        void array(std::size_t size) { head(4, size); }
+        void string(std::string_view value);
+        void uint(std::uint64_t value) { head(0, value); }
+        void float32(float value);
+        void boolean(bool value) { out_.push_back(static_cast<char>(value ? 0xf5 : 0xf4)); }
+        void null() { out_.push_back(static_cast<char>(0xf6)); }
+
+        void raw(std::string_view encoded) { out_.append(encoded); }
+
+    private:
+        void head(std::uint8_t major, std::uint64_t value);
+        void be(std::uint64_t value, int bytes);
+
+        std::string &out_;
+    };
+}
+
+#endif // BINARY_WRITER_HPP
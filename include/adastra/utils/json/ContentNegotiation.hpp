@@ -0,0 +1,40 @@
+#ifndef CONTENT_NEGOTIATION_HPP
+#define CONTENT_NEGOTIATION_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace adastra::utils::json
+{
+    // Encodages de réponse proposés aux clients.
+    enum class Encoding
+    {
+        Json,
+        MsgPack,
+        Cbor
+    };
+
+    // Choisit l'encodage d'après l'en-tête Accept (q-values respectées).
+    // JSON par défaut : en-tête absent, */* ou aucun type reconnu.
+    Encoding negotiate(std::string_view accept);
+
+    const char *contentType(Encoding encoding);
+
+    // Sérialise un DOM dans l'encodage demandé.
+    std::string encode(const nlohmann::json &value, Encoding encoding);
+
+    // {"count":n,"data":[item.toJson(), ...]} dans l'encodage demandé.
+    template <typename T>
+    std::string encodeList(const std::vector<T> &items, Encoding encoding)
+    {
+        nlohmann::json data = nlohmann::json::array();
+        for (const auto &item : items)
+            data.push_back(item.toJson());
+        return encode({{"count", items.size()}, {"data", std::move(data)}}, encoding);
+    }
+}
+
+#endif // CONTENT_NEGOTIATION_HPP
@@ -0,0 +1,33 @@
+#ifndef ENCODED_BODY_CACHE_HPP
+#define ENCODED_BODY_CACHE_HPP
+
+#include <adastra/utils/json/ContentNegotiation.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace adastra::utils::json
+{
+    // Corps de réponse encodés une fois par version de données et par encodage.
+    // Un changement de version invalide les trois encodages.
+    class EncodedBodyCache
+    {
+    public:
+        using Body = std::shared_ptr<const std::string>;
+        using Builder = std::function<std::string(Encoding)>;
+
+        Body get(std::uint64_t version, Encoding encoding, const Builder &build);
+
+    private:
+        std::mutex mutex_;
+        bool hasVersion_ = false;
+        std::uint64_t version_ = 0;
+        std::array<Body, 3> bodies_;
+    };
+}
+
+#endif // ENCODED_BODY_CACHE_HPP
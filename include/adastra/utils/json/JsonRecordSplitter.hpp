@@ -0,0 +1,18 @@
+#ifndef JSON_RECORD_SPLITTER_HPP
+#define JSON_RECORD_SPLITTER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace adastra::utils::json
+{
+    // Découpe un corps contenant plusieurs enregistrements JSON sans construire de DOM :
+    //   - un tableau JSON   : [ {...}, {...} ]
+    //   - du NDJSON         : un enregistrement par ligne (lignes vides ignorées)
+    // Chaque vue pointe dans `body` et peut ensuite être parsée indépendamment.
+    // Retourne false (et renseigne `error`) si le tableau est mal formé.
+    bool splitJsonRecords(std::string_view body, std::vector<std::string_view> &out, std::string &error);
+}
+
+#endif // JSON_RECORD_SPLITTER_HPP
@@ -0,0 +1,30 @@
+#ifndef BASE64_HPP
+#define BASE64_HPP
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace adastra::utils::string
+{
+    // Base64url sans padding (RFC 4648 §5), le format des segments JWT.
+    std::string base64UrlEncode(std::span<const std::uint8_t> bytes);
+    inline std::string base64UrlEncode(std::string_view bytes)
+    {
+        return base64UrlEncode({reinterpret_cast<const std::uint8_t *>(bytes.data()), bytes.size()});
+    }
+
+    // Décode `in` dans `out` (remplacé). false si un caractère sort de
+    // l'alphabet, si du padding est présent ou si la longueur est impossible
+    // (reste de 1 modulo 4) ; `out` est alors indéterminé.
+    bool base64UrlDecode(std::string_view in, std::string &out);
+
+    // Taille décodée de `in`, sans le valider.
+    constexpr std::size_t base64UrlDecodedSize(std::size_t encoded)
+    {
+        return encoded / 4 * 3 + (encoded % 4 == 0 ? 0 : encoded % 4 - 1);
+    }
+}
+
+#endif // BASE64_HPP
@@ -0,0 +1,95 @@
+#ifndef JSON_SCHEMA_HPP
+#define JSON_SCHEMA_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace adastra::utils::validation
+{
+    struct FieldError
+    {
+        std::string field;
+        std::string message;
+    };
+
+    // Matchers écrits à la main (pas de std::regex).
+    // Équivalent de ^[^@\s]+@[^@\s]+\.[^@\s]+$
+    bool isEmail(std::string_view value);
+
+    // Entier JSON, flottant sans partie décimale ou chaîne "[+-]chiffres".
+    bool integerValue(const nlohmann::json &value, long long &out);
+
+    // Nombre JSON fini ou chaîne décimale complète ("12.5").
+    bool numberValue(const nlohmann::json &value, double &out);
+
+    // Schéma de validation construit une fois (à l'enregistrement de la route)
+    // puis appliqué directement au JSON parsé de chaque requête.
+    //
+    //     JsonSchema schema;
+    //     schema.field("email").required().email("Invalid email");
+    //     schema.field("age").integer(1, 150, "Age");
+    class JsonSchema
+    {
+    public:
+        class Field
+        {
+        public:
+            explicit Field(std::string name) : name_(std::move(name)), label_(name_) {}
+
+            Field &required()
+            {
+                required_ = true;
+                return *this;
+            }
+
+            // Chaîne de longueur [minLength, maxLength] octets.
+            Field &string(std::size_t minLength = 0, std::size_t maxLength = SIZE_MAX);
+            Field &email(std::string message = "Invalid email");
+            Field &integer(long long min, long long max, std::string label = {});
+            Field &number(double min, double max, std::string label = {});
+
+        private:
+            friend class JsonSchema;
+
+            enum class Kind
+            {
+                Any,
+                String,
+                Email,
+                Integer,
+                Number
+            };
+
+            void check(const nlohmann::json *value, std::vector<FieldError> &errors) const;
+
+            std::string name_;
+            std::string label_;
+            std::string message_;
+            Kind kind_ = Kind::Any;
+            bool required_ = false;
+            std::size_t minLength_ = 0;
+            std::size_t maxLength_ = SIZE_MAX;
+            long long min_ = 0;
+            long long max_ = 0;
+            double minNumber_ = 0;
+            double maxNumber_ = 0;
+        };
+
+        // Les références restent valides quand d'autres champs sont ajoutés.
+        Field &field(std::string name);
+
+        // Erreurs dans l'ordre des champs du schéma ; vide si le corps est valide.
+        std::vector<FieldError> validate(const nlohmann::json &body) const;
+
+    private:
+        std::deque<Field> fields_;
+    };
+}
+
+#endif // JSON_SCHEMA_HPP
@@ -0,0 +1,18 @@
+#ifndef COMMERCE_MODULE_HPP
+#define COMMERCE_MODULE_HPP
+
+#include <vix.hpp>
+
+#include <string>
+
+namespace softadastra::commerce
+{
+    // Chemin d'un fichier de données : variable d'environnement `envKey`, sinon
+    // config/data/<defaultFile>. Les chemins relatifs partent de SA_BACKEND_ROOT.
+    std::string resolveDataPath(const std::string &envKey, const std::string &defaultFile);
+
+    // Enregistre les routes produits, catégories, tailles, couleurs et villes.
+    void CommerceModule(Vix::App &app);
+}
+
+#endif // COMMERCE_MODULE_HPP
@@ -6,6 +6,8 @@
 #include <cstdint>
 #include <optional>
 
+#include <adastra/tools/time/TImestampUtils.hpp>
+
 #include <vix/json/build.hpp>
 
 using json = nlohmann::json;
@@ -23,7 +25,7 @@ namespace softadastra::commerce::products
         Product &operator=(Product &&other) noexcept;
         virtual ~Product() = default;
 
-        uint32_t getId() const { return id; }
+        std::uint64_t getId() const { return id; }
         const std::string &getTitle() const { return title; }
         const std::string &getImageUrl() const { return image_url; }
         const std::string &getCityName() const { return city_name; }
@@ -44,13 +46,15 @@ namespace softadastra::commerce::products
         std::optional<uint32_t> getBrandId() const { return brand_id; }
         std::optional<std::string> getOriginalPrice() const { return original_price; }
         uint32_t getReviewCount() const { return review_count; }
+        // Date de création, secondes epoch UTC (0 si inconnue).
+        std::int64_t getCreatedAt() const { return created_at; }
         bool isBoosted() const { return boost; }
 
         const std::vector<std::uint32_t> &getSimilarProducts() const { return similar_products; }
         const std::vector<std::pair<std::string, std::string>> &getCustomFields() const { return custom_fields; }
         const std::vector<std::string> &getImages() const { return images; }
 
-        void setId(uint32_t value) { id = value; }
+        void setId(std::uint64_t value) { id = value; }
         void setTitle(const std::string &value) { title = value; }
         void setImageUrl(const std::string &value) { image_url = value; }
         void setCityName(const std::string &value) { city_name = value; }
@@ -71,6 +75,7 @@ namespace softadastra::commerce::products
         void setBrandId(std::optional<uint32_t> value) { brand_id = value; }
         void setOriginalPrice(std::optional<std::string> value) { original_price = value; }
         void setReviewCount(uint32_t value) { review_count = value; }
+        void setCreatedAt(std::int64_t value) { created_at = value; }
         void setBoost(bool value) { boost = value; }
 
         void setSimilarProducts(const std::vector<uint32_t> &value) { similar_products = value; }
@@ -79,10 +84,11 @@ namespace softadastra::commerce::products
 
         static Product fromJson(const nlohmann::json &j);
 
+        // L'id est exposé en chaîne : un Snowflake dépasse les entiers sûrs de JavaScript.
         Vix::json::Json toJson() const
         {
             nlohmann::json j;
-            j["id"] = id;
+            j["id"] = std::to_string(id);
             j["title"] = title;
             j["image_url"] = image_url;
             j["city_name"] = city_name;
@@ -118,6 +124,8 @@ namespace softadastra::commerce::products
                 j["views"] = views;
             if (review_count > 0)
                 j["review_count"] = review_count;
+            if (created_at != 0)
+                j["created_at"] = adastra::tools::time::toDateTime(created_at);
 
             j["boost"] = boost;
 
@@ -141,7 +149,7 @@ namespace softadastra::commerce::products
         }
 
     private:
-        std::uint32_t id;
+        std::uint64_t id;
         std::string title;
         std::string image_url;
         std::string city_name;
@@ -162,6 +170,7 @@ namespace softadastra::commerce::products
         std::uint32_t category_id;
         std::uint32_t views;
         std::uint32_t review_count;
+        std::int64_t created_at;
         bool boost;
 
         std::vector<std::uint32_t> similar_products;
@@ -169,7 +178,7 @@ namespace softadastra::commerce::products
         std::vector<std::string> images;
 
         Product() : id(0), converted_price_value(0), price_with_shipping_value(0),
-                    category_id(0), views(0), review_count(0), boost(false) {}
+                    category_id(0), views(0), review_count(0), created_at(0), boost(false) {}
 
         friend class ProductBuilder;
     };
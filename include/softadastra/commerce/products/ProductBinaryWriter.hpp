@@ -0,0 +1,15 @@
+#ifndef PRODUCT_BINARY_WRITER_HPP
+#define PRODUCT_BINARY_WRITER_HPP
+
+#include <softadastra/commerce/products/Product.hpp>
+#include <adastra/utils/json/BinaryWriter.hpp>
+
+namespace softadastra::commerce::products
+{
+    // Encode un Product en MessagePack / CBOR directement depuis ses champs, avec
+    // les mêmes clés et les mêmes champs optionnels que Product::toJson().
+    void writeProduct(adastra::utils::json::MsgPackWriter &w, const Product &p);
+    void writeProduct(adastra::utils::json::CborWriter &w, const Product &p);
+}
+
+#endif // PRODUCT_BINARY_WRITER_HPP
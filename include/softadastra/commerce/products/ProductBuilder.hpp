@@ -15,7 +15,7 @@ namespace softadastra::commerce::products
     public:
         ProductBuilder();
 
-        ProductBuilder &setId(uint32_t id);
+        ProductBuilder &setId(std::uint64_t id);
         ProductBuilder &setTitle(const std::string &title);
         ProductBuilder &setImageUrl(const std::string &imageUrl);
         ProductBuilder &setCityName(const std::string &cityName);
@@ -35,6 +35,7 @@ namespace softadastra::commerce::products
         ProductBuilder &setAverageRating(float rating);
         ProductBuilder &setReviewCount(uint32_t count);
         ProductBuilder &setBoost(bool boost);
+        ProductBuilder &setCreatedAt(std::int64_t epochSeconds);
         ProductBuilder &setOriginalPrice(const std::optional<std::string> &originalPrice);
         ProductBuilder &setBrandId(const std::optional<uint32_t> &brandId);
 
@@ -0,0 +1,75 @@
+#ifndef PRODUCT_CATALOG_HPP
+#define PRODUCT_CATALOG_HPP
+
+#include <softadastra/commerce/products/ProductCache.hpp>
+#include <softadastra/commerce/products/ProductChangeLog.hpp>
+#include <softadastra/commerce/products/ProductIngestLog.hpp>
+#include <softadastra/commerce/products/ProductRepository.hpp>
+#include <softadastra/commerce/products/ProductSnapshot.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    struct PublishReport
+    {
+        ProductSnapshotPtr snapshot; // snapshot courant après l'appel
+        std::size_t persisted = 0;   // produits écrits : les premiers de `added`
+        std::size_t batches = 0;     // lots écrits
+        std::string error;           // non vide si un lot n'a pas pu être écrit
+    };
+
+    // Publie les snapshots construits à partir du ProductCache et, s'il est fourni,
+    // du journal d'ingestion rejoué par-dessus. Chaque nouveau snapshot incrémente
+    // la version du catalogue et enregistre ses changements dans changes().
+    //
+    // Construit sur un ProductRepository, le catalogue lit et écrit le dépôt à la
+    // place du cache et du journal : avec LocalDBBackend, publish() n'écrit que les
+    // lignes du lot.
+    class ProductCatalog
+    {
+    public:
+        explicit ProductCatalog(ProductCache &cache, ProductIngestLog *log = nullptr);
+        // Lance std::invalid_argument si le backend du dépôt n'est pas incrémental.
+        explicit ProductCatalog(ProductRepository &store);
+
+        // Snapshot courant (construit au premier appel).
+        ProductSnapshotPtr snapshot();
+
+        // Reconstruit le snapshot depuis le cache (ou le dépôt), par ex. après ProductCache::reload().
+        // Les différences avec le snapshot précédent deviennent des upserts/deletes.
+        ProductSnapshotPtr refresh();
+
+        // Ajoute un lot : écrit d'abord dans le dépôt ou le journal (s'il y en a un), puis publie
+        // un seul nouveau snapshot = courant + `added`. Lance une exception si
+        // l'écriture échoue ; le snapshot courant reste alors inchangé.
+        ProductSnapshotPtr publish(std::vector<Product> added);
+
+        // Comme publish(), mais écrit `added` par lots de `batchSize` (un append ou
+        // une transaction chacun) et ne construit qu'un snapshot pour tous les lots
+        // écrits : construire un snapshot copie tout le catalogue. Le premier lot en
+        // échec arrête l'écriture ; les lots précédents sont publiés.
+        PublishReport publishBatches(std::vector<Product> added, std::size_t batchSize);
+
+        const ProductChangeLog &changes() const { return changes_; }
+
+    private:
+        std::vector<Product> loadAll();
+        ProductSnapshotPtr currentOrLoad(); // writeMutex_ tenu
+        // relayout : les slots de `next` ne prolongent pas ceux du snapshot courant.
+        void install(std::shared_ptr<ProductSnapshot> next, const std::vector<ProductChange> &changes,
+                     bool relayout = false);
+
+        ProductCache *cache_;
+        ProductIngestLog *log_;
+        ProductRepository *store_ = nullptr;
+        std::mutex writeMutex_; // sérialise les constructions de snapshot
+        std::mutex mutex_;      // protège current_
+        ProductSnapshotPtr current_;
+        ProductChangeLog changes_;
+    };
+}
+
+#endif // PRODUCT_CATALOG_HPP
@@ -0,0 +1,68 @@
+#ifndef PRODUCT_CHANGE_LOG_HPP
+#define PRODUCT_CHANGE_LOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    enum class ChangeOp : std::uint8_t
+    {
+        Upsert,
+        Delete
+    };
+
+    struct ProductChange
+    {
+        std::uint64_t version = 0;
+        std::uint64_t id = 0;
+        ChangeOp op = ChangeOp::Upsert;
+    };
+
+    // Delta entre deux versions, une entrée par id (la dernière opération l'emporte).
+    struct ProductDelta
+    {
+        bool expired = false; // version trop ancienne (ou inconnue) : resynchronisation complète
+        std::uint64_t version = 0;
+        std::vector<std::uint64_t> upserts;
+        std::vector<std::uint64_t> deletes;
+    };
+
+    // Version du catalogue, croissante, et anneau borné des changements par version.
+    // La version initiale est l'heure de démarrage (epoch ms) : une version obtenue
+    // avant un redémarrage tombe sous le plancher et déclenche une resynchronisation.
+    class ProductChangeLog
+    {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 100000;
+
+        explicit ProductChangeLog(std::size_t capacity = DEFAULT_CAPACITY);
+
+        std::uint64_t version() const;
+
+        // Plus petite version `since` encore servie.
+        std::uint64_t floor() const;
+
+        // Enregistre une nouvelle version contenant `changes` (champ version ignoré).
+        // Un lot plus grand que l'anneau le vide et remonte le plancher.
+        std::uint64_t record(const std::vector<ProductChange> &changes);
+
+        // Changements de (since, upTo].
+        ProductDelta since(std::uint64_t since, std::uint64_t upTo) const;
+
+    private:
+        void push(const ProductChange &change);
+        const ProductChange &at(std::size_t i) const { return ring_[(head_ + i) % ring_.size()]; }
+
+        mutable std::mutex mutex_;
+        std::vector<ProductChange> ring_;
+        std::size_t head_ = 0;
+        std::size_t size_ = 0;
+        std::uint64_t version_;
+        std::uint64_t floor_;
+    };
+}
+
+#endif // PRODUCT_CHANGE_LOG_HPP
@@ -0,0 +1,67 @@
+#ifndef PRODUCT_COLUMNS_HPP
+#define PRODUCT_COLUMNS_HPP
+
+#include <softadastra/commerce/products/Product.hpp>
+#include <adastra/core/columnar/ColumnScan.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    using Selection = adastra::core::columnar::Selection;
+
+    // Filtres numériques combinés en ET ; un champ absent n'est pas filtré.
+    struct ProductFilter
+    {
+        std::optional<float> minPrice;
+        std::optional<float> maxPrice;
+        std::optional<float> minShippingPrice;
+        std::optional<float> maxShippingPrice;
+        std::optional<float> minRating;
+        std::optional<float> maxRating;
+        std::optional<std::uint32_t> categoryId;
+        std::optional<std::uint32_t> minViews;
+        std::optional<std::uint32_t> minReviewCount;
+        std::optional<bool> boosted;
+        std::optional<std::uint32_t> createdSince; // secondes epoch
+
+        bool empty() const
+        {
+            return !minPrice && !maxPrice && !minShippingPrice && !maxShippingPrice &&
+                   !minRating && !maxRating && !categoryId && !minViews && !minReviewCount && !boosted &&
+                   !createdSince;
+        }
+    };
+
+    // Copie en colonnes (SoA) des champs numériques filtrables d'un lot de produits.
+    // La ligne i correspond à products[i].
+    class ProductColumns
+    {
+    public:
+        ProductColumns() = default;
+        explicit ProductColumns(const std::vector<Product> &products);
+
+        std::size_t size() const { return converted_price_value.size(); }
+
+        // Lignes satisfaisant tous les critères, dans l'ordre du catalogue.
+        Selection select(const ProductFilter &filter) const;
+
+        // Idem, minViews portant sur `liveViews` (une valeur par ligne) au lieu de
+        // `views` : les vues vivantes de LiveCounters.
+        Selection select(const ProductFilter &filter, std::span<const std::uint32_t> liveViews) const;
+
+        std::vector<float> converted_price_value;
+        std::vector<float> price_with_shipping_value;
+        std::vector<float> average_rating; // NaN si absent
+        std::vector<std::uint32_t> views;
+        std::vector<std::uint32_t> review_count;
+        std::vector<std::uint32_t> category_id;
+        std::vector<std::uint8_t> boost;
+        std::vector<std::uint32_t> created_at; // secondes epoch (u32 jusqu'en 2106), 0 si inconnue
+    };
+}
+
+#endif // PRODUCT_COLUMNS_HPP
@@ -0,0 +1,56 @@
+#ifndef PRODUCT_EXPORTER_HPP
+#define PRODUCT_EXPORTER_HPP
+
+#include <softadastra/commerce/products/ProductSnapshot.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace softadastra::commerce::products
+{
+    // Position dans un export, écrite "<layout>.<slot>" : un slot n'a de sens que
+    // pour les snapshots qui ont le même ordre de slots (ProductSnapshot::layout).
+    struct ExportCursor
+    {
+        std::uint64_t layout = 0;
+        std::size_t slot = 0; // premier slot à examiner
+
+        std::string str() const;
+        static std::optional<ExportCursor> parse(std::string_view text);
+    };
+
+    struct ExportOptions
+    {
+        std::optional<ExportCursor> cursor; // absent : début de l'export
+        std::optional<std::uint32_t> categoryId;
+        std::optional<std::int64_t> updatedSinceMs; // slots entrés à partir de cette date
+        std::size_t maxBytes = 1 << 20;             // taille max d'une page (au moins une ligne)
+    };
+
+    struct ExportPage
+    {
+        std::string body; // NDJSON : un produit par ligne
+        std::size_t records = 0;
+        ExportCursor nextCursor;
+        bool done = false;
+        bool expired = false; // curseur d'un autre ordre de slots : l'export doit reprendre au début
+    };
+
+    // Export NDJSON par pages : chaque page copie les corps déjà sérialisés du snapshot
+    // dans un tampon borné par maxBytes, quelle que soit la taille du catalogue.
+    // Le client suit nextCursor jusqu'à done ; les lots publiés entre deux pages
+    // n'invalident pas le curseur, un rechargement du catalogue ou un redémarrage oui.
+    class ProductExporter
+    {
+    public:
+        static constexpr std::size_t MIN_PAGE_BYTES = 4 * 1024;
+        static constexpr std::size_t MAX_PAGE_BYTES = 8 * 1024 * 1024;
+
+        static ExportPage page(const ProductSnapshot &snap, const ExportOptions &options);
+    };
+}
+
+#endif // PRODUCT_EXPORTER_HPP
@@ -0,0 +1,34 @@
+#ifndef PRODUCT_INGEST_LOG_HPP
+#define PRODUCT_INGEST_LOG_HPP
+
+#include <softadastra/commerce/products/Product.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    // Journal NDJSON en ajout seul des produits ingérés (un produit par ligne).
+    // Chaque lot est écrit d'un bloc puis synchronisé sur disque ; au chargement,
+    // le journal est rejoué par-dessus le fichier products.json.
+    class ProductIngestLog
+    {
+    public:
+        explicit ProductIngestLog(std::string path);
+
+        // Ajoute le lot et attend qu'il soit durable (fsync). Lance une exception en cas d'échec.
+        void append(const std::vector<Product> &batch);
+
+        // Relit tout le journal ; les lignes illisibles (fin tronquée) sont ignorées.
+        std::vector<Product> replay() const;
+
+        const std::string &path() const { return path_; }
+
+    private:
+        std::string path_;
+        mutable std::mutex mutex_;
+    };
+}
+
+#endif // PRODUCT_INGEST_LOG_HPP
@@ -0,0 +1,57 @@
+#ifndef PRODUCT_INGESTOR_HPP
+#define PRODUCT_INGESTOR_HPP
+
+#include <softadastra/commerce/products/ProductCatalog.hpp>
+#include <adastra/tools/id/SnowflakeGenerator.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    struct IngestError
+    {
+        std::size_t index; // position de l'enregistrement dans le corps
+        std::string message;
+    };
+
+    struct IngestReport
+    {
+        std::size_t received = 0;
+        std::size_t accepted = 0;
+        std::size_t batches = 0;
+        std::vector<std::uint64_t> ids; // ids attribués, dans l'ordre des enregistrements acceptés
+        std::vector<IngestError> errors;
+        std::string persistError; // non vide si un lot n'a pas pu être écrit
+    };
+
+    // Import en masse : découpe (NDJSON ou tableau JSON), validation en parallèle,
+    // attribution d'ids Snowflake, puis ProductCatalog::publishBatches() : une
+    // écriture par lot et un seul snapshot par requête.
+    class ProductIngestor
+    {
+    public:
+        using Normalizer = std::function<void(nlohmann::json &)>;
+
+        ProductIngestor(ProductCatalog &catalog,
+                        adastra::tools::id::SnowflakeGenerator &ids,
+                        Normalizer normalize = nullptr,
+                        std::size_t batchSize = 5000);
+
+        // Lance std::invalid_argument si le corps ne peut pas être découpé en enregistrements.
+        IngestReport ingest(std::string_view body);
+
+    private:
+        ProductCatalog &catalog_;
+        adastra::tools::id::SnowflakeGenerator &ids_;
+        Normalizer normalize_;
+        std::size_t batchSize_;
+    };
+}
+
+#endif // PRODUCT_INGESTOR_HPP
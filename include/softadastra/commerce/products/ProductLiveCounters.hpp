@@ -0,0 +1,87 @@
+#ifndef PRODUCT_LIVE_COUNTERS_HPP
+#define PRODUCT_LIVE_COUNTERS_HPP
+
+#include <softadastra/commerce/products/ProductSnapshot.hpp>
+#include <softadastra/commerce/products/ProductStats.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    // Compteurs vivants d'un snapshot, alignés sur ses slots. Le filtre min_views
+    // et les corps des réponses lisent cette même vue.
+    struct LiveCounters
+    {
+        // Produit dont les compteurs diffèrent du catalogue : corps réécrit une fois.
+        struct Patched
+        {
+            ProductStats::Counters counters{};
+            nlohmann::json dom;
+            std::string body; // dom.dump()
+        };
+
+        std::uint64_t generation = 0; // change à chaque reconstruction (clé des caches de corps)
+        std::uint64_t version = 0;    // ProductSnapshot::version
+        std::uint64_t epoch = 0;      // ProductStats::epoch() lu avant les compteurs
+        std::chrono::steady_clock::time_point builtAt;
+
+        std::vector<std::uint32_t> views; // vues vivantes par slot
+        std::unordered_map<std::uint32_t, std::shared_ptr<const Patched>> patched;
+
+        const Patched *find(std::uint32_t slot) const
+        {
+            const auto it = patched.find(slot);
+            return it == patched.end() ? nullptr : it->second.get();
+        }
+
+        // Corps JSON du slot : réécrit s'il a des compteurs vivants, sinon celui du snapshot.
+        const std::string &body(const ProductSnapshot &snap, std::uint32_t slot) const
+        {
+            const Patched *p = find(slot);
+            return p ? p->body : snap.bodies[slot];
+        }
+    };
+
+    using LiveCountersPtr = std::shared_ptr<const LiveCounters>;
+
+    // Construit les LiveCounters du snapshot courant à partir de ProductStats.
+    // Une vue est reprise tant que le snapshot n'a pas changé et que ProductStats
+    // n'a pas été écrit, ou qu'elle a moins de `maxAge` : les réponses ont au plus
+    // maxAge de retard sur /view, et la reconstruction (O(produits)) n'a pas lieu
+    // à chaque requête. maxAge = 0 : reconstruite à chaque écriture.
+    class ProductLiveCounters
+    {
+    public:
+        ProductLiveCounters(const ProductStats &stats, std::chrono::milliseconds maxAge);
+
+        LiveCountersPtr view(const ProductSnapshotPtr &snap);
+
+        // Compteurs vivants de `p` : ceux de ProductStats, sans descendre sous les
+        // vues et avis du catalogue (un slot non encore repris par seed()). false si
+        // rien ne diffère du catalogue.
+        static bool overlay(const Product &p, ProductStats::Counters &counters);
+
+        // p.toJson() avec les compteurs non nuls de `counters`.
+        static nlohmann::json toJson(const Product &p, const ProductStats::Counters &counters);
+
+    private:
+        bool fresh(const LiveCounters &view, const ProductSnapshot &snap) const;
+        LiveCountersPtr build(const ProductSnapshot &snap, const LiveCounters *previous);
+
+        const ProductStats &stats_;
+        std::chrono::milliseconds maxAge_;
+
+        std::mutex mutex_;      // current_, generation_
+        std::mutex buildMutex_; // une reconstruction à la fois
+        LiveCountersPtr current_;
+        std::uint64_t generation_ = 0;
+    };
+}
+
+#endif // PRODUCT_LIVE_COUNTERS_HPP
@@ -4,9 +4,16 @@
 #include <adastra/core/repository/JsonRepository.hpp>
 #include <softadastra/commerce/products/Product.hpp>
 
+#include <memory>
+#include <string>
+
 namespace softadastra::commerce::products
 {
     using ProductRepository = adastra::core::repository::JsonRepository<Product>;
+
+    // Base SQLite (table "products", index sur category_id, city_name et brand_id)
+    // si `path` se termine par .db, .sqlite ou .sqlite3 ; sinon fichier JSON {"data": [...]}.
+    std::shared_ptr<adastra::core::repository::RepositoryBackend> makeProductBackend(const std::string &path);
 }
 
 #endif // PRODUCT_REPOSITORY_HPP
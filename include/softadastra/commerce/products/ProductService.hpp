@@ -3,6 +3,9 @@
 
 #include <softadastra/commerce/products/Product.hpp>
 #include <softadastra/commerce/products/ProductRepository.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <vector>
 #include <string>
 
@@ -11,9 +14,12 @@ namespace softadastra::commerce::products
     class ProductService
     {
     public:
-        explicit ProductService(const std::string &jsonPath);
+        // Backend choisi par makeProductBackend() selon l'extension de `path`.
+        explicit ProductService(const std::string &path);
 
         std::vector<Product> getAllProducts() const;
+        std::optional<Product> getProduct(std::uint64_t id) const;
+        std::vector<Product> getByCategory(std::uint32_t categoryId, std::size_t limit = 50, std::size_t offset = 0) const;
         void reload();
 
     private:
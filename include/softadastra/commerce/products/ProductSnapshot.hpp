@@ -0,0 +1,63 @@
+#ifndef PRODUCT_SNAPSHOT_HPP
+#define PRODUCT_SNAPSHOT_HPP
+
+#include <softadastra/commerce/products/Product.hpp>
+#include <softadastra/commerce/products/ProductColumns.hpp>
+#include <adastra/core/structures/IdSlotIndex.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    // Vue immuable du catalogue à un instant donné : les produits et leurs colonnes
+    // numériques. Les routes gardent un shared_ptr pendant la requête, un rechargement
+    // publie simplement un nouveau snapshot.
+    struct ProductSnapshot
+    {
+        static constexpr std::uint32_t npos = adastra::core::structures::IdSlotIndex::npos;
+
+        explicit ProductSnapshot(std::vector<Product> items);
+
+        // Snapshot suivant : `base` + `added`. Les corps JSON de `base` sont réutilisés.
+        ProductSnapshot(const ProductSnapshot &base, std::vector<Product> added);
+
+        // Slot du produit `id`, ou npos.
+        std::uint32_t slotOf(std::uint64_t id) const { return index.find(id); }
+
+        const Product *findById(std::uint64_t id) const
+        {
+            const auto slot = slotOf(id);
+            return slot == npos ? nullptr : &products[slot];
+        }
+
+        std::vector<Product> products;
+        ProductColumns columns;
+        adastra::core::structures::IdSlotIndex index;
+
+        // products[i].toJson().dump(), sérialisé une fois par snapshot.
+        std::vector<std::string> bodies;
+
+        // Date (epoch ms) d'entrée du slot i dans le catalogue : created_at pour les
+        // produits chargés (heure du chargement s'il manque), heure de publication
+        // pour les lots ajoutés.
+        std::vector<std::int64_t> updatedAtMs;
+
+        // Slots du plus récent au plus ancien (columns.created_at), calculé une
+        // fois par snapshot pour ?sort=newest.
+        std::vector<std::uint32_t> newest;
+
+        // Version du catalogue (ProductChangeLog) que ce snapshot reflète.
+        std::uint64_t version = 0;
+
+        // Version à laquelle l'ordre des slots a été fixé : un lot publié ne fait
+        // qu'ajouter des slots et la garde, un rechargement en fixe une nouvelle.
+        std::uint64_t layout = 0;
+    };
+
+    using ProductSnapshotPtr = std::shared_ptr<const ProductSnapshot>;
+}
+
+#endif // PRODUCT_SNAPSHOT_HPP
@@ -0,0 +1,89 @@
+#ifndef PRODUCT_STATS_HPP
+#define PRODUCT_STATS_HPP
+
+#include <softadastra/commerce/products/Product.hpp>
+#include <adastra/storage/database/MetadataStore.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace softadastra::commerce::products
+{
+    enum class ProductCounter : std::size_t
+    {
+        Views,
+        Likes,
+        Orders,
+        Reviews,
+        UniqueBuyers
+    };
+
+    constexpr std::size_t kProductCounters = 5;
+
+    // Nom de la colonne et du champ JSON ("views", "likes_count", ...).
+    const char *counterName(ProductCounter counter);
+
+    // Compteurs des produits dans un MetadataStore : une mise à jour ne touche ni
+    // le Product ni le catalogue JSON. Chaque produit reçoit un slot à sa première
+    // mise à jour ; la table slot -> id (slots.ids) est ajoutée et synchronisée
+    // avant que le slot ne soit utilisé, donc stable d'un redémarrage à l'autre.
+    class ProductStats
+    {
+    public:
+        using Counters = std::array<std::uint32_t, kProductCounters>;
+
+        // Lance std::runtime_error si le répertoire ou un fichier est illisible.
+        explicit ProductStats(std::string directory, adastra::storage::database::MetadataStoreOptions options = {});
+
+        std::uint32_t add(std::uint64_t productId, ProductCounter counter, std::int64_t delta = 1);
+        std::uint32_t get(std::uint64_t productId, ProductCounter counter) const;
+        Counters counters(std::uint64_t productId) const;
+
+        // true si le produit a un slot : ses compteurs font alors foi.
+        bool contains(std::uint64_t productId) const { return slotOf(productId) != npos; }
+
+        // Produits ayant un slot et leurs compteurs, lus colonne par colonne.
+        std::vector<std::pair<std::uint64_t, Counters>> all() const;
+
+        // Incrémenté après chaque écriture de compteur (add, seed) : une valeur
+        // inchangée garantit que all() renverrait les mêmes compteurs.
+        std::uint64_t epoch() const { return epoch_.load(std::memory_order_acquire); }
+
+        // Les k produits (id, valeur) de plus grande valeur non nulle.
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> top(ProductCounter counter, std::size_t k) const;
+
+        // Ajoute views et review_count du catalogue aux produits pas encore repris,
+        // y compris ceux dont le slot a été créé par add() avant cet appel (un
+        // marqueur par slot, persistant, évite de les reprendre deux fois).
+        // Un seul appel à la fois.
+        std::size_t seed(const std::vector<Product> &products);
+
+        void flush() { store_.flush(); }
+        adastra::storage::database::MetadataStats stats() const { return store_.stats(); }
+
+    private:
+        static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+
+        std::uint32_t slotOf(std::uint64_t productId) const;
+        std::uint32_t slotFor(std::uint64_t productId); // crée le slot au besoin
+        void appendIds(const std::vector<std::uint64_t> &ids);
+
+        std::string idsPath_;
+        adastra::storage::database::MetadataStore store_;
+
+        mutable std::shared_mutex slotsMutex_;
+        std::unordered_map<std::uint64_t, std::uint32_t> slots_;
+        std::vector<std::uint64_t> ids_; // slot -> id
+
+        std::atomic<std::uint64_t> epoch_{0};
+    };
+}
+
+#endif // PRODUCT_STATS_HPP
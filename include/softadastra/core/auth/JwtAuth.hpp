@@ -0,0 +1,46 @@
+#ifndef JWT_AUTH_HPP
+#define JWT_AUTH_HPP
+
+#include <adastra/crypto/jwt/JwtVerifier.hpp>
+
+#include <vix.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace softadastra::core::auth
+{
+    // Vérificateur partagé par toutes les routes, configuré au premier appel
+    // depuis l'environnement :
+    //   JWT_HS256_SECRET         secret HMAC (jetons HS256)
+    //   JWT_ED25519_PUBLIC_KEY   clé publique Ed25519 en hex (jetons EdDSA)
+    //   JWT_ISSUER, JWT_AUDIENCE vérifiés s'ils sont définis
+    // Sans clé, toutes les routes protégées répondent 401.
+    adastra::crypto::jwt::JwtVerifier &jwtVerifier();
+
+    // Jeton d'un en-tête "Authorization: Bearer <jeton>" ; vide sinon.
+    std::string_view bearerToken(std::string_view authorization);
+
+    // Enveloppe un handler (req, res, claims) : le jeton est vérifié avant
+    // l'appel, un jeton absent ou invalide répond 401 sans atteindre le handler.
+    template <typename Handler>
+    auto requireAuth(Handler handler)
+    {
+        return [handler = std::move(handler)](auto &req, auto &res)
+        {
+            const std::string authorization = req.header("Authorization");
+            const auto result = jwtVerifier().verify(bearerToken(authorization));
+            if (!result)
+            {
+                res.status(http::status::unauthorized)
+                    .header("WWW-Authenticate", "Bearer error=\"invalid_token\"")
+                    .json({"error", adastra::crypto::jwt::describe(result.error)});
+                return;
+            }
+            handler(req, res, *result.claims);
+        };
+    }
+}
+
+#endif // JWT_AUTH_HPP
@@ -1,9 +1,13 @@
 #ifndef GENERIC_CACHE_HPP
 #define GENERIC_CACHE_HPP
 
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -68,6 +72,15 @@ namespace softadastra::core::cache
         bool isLoaded;
         std::mutex mutex;
 
+        // Écritures du fichier cache en tâche de fond : seule la plus récente compte.
+        struct PendingWrites
+        {
+            std::mutex mutex;
+            std::uint64_t requested = 0; // sous GenericCache::mutex
+            std::uint64_t written = 0;
+        };
+        std::shared_ptr<PendingWrites> writes_ = std::make_shared<PendingWrites>();
+
         void load(bool forceReload = false)
         {
             if (!forceReload && loadFromFile())
@@ -151,13 +164,26 @@ namespace softadastra::core::cache
                 nlohmann::json jsonToSave = serialize(data_);
                 cachedJson = jsonToSave.dump(2);
 
-                std::ofstream out(cachePath, std::ios::out | std::ios::trunc);
-                if (out.is_open())
-                {
-                    out.write(cachedJson.data(),
-                              static_cast<std::streamsize>(cachedJson.size()));
-                    out.close();
-                }
+                // Le disque est écrit sur le pool partagé : la requête qui a déclenché
+                // le chargement n'attend pas l'écriture.
+                const std::uint64_t version = ++writes_->requested;
+                adastra::core::concurrency::TaskScheduler::shared().post(
+                    [writes = writes_, path = cachePath, body = cachedJson, version]
+                    {
+                        std::lock_guard<std::mutex> lock(writes->mutex);
+                        if (version <= writes->written)
+                            return; // une version plus récente est déjà sur disque
+
+                        std::ofstream out(path, std::ios::out | std::ios::trunc);
+                        if (!out.is_open())
+                        {
+                            std::cerr << "[GenericCache] ⚠️ Écriture impossible : " << path << "\n";
+                            return;
+                        }
+                        out.write(body.data(), static_cast<std::streamsize>(body.size()));
+                        writes->written = version;
+                    },
+                    adastra::core::concurrency::TaskPriority::Background);
             }
         }
     };
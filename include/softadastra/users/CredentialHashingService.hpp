@@ -0,0 +1,101 @@
+#ifndef CREDENTIAL_HASHING_SERVICE_HPP
+#define CREDENTIAL_HASHING_SERVICE_HPP
+
+#include <adastra/crypto/password/PasswordHasher.hpp>
+#include <adastra/tools/metrics/HdrHistogram.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace softadastra::users
+{
+    struct CredentialPoolOptions
+    {
+        unsigned threads = 2;
+        // Demandes en attente au-delà des threads occupés ; au-delà, refus immédiat.
+        std::size_t queueCapacity = 64;
+    };
+
+    struct CredentialMetrics
+    {
+        unsigned workers = 0;
+        std::size_t queueDepth = 0;
+        std::size_t queueCapacity = 0;
+        std::size_t running = 0;
+
+        std::uint64_t submitted = 0;
+        std::uint64_t completed = 0;
+        std::uint64_t rejected = 0; // file pleine
+
+        // Microsecondes : attente en file, puis calcul.
+        std::uint64_t waitP50Us = 0;
+        std::uint64_t waitP99Us = 0;
+        std::uint64_t runP50Us = 0;
+        std::uint64_t runP99Us = 0;
+    };
+
+    // Hachage/vérification de mots de passe sur un pool de threads dédié, de
+    // taille fixe, avec une file bornée : les calculs coûteux ne prennent jamais
+    // le CPU des threads HTTP au-delà de `threads` cœurs, et une rafale
+    // d'inscriptions est refusée (nullopt -> 503) au lieu de s'accumuler.
+    class CredentialHashingService
+    {
+    public:
+        using PasswordHasher = adastra::crypto::password::PasswordHasher;
+
+        explicit CredentialHashingService(PasswordHasher hasher = PasswordHasher(),
+                                          CredentialPoolOptions options = {});
+        ~CredentialHashingService(); // termine les demandes déjà en file
+
+        CredentialHashingService(const CredentialHashingService &) = delete;
+        CredentialHashingService &operator=(const CredentialHashingService &) = delete;
+
+        // nullopt si la file est pleine. Le mot de passe est effacé après usage.
+        std::optional<std::future<std::string>> hash(std::string password);
+        std::optional<std::future<bool>> verify(std::string password, std::string encoded);
+
+        CredentialMetrics metrics() const;
+        const PasswordHasher &hasher() const { return hasher_; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Task
+        {
+            std::function<void()> run;
+            Clock::time_point enqueuedAt;
+        };
+
+        bool submit(std::function<void()> run);
+        void workerLoop();
+
+        PasswordHasher hasher_;
+        CredentialPoolOptions options_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<Task> queue_;
+        std::size_t running_ = 0;
+        bool stopping_ = false;
+
+        std::uint64_t submitted_ = 0;
+        std::uint64_t completed_ = 0;
+        std::uint64_t rejected_ = 0;
+        adastra::tools::metrics::HdrHistogram waitUs_{60'000'000};
+        adastra::tools::metrics::HdrHistogram runUs_{60'000'000};
+
+        std::vector<std::thread> workers_;
+    };
+}
+
+#endif // CREDENTIAL_HASHING_SERVICE_HPP
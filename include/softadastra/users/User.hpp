@@ -0,0 +1,34 @@
+#ifndef USER_HPP
+#define USER_HPP
+
+#include <cstdint>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+namespace softadastra::users
+{
+    struct User
+    {
+        std::uint64_t id = 0;
+        std::string name;
+        std::string email;
+        int age = 0;
+
+        // Hash PasswordHasher ("$scrypt$..."), vide si l'utilisateur n'a pas de
+        // mot de passe. Jamais exposé par toJson().
+        std::string passwordHash;
+
+        // L'id est exposé en chaîne : un Snowflake dépasse les entiers sûrs de JavaScript.
+        nlohmann::json toJson() const
+        {
+            return {
+                {"id", std::to_string(id)},
+                {"name", name},
+                {"email", email},
+                {"age", age}};
+        }
+    };
+}
+
+#endif // USER_HPP
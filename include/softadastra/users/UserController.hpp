@@ -0,0 +1,11 @@
+#ifndef USER_CONTROLLER_HPP
+#define USER_CONTROLLER_HPP
+
+#include <vix.hpp>
+
+namespace softadastra::users
+{
+    void UserController(Vix::App &app);
+}
+
+#endif // USER_CONTROLLER_HPP
@@ -0,0 +1,55 @@
+#ifndef USER_JOURNAL_HPP
+#define USER_JOURNAL_HPP
+
+#include <softadastra/users/User.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace softadastra::users
+{
+    // Journal NDJSON en ajout seul des utilisateurs, avec commit groupé : les écritures
+    // concurrentes sont regroupées et un seul fsync rend tout le groupe durable.
+    class UserJournal
+    {
+    public:
+        explicit UserJournal(std::string path);
+        ~UserJournal();
+
+        UserJournal(const UserJournal &) = delete;
+        UserJournal &operator=(const UserJournal &) = delete;
+
+        // Retourne une fois l'enregistrement durable. Lance une exception en cas d'échec.
+        void append(const User &user);
+
+        // Relit le journal ; les lignes illisibles (fin tronquée) sont ignorées.
+        std::size_t replay(const std::function<void(User)> &apply) const;
+
+        const std::string &path() const { return path_; }
+
+    private:
+        // Lignes écrites et synchronisées ensemble.
+        struct Group
+        {
+            std::string lines;
+            bool done = false;
+            bool ok = false;
+        };
+
+        bool writeDurable(const std::string &lines);
+
+        std::string path_;
+        std::FILE *file_ = nullptr;
+
+        std::mutex mutex_;
+        std::condition_variable flushed_;
+        std::shared_ptr<Group> open_; // groupe qui reçoit les nouveaux enregistrements
+        bool flushing_ = false;
+    };
+}
+
+#endif // USER_JOURNAL_HPP
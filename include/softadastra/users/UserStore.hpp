@@ -0,0 +1,82 @@
+#ifndef USER_STORE_HPP
+#define USER_STORE_HPP
+
+#include <softadastra/users/User.hpp>
+#include <softadastra/users/UserJournal.hpp>
+#include <adastra/tools/id/SnowflakeGenerator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace softadastra::users
+{
+    enum class CreateStatus
+    {
+        Created,
+        EmailTaken
+    };
+
+    struct CreateResult
+    {
+        CreateStatus status = CreateStatus::Created;
+        User user; // créé, ou l'utilisateur existant pour EmailTaken
+    };
+
+    // Magasin d'utilisateurs réparti sur N tranches verrouillées séparément :
+    // par id pour les fiches, par email (normalisé) pour l'index d'unicité.
+    // Les ids viennent de SnowflakeGenerator, chaque création est journalisée.
+    class UserStore
+    {
+    public:
+        static constexpr std::size_t DEFAULT_STRIPES = 64;
+
+        UserStore(std::unique_ptr<UserJournal> journal,
+                  adastra::tools::id::SnowflakeGenerator &ids,
+                  std::size_t stripes = DEFAULT_STRIPES);
+
+        // Recharge le journal ; à appeler avant de servir.
+        std::size_t load();
+
+        // Lance une exception si la création n'a pas pu être journalisée.
+        CreateResult create(User user);
+
+        std::optional<User> findById(std::uint64_t id) const;
+        std::optional<User> findByEmail(std::string_view email) const;
+
+        std::size_t size() const;
+
+        // Minuscules, espaces de bord retirés : clé de l'index email.
+        static std::string normalizeEmail(std::string_view email);
+
+    private:
+        struct UserStripe
+        {
+            mutable std::mutex mutex;
+            std::unordered_map<std::uint64_t, User> users;
+        };
+
+        struct EmailStripe
+        {
+            mutable std::mutex mutex;
+            std::unordered_map<std::string, std::uint64_t> ids;
+        };
+
+        UserStripe &userStripe(std::uint64_t id) const;
+        EmailStripe &emailStripe(const std::string &email) const;
+        void put(User user);
+
+        std::unique_ptr<UserJournal> journal_;
+        adastra::tools::id::SnowflakeGenerator &ids_;
+        std::size_t mask_;
+        std::unique_ptr<UserStripe[]> users_;
+        std::unique_ptr<EmailStripe[]> emails_;
+    };
+}
+
+#endif // USER_STORE_HPP
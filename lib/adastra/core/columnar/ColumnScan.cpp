@@ -0,0 +1,477 @@
+#include <adastra/core/columnar/ColumnScan.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SA_COLUMNAR_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(SA_COLUMNAR_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SA_COLUMNAR_AVX2 1
+#define SA_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace adastra::core::columnar
+{
+    namespace
+    {
+        // Nombre de lignes traitées d'un coup par select() : les mots du masque restent en L1.
+        constexpr std::size_t kBlockRows = 4096;
+
+        enum class Isa
+        {
+            Scalar,
+            Sse2,
+            Avx2
+        };
+
+        Isa detectIsa()
+        {
+#if defined(SA_COLUMNAR_AVX2)
+            if (__builtin_cpu_supports("avx2"))
+                return Isa::Avx2;
+#endif
+#if defined(SA_COLUMNAR_X86)
+            return Isa::Sse2;
+#else
+            return Isa::Scalar;
+#endif
+        }
+
+        const Isa g_isa = detectIsa();
+
+        inline void store(std::uint64_t *word, std::uint64_t bits, MaskOp op)
+        {
+            if (op == MaskOp::Assign)
+                *word = bits;
+            else
+                *word &= bits;
+        }
+
+        template <typename Pred>
+        inline std::uint64_t scalarBits(std::size_t n, Pred &&pred)
+        {
+            std::uint64_t bits = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                bits |= static_cast<std::uint64_t>(pred(i) ? 1u : 0u) << i;
+            return bits;
+        }
+
+        // Parcourt la colonne par mots de 64 lignes. `full` traite un mot complet,
+        // `tail` le dernier mot partiel.
+        template <typename T, typename Full, typename Tail>
+        inline void forEachWord(std::span<const T> column, std::span<std::uint64_t> words,
+                                MaskOp op, Full &&full, Tail &&tail)
+        {
+            const std::size_t rows = column.size();
+            std::size_t w = 0;
+            std::size_t base = 0;
+            for (; base + 64 <= rows; base += 64, ++w)
+                store(&words[w], full(column.data() + base), op);
+            if (base < rows)
+                store(&words[w], tail(column.data() + base, rows - base), op);
+        }
+
+        // ------------------------------------------------------------------
+        // Scalar
+        // ------------------------------------------------------------------
+        template <typename T, typename Pred>
+        void maskScalar(std::span<const T> column, std::span<std::uint64_t> words, MaskOp op, Pred pred)
+        {
+            auto tail = [&](const T *p, std::size_t n)
+            { return scalarBits(n, [&](std::size_t i)
+                                { return pred(p[i]); }); };
+            forEachWord(column, words, op, [&](const T *p)
+                        { return tail(p, 64); }, tail);
+        }
+
+#if defined(SA_COLUMNAR_X86)
+        // ------------------------------------------------------------------
+        // SSE2 (toujours disponible en x86-64)
+        // ------------------------------------------------------------------
+        void rangeF32Sse2(std::span<const float> column, float lo, float hi,
+                          std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m128 vlo = _mm_set1_ps(lo);
+            const __m128 vhi = _mm_set1_ps(hi);
+            forEachWord(
+                column, words, op,
+                [&](const float *p)
+                {
+                    std::uint64_t bits = 0;
+                    for (std::size_t k = 0; k < 64; k += 4)
+                    {
+                        const __m128 v = _mm_loadu_ps(p + k);
+                        const __m128 m = _mm_and_ps(_mm_cmpge_ps(v, vlo), _mm_cmple_ps(v, vhi));
+                        bits |= static_cast<std::uint64_t>(_mm_movemask_ps(m)) << k;
+                    }
+                    return bits;
+                },
+                [&](const float *p, std::size_t n)
+                { return scalarBits(n, [&](std::size_t i)
+                                    { return p[i] >= lo && p[i] <= hi; }); });
+        }
+
+        void rangeU32Sse2(std::span<const std::uint32_t> column, std::uint32_t lo, std::uint32_t hi,
+                          std::span<std::uint64_t> words, MaskOp op)
+        {
+            // Pas de comparaison non signée en SSE2 : on décale dans l'espace signé.
+            const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+            const __m128i vlo = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(lo)), bias);
+            const __m128i vhi = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(hi)), bias);
+            forEachWord(
+                column, words, op,
+                [&](const std::uint32_t *p)
+                {
+                    std::uint64_t bits = 0;
+                    for (std::size_t k = 0; k < 64; k += 4)
+                    {
+                        const __m128i v = _mm_xor_si128(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + k)), bias);
+                        const __m128i out = _mm_or_si128(_mm_cmpgt_epi32(vlo, v), _mm_cmpgt_epi32(v, vhi));
+                        const int m = _mm_movemask_ps(_mm_castsi128_ps(out)) ^ 0xF;
+                        bits |= static_cast<std::uint64_t>(m) << k;
+                    }
+                    return bits;
+                },
+                [&](const std::uint32_t *p, std::size_t n)
+                { return scalarBits(n, [&](std::size_t i)
+                                    { return p[i] >= lo && p[i] <= hi; }); });
+        }
+
+        void equalU32Sse2(std::span<const std::uint32_t> column, std::uint32_t value,
+                          std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m128i vv = _mm_set1_epi32(static_cast<int>(value));
+            forEachWord(
+                column, words, op,
+                [&](const std::uint32_t *p)
+                {
+                    std::uint64_t bits = 0;
+                    for (std::size_t k = 0; k < 64; k += 4)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + k));
+                        const int m = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, vv)));
+                        bits |= static_cast<std::uint64_t>(m) << k;
+                    }
+                    return bits;
+                },
+                [&](const std::uint32_t *p, std::size_t n)
+                { return scalarBits(n, [&](std::size_t i)
+                                    { return p[i] == value; }); });
+        }
+
+        void equalU8Sse2(std::span<const std::uint8_t> column, std::uint8_t value,
+                         std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m128i vv = _mm_set1_epi8(static_cast<char>(value));
+            forEachWord(
+                column, words, op,
+                [&](const std::uint8_t *p)
+                {
+                    std::uint64_t bits = 0;
+                    for (std::size_t k = 0; k < 64; k += 16)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + k));
+                        const auto m = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, vv)));
+                        bits |= static_cast<std::uint64_t>(m) << k;
+                    }
+                    return bits;
+                },
+                [&](const std::uint8_t *p, std::size_t n)
+                { return scalarBits(n, [&](std::size_t i)
+                                    { return p[i] == value; }); });
+        }
+#endif
+
+#if defined(SA_COLUMNAR_AVX2)
+        // ------------------------------------------------------------------
+        // AVX2 (sélectionné à l'exécution)
+        // ------------------------------------------------------------------
+        SA_TARGET_AVX2 void rangeF32Avx2(std::span<const float> column, float lo, float hi,
+                                         std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m256 vlo = _mm256_set1_ps(lo);
+            const __m256 vhi = _mm256_set1_ps(hi);
+            const std::size_t rows = column.size();
+            const float *data = column.data();
+            std::size_t w = 0;
+            std::size_t base = 0;
+            for (; base + 64 <= rows; base += 64, ++w)
+            {
+                std::uint64_t bits = 0;
+                for (std::size_t k = 0; k < 64; k += 8)
+                {
+                    const __m256 v = _mm256_loadu_ps(data + base + k);
+                    const __m256 m = _mm256_and_ps(_mm256_cmp_ps(v, vlo, _CMP_GE_OQ),
+                                                   _mm256_cmp_ps(v, vhi, _CMP_LE_OQ));
+                    bits |= static_cast<std::uint64_t>(_mm256_movemask_ps(m)) << k;
+                }
+                store(&words[w], bits, op);
+            }
+            if (base < rows)
+            {
+                const float *p = data + base;
+                store(&words[w], scalarBits(rows - base, [&](std::size_t i)
+                                            { return p[i] >= lo && p[i] <= hi; }),
+                      op);
+            }
+        }
+
+        SA_TARGET_AVX2 void rangeU32Avx2(std::span<const std::uint32_t> column, std::uint32_t lo, std::uint32_t hi,
+                                         std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m256i vlo = _mm256_set1_epi32(static_cast<int>(lo));
+            const __m256i vhi = _mm256_set1_epi32(static_cast<int>(hi));
+            const std::size_t rows = column.size();
+            const std::uint32_t *data = column.data();
+            std::size_t w = 0;
+            std::size_t base = 0;
+            for (; base + 64 <= rows; base += 64, ++w)
+            {
+                std::uint64_t bits = 0;
+                for (std::size_t k = 0; k < 64; k += 8)
+                {
+                    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + base + k));
+                    // v >= lo  <=>  max(v, lo) == v ; v <= hi  <=>  min(v, hi) == v
+                    const __m256i ge = _mm256_cmpeq_epi32(_mm256_max_epu32(v, vlo), v);
+                    const __m256i le = _mm256_cmpeq_epi32(_mm256_min_epu32(v, vhi), v);
+                    const int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(ge, le)));
+                    bits |= static_cast<std::uint64_t>(m) << k;
+                }
+                store(&words[w], bits, op);
+            }
+            if (base < rows)
+            {
+                const std::uint32_t *p = data + base;
+                store(&words[w], scalarBits(rows - base, [&](std::size_t i)
+                                            { return p[i] >= lo && p[i] <= hi; }),
+                      op);
+            }
+        }
+
+        SA_TARGET_AVX2 void equalU32Avx2(std::span<const std::uint32_t> column, std::uint32_t value,
+                                         std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m256i vv = _mm256_set1_epi32(static_cast<int>(value));
+            const std::size_t rows = column.size();
+            const std::uint32_t *data = column.data();
+            std::size_t w = 0;
+            std::size_t base = 0;
+            for (; base + 64 <= rows; base += 64, ++w)
+            {
+                std::uint64_t bits = 0;
+                for (std::size_t k = 0; k < 64; k += 8)
+                {
+                    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + base + k));
+                    const int m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, vv)));
+                    bits |= static_cast<std::uint64_t>(m) << k;
+                }
+                store(&words[w], bits, op);
+            }
+            if (base < rows)
+            {
+                const std::uint32_t *p = data + base;
+                store(&words[w], scalarBits(rows - base, [&](std::size_t i)
+                                            { return p[i] == value; }),
+                      op);
+            }
+        }
+
+        SA_TARGET_AVX2 void equalU8Avx2(std::span<const std::uint8_t> column, std::uint8_t value,
+                                        std::span<std::uint64_t> words, MaskOp op)
+        {
+            const __m256i vv = _mm256_set1_epi8(static_cast<char>(value));
+            const std::size_t rows = column.size();
+            const std::uint8_t *data = column.data();
+            std::size_t w = 0;
+            std::size_t base = 0;
+            for (; base + 64 <= rows; base += 64, ++w)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + base));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + base + 32));
+                const auto lo = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, vv)));
+                const auto hi = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, vv)));
+                store(&words[w], static_cast<std::uint64_t>(lo) | (static_cast<std::uint64_t>(hi) << 32), op);
+            }
+            if (base < rows)
+            {
+                const std::uint8_t *p = data + base;
+                store(&words[w], scalarBits(rows - base, [&](std::size_t i)
+                                            { return p[i] == value; }),
+                      op);
+            }
+        }
+#endif
+    }
+
+    void maskRange(std::span<const float> column, float lo, float hi,
+                   std::span<std::uint64_t> words, MaskOp op)
+    {
+        switch (g_isa)
+        {
+#if defined(SA_COLUMNAR_AVX2)
+        case Isa::Avx2:
+            return rangeF32Avx2(column, lo, hi, words, op);
+#endif
+#if defined(SA_COLUMNAR_X86)
+        case Isa::Sse2:
+            return rangeF32Sse2(column, lo, hi, words, op);
+#endif
+        default:
+            return maskScalar(column, words, op, [=](float v)
+                              { return v >= lo && v <= hi; });
+        }
+    }
+
+    void maskRange(std::span<const std::uint32_t> column, std::uint32_t lo, std::uint32_t hi,
+                   std::span<std::uint64_t> words, MaskOp op)
+    {
+        switch (g_isa)
+        {
+#if defined(SA_COLUMNAR_AVX2)
+        case Isa::Avx2:
+            return rangeU32Avx2(column, lo, hi, words, op);
+#endif
+#if defined(SA_COLUMNAR_X86)
+        case Isa::Sse2:
+            return rangeU32Sse2(column, lo, hi, words, op);
+#endif
+        default:
+            return maskScalar(column, words, op, [=](std::uint32_t v)
+                              { return v >= lo && v <= hi; });
+        }
+    }
+
+    void maskEqual(std::span<const std::uint32_t> column, std::uint32_t value,
+                   std::span<std::uint64_t> words, MaskOp op)
+    {
+        switch (g_isa)
+        {
+#if defined(SA_COLUMNAR_AVX2)
+        case Isa::Avx2:
+            return equalU32Avx2(column, value, words, op);
+#endif
+#if defined(SA_COLUMNAR_X86)
+        case Isa::Sse2:
+            return equalU32Sse2(column, value, words, op);
+#endif
+        default:
+            return maskScalar(column, words, op, [=](std::uint32_t v)
+                              { return v == value; });
+        }
+    }
+
+    void maskEqual(std::span<const std::uint8_t> column, std::uint8_t value,
+                   std::span<std::uint64_t> words, MaskOp op)
+    {
+        switch (g_isa)
+        {
+#if defined(SA_COLUMNAR_AVX2)
+        case Isa::Avx2:
+            return equalU8Avx2(column, value, words, op);
+#endif
+#if defined(SA_COLUMNAR_X86)
+        case Isa::Sse2:
+            return equalU8Sse2(column, value, words, op);
+#endif
+        default:
+            return maskScalar(column, words, op, [=](std::uint8_t v)
+                              { return v == value; });
+        }
+    }
+
+    void appendSelection(std::span<const std::uint64_t> words, std::size_t rows,
+                         std::uint32_t base, Selection &out)
+    {
+        const std::size_t n = std::min(words.size(), wordsFor(rows));
+        for (std::size_t w = 0; w < n; ++w)
+        {
+            std::uint64_t bits = words[w];
+            const std::size_t remaining = rows - w * 64;
+            if (remaining < 64)
+                bits &= (std::uint64_t{1} << remaining) - 1;
+
+            const auto offset = static_cast<std::uint32_t>(base + w * 64);
+            while (bits)
+            {
+                out.push_back(offset + static_cast<std::uint32_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    namespace
+    {
+        void selectRange(std::size_t begin, std::size_t rows, const std::vector<Predicate> &predicates,
+                         Selection &out)
+        {
+            std::uint64_t words[wordsFor(kBlockRows)];
+
+            for (std::size_t offset = 0; offset < rows; offset += kBlockRows)
+            {
+                const std::size_t n = std::min(kBlockRows, rows - offset);
+                std::span<std::uint64_t> block(words, wordsFor(n));
+
+                if (predicates.empty())
+                    std::fill(block.begin(), block.end(), ~std::uint64_t{0});
+
+                for (std::size_t i = 0; i < predicates.size(); ++i)
+                    predicates[i](begin + offset, n, block, i == 0 ? MaskOp::Assign : MaskOp::And);
+
+                appendSelection(block, n, static_cast<std::uint32_t>(begin + offset), out);
+            }
+        }
+    }
+
+    Selection select(std::size_t rows, const std::vector<Predicate> &predicates,
+                     std::size_t parallelThreshold)
+    {
+        Selection out;
+        if (rows == 0)
+            return out;
+
+        auto &scheduler = concurrency::TaskScheduler::shared();
+        const std::size_t cores = scheduler.cores();
+        if (rows < parallelThreshold || cores == 1)
+        {
+            selectRange(0, rows, predicates, out);
+            return out;
+        }
+
+        // Tranches alignées sur un bloc pour que chaque tâche ne produise que des
+        // mots complets ; deux par cœur pour que le vol de travail équilibre.
+        std::size_t chunk = (rows + 2 * cores - 1) / (2 * cores);
+        chunk = (chunk + kBlockRows - 1) / kBlockRows * kBlockRows;
+        const std::size_t parts = (rows + chunk - 1) / chunk;
+
+        std::vector<Selection> partial(parts);
+        scheduler.parallelFor(0, rows, [&](std::size_t lo, std::size_t hi)
+                              { selectRange(lo, hi - lo, predicates, partial[lo / chunk]); },
+                              {chunk});
+
+        std::size_t total = 0;
+        for (const auto &p : partial)
+            total += p.size();
+        out.reserve(total);
+        for (const auto &p : partial)
+            out.insert(out.end(), p.begin(), p.end());
+        return out;
+    }
+
+    const char *activeIsa()
+    {
+        switch (g_isa)
+        {
+        case Isa::Avx2:
+            return "avx2";
+        case Isa::Sse2:
+            return "sse2";
+        default:
+            return "scalar";
+        }
+    }
+}
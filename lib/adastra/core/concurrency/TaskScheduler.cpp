@@ -0,0 +1,314 @@
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace adastra::core::concurrency
+{
+    namespace
+    {
+        // Worker courant : scheduler propriétaire et indice de sa file.
+        thread_local const TaskScheduler *tlsScheduler = nullptr;
+        thread_local std::size_t tlsIndex = 0;
+
+        // Cœurs autorisés pour le processus (affinité, cgroups cpuset), pas ceux de la machine.
+        std::vector<int> allowedCpus()
+        {
+            std::vector<int> cpus;
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (::sched_getaffinity(0, sizeof(set), &set) == 0)
+            {
+                for (int c = 0; c < CPU_SETSIZE; ++c)
+                    if (CPU_ISSET(c, &set))
+                        cpus.push_back(c);
+            }
+#endif
+            if (cpus.empty())
+            {
+                const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+                for (unsigned c = 0; c < hw; ++c)
+                    cpus.push_back(static_cast<int>(c));
+            }
+            return cpus;
+        }
+
+        void pin(std::thread &t, int cpu)
+        {
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            if (::pthread_setaffinity_np(t.native_handle(), sizeof(set), &set) != 0)
+                std::cerr << "[TaskScheduler] ⚠️ affinité refusée pour le cœur " << cpu << "\n";
+#else
+            (void)t;
+            (void)cpu;
+#endif
+        }
+
+        // Tranches d'un parallelFor : partagées avec les tâches d'aide, qui peuvent
+        // démarrer après le retour de l'appelant et trouvent alors tout réclamé.
+        struct ForkJoin
+        {
+            const std::function<void(std::size_t)> *fn = nullptr;
+            std::size_t chunks = 0;
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+            std::atomic<bool> failed{false};
+            std::mutex errorMutex;
+            std::exception_ptr error;
+
+            void drain()
+            {
+                for (;;)
+                {
+                    const std::size_t c = next.fetch_add(1, std::memory_order_relaxed);
+                    if (c >= chunks)
+                        return;
+
+                    // fn n'est lu que pour une tranche réclamée : l'appelant attend encore.
+                    if (!failed.load(std::memory_order_relaxed))
+                    {
+                        try
+                        {
+                            (*fn)(c);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(errorMutex);
+                            if (!error)
+                                error = std::current_exception();
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                    }
+
+                    if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks)
+                        done.notify_all();
+                }
+            }
+        };
+    }
+
+    TaskScheduler::TaskScheduler(SchedulerOptions options)
+    {
+        const std::vector<int> cpus = allowedCpus();
+        cores_ = static_cast<unsigned>(cpus.size());
+
+        const unsigned n = options.workers ? options.workers : cores_;
+        queues_.reserve(n);
+        for (unsigned i = 0; i < n; ++i)
+            queues_.push_back(std::make_unique<Queue>());
+
+        workers_.reserve(n);
+        for (unsigned i = 0; i < n; ++i)
+        {
+            workers_.emplace_back([this, i]
+                                  { workerLoop(i); });
+            if (options.pinWorkers)
+                pin(workers_.back(), cpus[i % cpus.size()]);
+        }
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stopping_ = true;
+        }
+        sleepCv_.notify_all();
+        for (auto &t : workers_)
+            t.join();
+    }
+
+    bool TaskScheduler::onWorkerThread() const
+    {
+        return tlsScheduler == this;
+    }
+
+    void TaskScheduler::post(Task task, TaskPriority priority)
+    {
+        const auto p = static_cast<std::size_t>(priority);
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+
+        if (queues_.empty())
+        {
+            execute(task);
+            return;
+        }
+
+        // Un worker garde ses sous-tâches pour lui (les autres viendront voler).
+        const std::size_t target = onWorkerThread()
+                                       ? tlsIndex
+                                       : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        // Compté avant d'être visible : queued_ ne passe jamais sous zéro.
+        queued_[p].fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(queues_[target]->mutex);
+            queues_[target]->tasks[p].push_back(std::move(task));
+        }
+
+        // Couplé à la relecture de queued_ sous sleepMutex_ dans workerLoop : pas de réveil perdu.
+        if (sleepers_.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            sleepCv_.notify_one();
+        }
+    }
+
+    bool TaskScheduler::tryPop(std::size_t self, bool isWorker, Task &out)
+    {
+        const std::size_t n = queues_.size();
+        for (std::size_t p = 0; p < kPriorities; ++p)
+        {
+            if (queued_[p].load() == 0)
+                continue;
+
+            if (isWorker)
+            {
+                Queue &own = *queues_[self];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks[p].empty())
+                {
+                    out = std::move(own.tasks[p].back());
+                    own.tasks[p].pop_back();
+                    queued_[p].fetch_sub(1);
+                    return true;
+                }
+            }
+
+            for (std::size_t k = isWorker ? 1 : 0; k < n; ++k)
+            {
+                Queue &victim = *queues_[(self + k) % n];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks[p].empty())
+                {
+                    out = std::move(victim.tasks[p].front());
+                    victim.tasks[p].pop_front();
+                    queued_[p].fetch_sub(1);
+                    if (isWorker)
+                        stolen_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void TaskScheduler::execute(Task &task)
+    {
+        try
+        {
+            task();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[TaskScheduler] ⚠️ tâche : " << e.what() << "\n";
+        }
+        catch (...)
+        {
+            std::cerr << "[TaskScheduler] ⚠️ tâche : exception inconnue\n";
+        }
+        executed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool TaskScheduler::runOne()
+    {
+        const bool isWorker = onWorkerThread();
+        const std::size_t self = isWorker ? tlsIndex : nextQueue_.load(std::memory_order_relaxed);
+
+        Task task;
+        if (queues_.empty() || !tryPop(self % queues_.size(), isWorker, task))
+            return false;
+        execute(task);
+        return true;
+    }
+
+    void TaskScheduler::workerLoop(std::size_t index)
+    {
+        tlsScheduler = this;
+        tlsIndex = index;
+
+        for (;;)
+        {
+            Task task;
+            if (tryPop(index, true, task))
+            {
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            ++sleepers_;
+            sleepCv_.wait(lock, [this]
+                          { return stopping_ || queued_[0].load() + queued_[1].load() > 0; });
+            --sleepers_;
+            if (stopping_ && queued_[0].load() + queued_[1].load() == 0)
+                return;
+        }
+    }
+
+    void TaskScheduler::runChunks(std::size_t chunks, const std::function<void(std::size_t)> &fn,
+                                  const ParallelOptions &options)
+    {
+        if (chunks == 0)
+            return;
+
+        const std::size_t participants = std::min<std::size_t>(
+            {chunks, options.maxWorkers ? options.maxWorkers : cores_, workers_.size() + 1});
+        if (participants <= 1)
+        {
+            for (std::size_t c = 0; c < chunks; ++c)
+                fn(c);
+            return;
+        }
+
+        auto job = std::make_shared<ForkJoin>();
+        job->fn = &fn;
+        job->chunks = chunks;
+        for (std::size_t h = 1; h < participants; ++h)
+            post([job]
+                 { job->drain(); },
+                 options.priority);
+
+        job->drain();
+        for (std::size_t d; (d = job->done.load(std::memory_order_acquire)) < chunks;)
+            job->done.wait(d, std::memory_order_acquire);
+
+        if (job->error)
+            std::rethrow_exception(job->error);
+    }
+
+    SchedulerStats TaskScheduler::stats() const
+    {
+        SchedulerStats s;
+        s.workers = workerCount();
+        s.cores = cores_;
+        s.submitted = submitted_.load(std::memory_order_relaxed);
+        s.executed = executed_.load(std::memory_order_relaxed);
+        s.stolen = stolen_.load(std::memory_order_relaxed);
+        s.queuedInteractive = queued_[0].load();
+        s.queuedBackground = queued_[1].load();
+        return s;
+    }
+
+    TaskScheduler &TaskScheduler::shared()
+    {
+        static TaskScheduler instance([]
+                                      {
+            SchedulerOptions o;
+            if (const char *env = std::getenv("SA_WORKER_THREADS"))
+                o.workers = static_cast<unsigned>(std::strtoul(env, nullptr, 10));
+            if (const char *env = std::getenv("SA_PIN_WORKERS"))
+                o.pinWorkers = std::string_view(env) == "1";
+            return o; }());
+        return instance;
+    }
+}
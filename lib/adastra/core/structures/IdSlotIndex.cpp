@@ -0,0 +1,67 @@
+#include <adastra/core/structures/IdSlotIndex.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace adastra::core::structures
+{
+    namespace
+    {
+        // Au-delà de ce facteur entre l'id max et le nombre d'ids, la table directe
+        // gaspille trop de mémoire et on passe en table de hachage.
+        constexpr std::uint64_t kMaxDenseFactor = 4;
+        constexpr std::uint64_t kDenseSlack = 1024;
+    }
+
+    IdSlotIndex::IdSlotIndex(const std::vector<std::uint64_t> &ids)
+    {
+        std::uint64_t maxId = 0;
+        for (auto id : ids)
+            maxId = std::max(maxId, id);
+
+        sparse_ = maxId > kMaxDenseFactor * ids.size() + kDenseSlack;
+
+        if (!sparse_)
+        {
+            dense_.assign(static_cast<std::size_t>(maxId) + 1, npos);
+            for (std::size_t slot = 0; slot < ids.size(); ++slot)
+            {
+                const auto id = ids[slot];
+                if (id == 0)
+                    continue;
+                if (dense_[id] != npos)
+                {
+                    ++duplicates_;
+                    continue;
+                }
+                dense_[id] = static_cast<std::uint32_t>(slot);
+                ++size_;
+            }
+            return;
+        }
+
+        // Taux de remplissage <= 50 %.
+        const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(16, ids.size() * 2));
+        table_.assign(capacity, Entry{});
+        mask_ = capacity - 1;
+
+        for (std::size_t slot = 0; slot < ids.size(); ++slot)
+        {
+            const auto id = ids[slot];
+            if (id == 0)
+                continue;
+
+            std::size_t i = mix(id) & mask_;
+            while (table_[i].id != 0 && table_[i].id != id)
+                i = (i + 1) & mask_;
+
+            if (table_[i].id == id)
+            {
+                ++duplicates_;
+                continue;
+            }
+            table_[i] = Entry{id, static_cast<std::uint32_t>(slot)};
+            ++size_;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <adastra/crypto/encryption/AESCipher.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#if defined(SA_HAS_OPENSSL)
+#include <openssl/evp.h>
+#endif
+
+namespace adastra::crypto::encryption
+{
+#if defined(SA_HAS_OPENSSL)
+    namespace
+    {
+        EVP_CIPHER_CTX *ctx(void *p) { return static_cast<EVP_CIPHER_CTX *>(p); }
+
+        // EVP travaille en int : on découpe les très gros messages.
+        constexpr std::size_t kMaxUpdate = 1u << 30;
+
+        void check(int ok, const char *what)
+        {
+            if (ok != 1)
+                throw std::runtime_error(std::string("AESCipher: ") + what + " a échoué");
+        }
+    }
+
+    AESCipher::AESCipher(std::span<const std::uint8_t> key)
+    {
+        if (key.size() != kKeySize)
+            throw std::invalid_argument("AESCipher: la clé doit faire 32 octets");
+
+        enc_ = EVP_CIPHER_CTX_new();
+        dec_ = EVP_CIPHER_CTX_new();
+        if (!enc_ || !dec_)
+        {
+            EVP_CIPHER_CTX_free(ctx(enc_));
+            EVP_CIPHER_CTX_free(ctx(dec_));
+            throw std::runtime_error("AESCipher: EVP_CIPHER_CTX_new a échoué");
+        }
+
+        // Clé posée une fois ; chaque message ne refournit que le nonce.
+        check(EVP_EncryptInit_ex(ctx(enc_), EVP_aes_256_gcm(), nullptr, nullptr, nullptr), "EncryptInit");
+        check(EVP_CIPHER_CTX_ctrl(ctx(enc_), EVP_CTRL_GCM_SET_IVLEN, kNonceSize, nullptr), "SET_IVLEN");
+        check(EVP_EncryptInit_ex(ctx(enc_), nullptr, nullptr, key.data(), nullptr), "EncryptInit(key)");
+
+        check(EVP_DecryptInit_ex(ctx(dec_), EVP_aes_256_gcm(), nullptr, nullptr, nullptr), "DecryptInit");
+        check(EVP_CIPHER_CTX_ctrl(ctx(dec_), EVP_CTRL_GCM_SET_IVLEN, kNonceSize, nullptr), "SET_IVLEN");
+        check(EVP_DecryptInit_ex(ctx(dec_), nullptr, nullptr, key.data(), nullptr), "DecryptInit(key)");
+    }
+
+    AESCipher::~AESCipher()
+    {
+        EVP_CIPHER_CTX_free(ctx(enc_));
+        EVP_CIPHER_CTX_free(ctx(dec_));
+    }
+
+    void AESCipher::encrypt(const Nonce &nonce, std::span<const std::uint8_t> aad,
+                            std::span<const std::uint8_t> plain, std::uint8_t *out, Tag &tag)
+    {
+        EVP_CIPHER_CTX *c = ctx(enc_);
+        check(EVP_EncryptInit_ex(c, nullptr, nullptr, nullptr, nonce.data()), "EncryptInit(nonce)");
+
+        int n = 0;
+        if (!aad.empty())
+            check(EVP_EncryptUpdate(c, nullptr, &n, aad.data(), static_cast<int>(aad.size())), "EncryptUpdate(aad)");
+
+        for (std::size_t off = 0; off < plain.size(); off += kMaxUpdate)
+        {
+            const int len = static_cast<int>(std::min(kMaxUpdate, plain.size() - off));
+            check(EVP_EncryptUpdate(c, out + off, &n, plain.data() + off, len), "EncryptUpdate");
+        }
+        check(EVP_EncryptFinal_ex(c, out + plain.size(), &n), "EncryptFinal");
+        check(EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_GET_TAG, kTagSize, tag.data()), "GET_TAG");
+    }
+
+    bool AESCipher::decrypt(const Nonce &nonce, std::span<const std::uint8_t> aad,
+                            std::span<const std::uint8_t> cipher, const Tag &tag, std::uint8_t *out)
+    {
+        EVP_CIPHER_CTX *c = ctx(dec_);
+        check(EVP_DecryptInit_ex(c, nullptr, nullptr, nullptr, nonce.data()), "DecryptInit(nonce)");
+
+        int n = 0;
+        if (!aad.empty())
+            check(EVP_DecryptUpdate(c, nullptr, &n, aad.data(), static_cast<int>(aad.size())), "DecryptUpdate(aad)");
+
+        for (std::size_t off = 0; off < cipher.size(); off += kMaxUpdate)
+        {
+            const int len = static_cast<int>(std::min(kMaxUpdate, cipher.size() - off));
+            check(EVP_DecryptUpdate(c, out + off, &n, cipher.data() + off, len), "DecryptUpdate");
+        }
+
+        Tag expected = tag; // EVP veut un pointeur non const
+        check(EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_SET_TAG, kTagSize, expected.data()), "SET_TAG");
+        return EVP_DecryptFinal_ex(c, out + cipher.size(), &n) == 1;
+    }
+#else
+    AESCipher::AESCipher(std::span<const std::uint8_t>)
+    {
+        throw std::runtime_error("AESCipher: compilé sans OpenSSL (SA_WITH_OPENSSL)");
+    }
+
+    AESCipher::~AESCipher() = default;
+
+    void AESCipher::encrypt(const Nonce &, std::span<const std::uint8_t>, std::span<const std::uint8_t>,
+                            std::uint8_t *, Tag &)
+    {
+        throw std::runtime_error("AESCipher: compilé sans OpenSSL");
+    }
+
+    bool AESCipher::decrypt(const Nonce &, std::span<const std::uint8_t>, std::span<const std::uint8_t>,
+                            const Tag &, std::uint8_t *)
+    {
+        throw std::runtime_error("AESCipher: compilé sans OpenSSL");
+    }
+#endif
+}
@@ -0,0 +1,316 @@
+#include <adastra/crypto/encryption/FileEncryption.hpp>
+#include <adastra/crypto/random/RandomByters.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <unistd.h>
+
+namespace adastra::crypto::encryption
+{
+    namespace
+    {
+        constexpr char kMagic[8] = {'S', 'A', 'G', 'C', 'M', 'v', '1', '\0'};
+
+        void put32le(std::uint8_t *p, std::uint32_t v)
+        {
+            for (int i = 0; i < 4; ++i)
+                p[i] = static_cast<std::uint8_t>(v >> (8 * i));
+        }
+
+        std::uint32_t get32le(const std::uint8_t *p)
+        {
+            return std::uint32_t(p[0]) | (std::uint32_t(p[1]) << 8) | (std::uint32_t(p[2]) << 16) | (std::uint32_t(p[3]) << 24);
+        }
+
+        std::size_t readFull(const FileEncryptor::Source &source, std::uint8_t *out, std::size_t size)
+        {
+            std::size_t got = 0;
+            while (got < size)
+            {
+                const std::size_t n = source(out + got, size - got);
+                if (n == 0)
+                    break;
+                got += n;
+            }
+            return got;
+        }
+
+        enum class SlotState
+        {
+            Free,   // le lecteur peut le remplir
+            Filled, // clair prêt à chiffrer
+            Sealed  // enregistrement prêt à écrire
+        };
+
+        struct Slot
+        {
+            std::vector<std::uint8_t> plain;
+            std::vector<std::uint8_t> record; // nonce | chiffré | tag
+            std::size_t length = 0;
+            std::uint64_t index = 0;
+            bool final = false;
+            SlotState state = SlotState::Free;
+        };
+    }
+
+    // ------------------------------------------------------------------ ContainerHeader
+
+    std::array<std::uint8_t, ContainerHeader::kSize> ContainerHeader::serialize() const
+    {
+        std::array<std::uint8_t, kSize> out{};
+        std::memcpy(out.data(), kMagic, sizeof(kMagic));
+        put32le(out.data() + 8, blockSize);
+        std::memcpy(out.data() + 16, fileId.data(), fileId.size());
+        return out;
+    }
+
+    ContainerHeader ContainerHeader::parse(std::span<const std::uint8_t> bytes)
+    {
+        if (bytes.size() < kSize || std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0)
+            throw std::runtime_error("ContainerHeader: format inconnu");
+
+        ContainerHeader h;
+        h.blockSize = get32le(bytes.data() + 8);
+        if (!validBlockSize(h.blockSize))
+            throw std::runtime_error("ContainerHeader: blockSize invalide " + std::to_string(h.blockSize));
+        std::memcpy(h.fileId.data(), bytes.data() + 16, h.fileId.size());
+        return h;
+    }
+
+    std::vector<std::uint8_t> ContainerHeader::aad(std::uint64_t index, bool final) const
+    {
+        const auto header = serialize();
+        std::vector<std::uint8_t> out(header.begin(), header.end());
+        for (int i = 7; i >= 0; --i)
+            out.push_back(static_cast<std::uint8_t>(index >> (8 * i)));
+        out.push_back(final ? 1 : 0);
+        return out;
+    }
+
+    // ------------------------------------------------------------------ FileEncryptor
+
+    FileEncryptor::FileEncryptor(std::span<const std::uint8_t> key, EncryptionOptions options)
+        : options_(options)
+    {
+        if (key.size() != key_.size())
+            throw std::invalid_argument("FileEncryptor: la clé doit faire 32 octets");
+        if (!ContainerHeader::validBlockSize(options_.blockSize))
+            throw std::invalid_argument("FileEncryptor: blockSize invalide (puissance de deux <= 8 Mio)");
+
+        std::copy(key.begin(), key.end(), key_.begin());
+        options_.workers = std::max(1u, options_.workers);
+        options_.queueDepth = std::max<std::size_t>(2, options_.queueDepth);
+    }
+
+    FileEncryptor::~FileEncryptor()
+    {
+        std::fill(key_.begin(), key_.end(), std::uint8_t{0});
+    }
+
+    EncryptionStats FileEncryptor::encrypt(const Source &source, const Sink &sink) const
+    {
+        ContainerHeader header;
+        header.blockSize = static_cast<std::uint32_t>(options_.blockSize);
+        adastra::crypto::random::RandomBytes::fill(header.fileId.data(), header.fileId.size());
+
+        const auto headerBytes = header.serialize();
+        sink(headerBytes.data(), headerBytes.size());
+
+        const std::size_t blockSize = options_.blockSize;
+        std::vector<Slot> slots(options_.queueDepth);
+        for (auto &s : slots)
+        {
+            s.plain.resize(blockSize);
+            s.record.resize(blockSize + ContainerHeader::kRecordOverhead);
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::uint64_t total = std::numeric_limits<std::uint64_t>::max(); // connu au bloc final
+        std::uint64_t nextToEncrypt = 0;
+        std::exception_ptr error;
+
+        auto fail = [&](std::exception_ptr e)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+                error = e;
+            cv.notify_all();
+        };
+
+        // Étage 1 : lecture. Un bloc court (éventuellement vide) termine le flux.
+        std::thread reader([&]
+                           {
+            try
+            {
+                for (std::uint64_t i = 0;; ++i)
+                {
+                    Slot &s = slots[i % slots.size()];
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [&] { return error || s.state == SlotState::Free; });
+                        if (error)
+                            return;
+                    }
+
+                    s.length = readFull(source, s.plain.data(), blockSize);
+                    s.index = i;
+                    s.final = s.length < blockSize;
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    s.state = SlotState::Filled;
+                    if (s.final)
+                        total = i + 1;
+                    cv.notify_all();
+                    if (s.final)
+                        return;
+                }
+            }
+            catch (...)
+            {
+                fail(std::current_exception());
+            } });
+
+        // Étage 2 : chiffrement, un contexte AES par thread.
+        std::vector<std::thread> workers;
+        for (unsigned w = 0; w < options_.workers; ++w)
+        {
+            workers.emplace_back([&]
+                                 {
+                try
+                {
+                    AESCipher cipher(key_);
+                    for (;;)
+                    {
+                        Slot *s = nullptr;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            cv.wait(lock, [&] {
+                                if (error || nextToEncrypt >= total)
+                                    return true;
+                                const Slot &next = slots[nextToEncrypt % slots.size()];
+                                return next.state == SlotState::Filled && next.index == nextToEncrypt; });
+                            if (error || nextToEncrypt >= total)
+                                return;
+                            s = &slots[nextToEncrypt++ % slots.size()];
+                        }
+
+                        AESCipher::Nonce nonce;
+                        adastra::crypto::random::RandomBytes::fill(nonce.data(), nonce.size());
+                        AESCipher::Tag tag;
+                        cipher.encrypt(nonce, header.aad(s->index, s->final),
+                                       {s->plain.data(), s->length},
+                                       s->record.data() + AESCipher::kNonceSize, tag);
+                        std::memcpy(s->record.data(), nonce.data(), nonce.size());
+                        std::memcpy(s->record.data() + AESCipher::kNonceSize + s->length, tag.data(), tag.size());
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        s->state = SlotState::Sealed;
+                        cv.notify_all();
+                    }
+                }
+                catch (...)
+                {
+                    fail(std::current_exception());
+                } });
+        }
+
+        // Étage 3 : écriture dans l'ordre, sur le thread appelant.
+        EncryptionStats stats;
+        try
+        {
+            for (std::uint64_t i = 0;; ++i)
+            {
+                Slot &s = slots[i % slots.size()];
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&]
+                            { return error || i >= total || (s.state == SlotState::Sealed && s.index == i); });
+                    if (error || i >= total)
+                        break;
+                }
+
+                sink(s.record.data(), s.length + ContainerHeader::kRecordOverhead);
+                stats.plainBytes += s.length;
+                ++stats.blocks;
+
+                std::lock_guard<std::mutex> lock(mutex);
+                s.state = SlotState::Free;
+                cv.notify_all();
+            }
+        }
+        catch (...)
+        {
+            fail(std::current_exception());
+        }
+
+        reader.join();
+        for (auto &w : workers)
+            w.join();
+        for (auto &s : slots)
+            std::fill(s.plain.begin(), s.plain.end(), std::uint8_t{0});
+
+        if (error)
+            std::rethrow_exception(error);
+        return stats;
+    }
+
+    EncryptionStats FileEncryptor::encryptFile(const std::string &in, const std::string &out) const
+    {
+        std::FILE *src = std::fopen(in.c_str(), "rb");
+        if (!src)
+            throw std::runtime_error("FileEncryptor: impossible d'ouvrir " + in);
+
+        const std::string part = out + ".part";
+        std::FILE *dst = std::fopen(part.c_str(), "wb");
+        if (!dst)
+        {
+            std::fclose(src);
+            throw std::runtime_error("FileEncryptor: impossible de créer " + part);
+        }
+
+        EncryptionStats stats;
+        try
+        {
+            stats = encrypt(
+                [&](std::uint8_t *buf, std::size_t size)
+                {
+                    const std::size_t n = std::fread(buf, 1, size, src);
+                    if (n < size && std::ferror(src))
+                        throw std::runtime_error("FileEncryptor: erreur de lecture de " + in);
+                    return n;
+                },
+                [&](const std::uint8_t *data, std::size_t size)
+                {
+                    if (std::fwrite(data, 1, size, dst) != size)
+                        throw std::runtime_error("FileEncryptor: erreur d'écriture de " + part);
+                });
+
+            if (std::fflush(dst) != 0 || ::fsync(::fileno(dst)) != 0)
+                throw std::runtime_error("FileEncryptor: fsync de " + part + " a échoué");
+        }
+        catch (...)
+        {
+            std::fclose(src);
+            std::fclose(dst);
+            std::remove(part.c_str());
+            throw;
+        }
+
+        std::fclose(src);
+        if (std::fclose(dst) != 0 || std::rename(part.c_str(), out.c_str()) != 0)
+        {
+            std::remove(part.c_str());
+            throw std::runtime_error("FileEncryptor: impossible de finaliser " + out);
+        }
+        return stats;
+    }
+}
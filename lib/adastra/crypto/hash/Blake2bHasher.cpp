@@ -0,0 +1,296 @@
+#include <adastra/crypto/hash/Blake2bHasher.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SA_BLAKE2B_X86 1
+#include <immintrin.h>
+#endif
+
+namespace adastra::crypto::hash
+{
+    namespace
+    {
+        using Compress = void (*)(std::uint64_t h[8], const std::uint8_t *block,
+                                  std::uint64_t t0, std::uint64_t t1, bool last);
+
+        constexpr std::uint64_t kIv[8] = {
+            0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+            0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL};
+
+        constexpr std::uint8_t kSigma[12][16] = {
+            {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+            {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+            {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+            {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+            {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+            {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+            {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+            {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+            {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+            {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+            {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+            {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+        inline std::uint64_t load64le(const std::uint8_t *p)
+        {
+            std::uint64_t v = 0;
+            for (int i = 7; i >= 0; --i)
+                v = (v << 8) | p[i];
+            return v;
+        }
+
+        inline std::uint64_t rotr64(std::uint64_t v, int n) { return (v >> n) | (v << (64 - n)); }
+
+        // ---------------------------------------------------------------- portable
+
+        void compressPortable(std::uint64_t h[8], const std::uint8_t *block,
+                              std::uint64_t t0, std::uint64_t t1, bool last)
+        {
+            std::uint64_t m[16], v[16];
+            for (int i = 0; i < 16; ++i)
+                m[i] = load64le(block + i * 8);
+            for (int i = 0; i < 8; ++i)
+            {
+                v[i] = h[i];
+                v[i + 8] = kIv[i];
+            }
+            v[12] ^= t0;
+            v[13] ^= t1;
+            if (last)
+                v[14] = ~v[14];
+
+            auto g = [&](int a, int b, int c, int d, std::uint64_t x, std::uint64_t y)
+            {
+                v[a] = v[a] + v[b] + x;
+                v[d] = rotr64(v[d] ^ v[a], 32);
+                v[c] = v[c] + v[d];
+                v[b] = rotr64(v[b] ^ v[c], 24);
+                v[a] = v[a] + v[b] + y;
+                v[d] = rotr64(v[d] ^ v[a], 16);
+                v[c] = v[c] + v[d];
+                v[b] = rotr64(v[b] ^ v[c], 63);
+            };
+
+            for (int r = 0; r < 12; ++r)
+            {
+                const std::uint8_t *s = kSigma[r];
+                g(0, 4, 8, 12, m[s[0]], m[s[1]]);
+                g(1, 5, 9, 13, m[s[2]], m[s[3]]);
+                g(2, 6, 10, 14, m[s[4]], m[s[5]]);
+                g(3, 7, 11, 15, m[s[6]], m[s[7]]);
+                g(0, 5, 10, 15, m[s[8]], m[s[9]]);
+                g(1, 6, 11, 12, m[s[10]], m[s[11]]);
+                g(2, 7, 8, 13, m[s[12]], m[s[13]]);
+                g(3, 4, 9, 14, m[s[14]], m[s[15]]);
+            }
+
+            for (int i = 0; i < 8; ++i)
+                h[i] ^= v[i] ^ v[i + 8];
+        }
+
+#if SA_BLAKE2B_X86
+        // ---------------------------------------------------------------- AVX2
+        // Une ligne de la matrice 4x4 par registre : les 4 G d'une demi-ronde
+        // s'exécutent ensemble, les diagonales s'obtiennent par permutation.
+
+        __attribute__((target("avx2"))) inline __m256i rotr24(__m256i v)
+        {
+            const __m256i m = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                               3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+            return _mm256_shuffle_epi8(v, m);
+        }
+
+        __attribute__((target("avx2"))) inline __m256i rotr16(__m256i v)
+        {
+            const __m256i m = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                               2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+            return _mm256_shuffle_epi8(v, m);
+        }
+
+        __attribute__((target("avx2"))) inline void g4(__m256i &a, __m256i &b, __m256i &c, __m256i &d, __m256i x, __m256i y)
+        {
+            a = _mm256_add_epi64(_mm256_add_epi64(a, b), x);
+            d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), _MM_SHUFFLE(2, 3, 0, 1)); // rotr 32
+            c = _mm256_add_epi64(c, d);
+            b = rotr24(_mm256_xor_si256(b, c));
+            a = _mm256_add_epi64(_mm256_add_epi64(a, b), y);
+            d = rotr16(_mm256_xor_si256(d, a));
+            c = _mm256_add_epi64(c, d);
+            b = _mm256_xor_si256(b, c);
+            b = _mm256_or_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b)); // rotr 63
+        }
+
+        // Mots du message s[i0], s[i1], s[i2], s[i3] de la ronde, dans cet ordre.
+        __attribute__((target("avx2"))) inline __m256i pick(const std::uint64_t m[16], const std::uint8_t *s,
+                                                            int i0, int i1, int i2, int i3)
+        {
+            return _mm256_set_epi64x(static_cast<long long>(m[s[i3]]), static_cast<long long>(m[s[i2]]),
+                                     static_cast<long long>(m[s[i1]]), static_cast<long long>(m[s[i0]]));
+        }
+
+        __attribute__((target("avx2"))) void compressAvx2(std::uint64_t h[8], const std::uint8_t *block,
+                                                          std::uint64_t t0, std::uint64_t t1, bool last)
+        {
+            std::uint64_t m[16];
+            std::memcpy(m, block, sizeof(m)); // x86 : little-endian
+
+            const __m256i h0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(h));
+            const __m256i h1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(h + 4));
+            __m256i a = h0;
+            __m256i b = h1;
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(kIv));
+            __m256i d = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(kIv + 4)),
+                                         _mm256_set_epi64x(0, last ? -1 : 0, static_cast<long long>(t1), static_cast<long long>(t0)));
+
+            for (int r = 0; r < 12; ++r)
+            {
+                const std::uint8_t *s = kSigma[r];
+
+                g4(a, b, c, d, pick(m, s, 0, 2, 4, 6), pick(m, s, 1, 3, 5, 7));
+
+                // Diagonales : décale les lignes b, c, d de 1, 2, 3 colonnes.
+                b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+                c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+                d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+
+                g4(a, b, c, d, pick(m, s, 8, 10, 12, 14), pick(m, s, 9, 11, 13, 15));
+
+                b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+                c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+                d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(h), _mm256_xor_si256(h0, _mm256_xor_si256(a, c)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(h + 4), _mm256_xor_si256(h1, _mm256_xor_si256(b, d)));
+        }
+#endif
+
+        bool useAvx2()
+        {
+#if SA_BLAKE2B_X86
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+        }
+
+        Compress compressFn()
+        {
+#if SA_BLAKE2B_X86
+            static const Compress c = useAvx2() ? compressAvx2 : compressPortable;
+#else
+            static const Compress c = compressPortable;
+#endif
+            return c;
+        }
+    }
+
+    Blake2bHasher::Blake2bHasher(std::size_t digestSize, std::span<const std::uint8_t> key)
+        : digestSize_(digestSize), keySize_(key.size())
+    {
+        if (digestSize == 0 || digestSize > kMaxDigestSize)
+            throw std::invalid_argument("Blake2bHasher: taille d'empreinte hors de [1, 64]");
+        if (key.size() > kMaxKeySize)
+            throw std::invalid_argument("Blake2bHasher: clé de plus de 64 octets");
+
+        std::copy(key.begin(), key.end(), key_);
+        reset();
+    }
+
+    void Blake2bHasher::reset()
+    {
+        std::memcpy(h_, kIv, sizeof(h_));
+        h_[0] ^= 0x01010000ULL ^ (static_cast<std::uint64_t>(keySize_) << 8) ^ digestSize_;
+        t_[0] = t_[1] = 0;
+        buffered_ = 0;
+
+        // Avec une clé, le premier bloc est la clé complétée par des zéros.
+        if (keySize_ > 0)
+        {
+            std::memset(buffer_, 0, kBlockSize);
+            std::memcpy(buffer_, key_, keySize_);
+            buffered_ = kBlockSize;
+        }
+    }
+
+    Blake2bHasher &Blake2bHasher::update(const void *data, std::size_t size)
+    {
+        auto *p = static_cast<const std::uint8_t *>(data);
+        const Compress compress = compressFn();
+
+        // Le dernier bloc est gardé en tampon : il doit être compressé avec le
+        // drapeau de fin, on ne sait qu'il est le dernier qu'au finalize().
+        while (size > 0)
+        {
+            if (buffered_ == kBlockSize)
+            {
+                t_[0] += kBlockSize;
+                if (t_[0] < kBlockSize)
+                    ++t_[1];
+                compress(h_, buffer_, t_[0], t_[1], false);
+                buffered_ = 0;
+            }
+
+            // Chemin direct : blocs complets lus dans l'entrée, sauf le dernier.
+            while (buffered_ == 0 && size > kBlockSize)
+            {
+                t_[0] += kBlockSize;
+                if (t_[0] < kBlockSize)
+                    ++t_[1];
+                compress(h_, p, t_[0], t_[1], false);
+                p += kBlockSize;
+                size -= kBlockSize;
+            }
+
+            const std::size_t n = std::min(size, kBlockSize - buffered_);
+            std::memcpy(buffer_ + buffered_, p, n);
+            buffered_ += n;
+            p += n;
+            size -= n;
+        }
+        return *this;
+    }
+
+    void Blake2bHasher::finalize(std::span<std::uint8_t> out)
+    {
+        if (out.size() < digestSize_)
+            throw std::invalid_argument("Blake2bHasher::finalize: sortie trop petite");
+
+        t_[0] += buffered_;
+        if (t_[0] < buffered_)
+            ++t_[1];
+        std::memset(buffer_ + buffered_, 0, kBlockSize - buffered_);
+        compressFn()(h_, buffer_, t_[0], t_[1], true);
+
+        for (std::size_t i = 0; i < digestSize_; ++i)
+            out[i] = static_cast<std::uint8_t>(h_[i / 8] >> (8 * (i % 8)));
+        reset();
+    }
+
+    std::vector<std::uint8_t> Blake2bHasher::finalize()
+    {
+        std::vector<std::uint8_t> out(digestSize_);
+        finalize(out);
+        return out;
+    }
+
+    std::vector<std::uint8_t> Blake2bHasher::hash(std::string_view data, std::size_t digestSize)
+    {
+        Blake2bHasher h(digestSize);
+        h.update(data);
+        return h.finalize();
+    }
+
+    const char *Blake2bHasher::backend()
+    {
+#if SA_BLAKE2B_X86
+        return compressFn() == compressAvx2 ? "avx2" : "portable";
+#else
+        return "portable";
+#endif
+    }
+}
@@ -0,0 +1,70 @@
+#include <adastra/crypto/hash/HashUtils.hpp>
+#include <adastra/crypto/hash/Blake2bHasher.hpp>
+#include <adastra/crypto/hash/SHA256Hasher.hpp>
+
+namespace adastra::crypto::hash
+{
+    namespace
+    {
+        int hexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            return -1;
+        }
+    }
+
+    std::string toHex(std::span<const std::uint8_t> bytes)
+    {
+        static constexpr char digits[] = "0123456789abcdef";
+        std::string out(bytes.size() * 2, '\0');
+        for (std::size_t i = 0; i < bytes.size(); ++i)
+        {
+            out[i * 2] = digits[bytes[i] >> 4];
+            out[i * 2 + 1] = digits[bytes[i] & 0xF];
+        }
+        return out;
+    }
+
+    std::optional<std::vector<std::uint8_t>> fromHex(std::string_view hex)
+    {
+        if (hex.size() % 2 != 0)
+            return std::nullopt;
+
+        std::vector<std::uint8_t> out(hex.size() / 2);
+        for (std::size_t i = 0; i < out.size(); ++i)
+        {
+            const int hi = hexValue(hex[i * 2]);
+            const int lo = hexValue(hex[i * 2 + 1]);
+            if (hi < 0 || lo < 0)
+                return std::nullopt;
+            out[i] = static_cast<std::uint8_t>((hi << 4) | lo);
+        }
+        return out;
+    }
+
+    bool constantTimeEquals(std::span<const std::uint8_t> a, std::span<const std::uint8_t> b)
+    {
+        if (a.size() != b.size())
+            return false;
+
+        volatile std::uint8_t diff = 0;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            diff = static_cast<std::uint8_t>(diff | (a[i] ^ b[i]));
+        return diff == 0;
+    }
+
+    std::string sha256Hex(std::string_view data)
+    {
+        return toHex(SHA256Hasher::hash(data));
+    }
+
+    std::string blake2bHex(std::string_view data, std::size_t digestSize)
+    {
+        return toHex(Blake2bHasher::hash(data, digestSize));
+    }
+}
@@ -0,0 +1,47 @@
+#include <adastra/crypto/hash/HmacSha256.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace adastra::crypto::hash
+{
+    HmacSha256::HmacSha256(std::span<const std::uint8_t> key)
+    {
+        std::array<std::uint8_t, SHA256Hasher::kBlockSize> block{};
+        if (key.size() > block.size())
+        {
+            const auto d = SHA256Hasher::hash(key.data(), key.size());
+            std::copy(d.begin(), d.end(), block.begin());
+        }
+        else
+            std::copy(key.begin(), key.end(), block.begin());
+
+        std::array<std::uint8_t, SHA256Hasher::kBlockSize> pad;
+        for (std::size_t i = 0; i < pad.size(); ++i)
+            pad[i] = block[i] ^ 0x36;
+        inner_.update(pad.data(), pad.size());
+
+        for (std::size_t i = 0; i < pad.size(); ++i)
+            pad[i] = block[i] ^ 0x5c;
+        outer_.update(pad.data(), pad.size());
+
+        std::fill(block.begin(), block.end(), 0);
+        std::fill(pad.begin(), pad.end(), 0);
+    }
+
+    HmacSha256::Digest HmacSha256::mac(const void *data, std::size_t size) const
+    {
+        SHA256Hasher inner = inner_;
+        const Digest h = inner.update(data, size).finalize();
+
+        SHA256Hasher outer = outer_;
+        return outer.update(h.data(), h.size()).finalize();
+    }
+
+    bool HmacSha256::verify(std::string_view data, std::span<const std::uint8_t> expected) const
+    {
+        const Digest d = mac(data);
+        return constantTimeEquals(d, expected);
+    }
+}
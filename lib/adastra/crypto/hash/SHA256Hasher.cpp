@@ -0,0 +1,452 @@
+#include <adastra/crypto/hash/SHA256Hasher.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SA_SHA256_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace adastra::crypto::hash
+{
+    namespace
+    {
+        using Compress = void (*)(std::uint32_t state[8], const std::uint8_t *blocks, std::size_t count);
+
+        constexpr std::uint32_t kInit[8] = {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+        alignas(16) constexpr std::uint32_t K[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+        inline std::uint32_t load32be(const std::uint8_t *p)
+        {
+            return (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) | (std::uint32_t(p[2]) << 8) | p[3];
+        }
+
+        inline void store32be(std::uint8_t *p, std::uint32_t v)
+        {
+            p[0] = static_cast<std::uint8_t>(v >> 24);
+            p[1] = static_cast<std::uint8_t>(v >> 16);
+            p[2] = static_cast<std::uint8_t>(v >> 8);
+            p[3] = static_cast<std::uint8_t>(v);
+        }
+
+        inline std::uint32_t rotr(std::uint32_t v, int n) { return (v >> n) | (v << (32 - n)); }
+
+        // ---------------------------------------------------------------- portable
+
+        void compressPortable(std::uint32_t state[8], const std::uint8_t *blocks, std::size_t count)
+        {
+            for (; count > 0; --count, blocks += SHA256Hasher::kBlockSize)
+            {
+                std::uint32_t w[64];
+                for (int i = 0; i < 16; ++i)
+                    w[i] = load32be(blocks + i * 4);
+                for (int i = 16; i < 64; ++i)
+                {
+                    const std::uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                    const std::uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+
+                std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+                std::uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+                for (int i = 0; i < 64; ++i)
+                {
+                    const std::uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+                    const std::uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                    h = g, g = f, f = e, e = d + t1;
+                    d = c, c = b, b = a, a = t1 + t2;
+                }
+
+                state[0] += a, state[1] += b, state[2] += c, state[3] += d;
+                state[4] += e, state[5] += f, state[6] += g, state[7] += h;
+            }
+        }
+
+#if SA_SHA256_X86
+        // ---------------------------------------------------------------- SHA-NI
+        // L'état est gardé sous la forme ABEF / CDGH attendue par sha256rnds2.
+
+        __attribute__((target("sha,ssse3,sse4.1"))) void compressShaNi(std::uint32_t state[8], const std::uint8_t *blocks, std::size_t count)
+        {
+            const __m128i swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+            __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state));
+            __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4));
+            tmp = _mm_shuffle_epi32(tmp, 0xB1);            // CDAB
+            state1 = _mm_shuffle_epi32(state1, 0x1B);      // EFGH
+            __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+            state1 = _mm_blend_epi16(state1, tmp, 0xF0);      // CDGH
+
+            for (; count > 0; --count, blocks += SHA256Hasher::kBlockSize)
+            {
+                const __m128i abef = state0;
+                const __m128i cdgh = state1;
+
+                __m128i w[4];
+                for (int i = 0; i < 16; ++i)
+                {
+                    __m128i &cur = w[i & 3];
+                    if (i < 4)
+                    {
+                        cur = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + i * 16)), swap);
+                    }
+                    else
+                    {
+                        // w[i] = σ1(w[i-1]) + w[i-7..] + σ0(w[i-4]) + w[i-4]
+                        const __m128i prev1 = w[(i - 1) & 3];
+                        const __m128i prev2 = w[(i - 2) & 3];
+                        __m128i next = _mm_sha256msg1_epu32(cur, w[(i - 3) & 3]);
+                        next = _mm_add_epi32(next, _mm_alignr_epi8(prev1, prev2, 4));
+                        cur = _mm_sha256msg2_epu32(next, prev1);
+                    }
+
+                    __m128i msg = _mm_add_epi32(cur, _mm_load_si128(reinterpret_cast<const __m128i *>(K + i * 4)));
+                    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                    msg = _mm_shuffle_epi32(msg, 0x0E);
+                    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                }
+
+                state0 = _mm_add_epi32(state0, abef);
+                state1 = _mm_add_epi32(state1, cdgh);
+            }
+
+            tmp = _mm_shuffle_epi32(state0, 0x1B);        // FEBA
+            state1 = _mm_shuffle_epi32(state1, 0xB1);     // DCHG
+            state0 = _mm_blend_epi16(tmp, state1, 0xF0);  // DCBA
+            state1 = _mm_alignr_epi8(state1, tmp, 8);     // ABEF
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(state), state0);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), state1);
+        }
+
+        // ---------------------------------------------------------------- AVX2, 8 voies
+        // Voie l = message l du groupe ; chaque registre porte le même mot des 8 états.
+
+        __attribute__((target("avx2"))) inline __m256i rotr8x(__m256i v, int n)
+        {
+            return _mm256_or_si256(_mm256_srli_epi32(v, n), _mm256_slli_epi32(v, 32 - n));
+        }
+
+        __attribute__((target("avx2"))) void compress8(__m256i s[8], const std::uint8_t *const lanes[8])
+        {
+            __m256i w[16];
+            for (int i = 0; i < 16; ++i)
+                w[i] = _mm256_setr_epi32(
+                    static_cast<int>(load32be(lanes[0] + i * 4)), static_cast<int>(load32be(lanes[1] + i * 4)),
+                    static_cast<int>(load32be(lanes[2] + i * 4)), static_cast<int>(load32be(lanes[3] + i * 4)),
+                    static_cast<int>(load32be(lanes[4] + i * 4)), static_cast<int>(load32be(lanes[5] + i * 4)),
+                    static_cast<int>(load32be(lanes[6] + i * 4)), static_cast<int>(load32be(lanes[7] + i * 4)));
+
+            __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+            for (int i = 0; i < 64; ++i)
+            {
+                __m256i wi;
+                if (i < 16)
+                {
+                    wi = w[i];
+                }
+                else
+                {
+                    const __m256i w15 = w[(i - 15) & 15];
+                    const __m256i w2 = w[(i - 2) & 15];
+                    const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr8x(w15, 7), rotr8x(w15, 18)), _mm256_srli_epi32(w15, 3));
+                    const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr8x(w2, 17), rotr8x(w2, 19)), _mm256_srli_epi32(w2, 10));
+                    wi = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], s0), _mm256_add_epi32(w[(i - 7) & 15], s1));
+                    w[i & 15] = wi;
+                }
+
+                const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(rotr8x(e, 6), rotr8x(e, 11)), rotr8x(e, 25));
+                const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, wi)),
+                                                    _mm256_set1_epi32(static_cast<int>(K[i])));
+                const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(rotr8x(a, 2), rotr8x(a, 13)), rotr8x(a, 22));
+                const __m256i maj = _mm256_xor_si256(_mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)), _mm256_and_si256(b, c));
+                h = g, g = f, f = e, e = _mm256_add_epi32(d, t1);
+                d = c, c = b, b = a, a = _mm256_add_epi32(t1, _mm256_add_epi32(S0, maj));
+            }
+
+            s[0] = _mm256_add_epi32(s[0], a), s[1] = _mm256_add_epi32(s[1], b);
+            s[2] = _mm256_add_epi32(s[2], c), s[3] = _mm256_add_epi32(s[3], d);
+            s[4] = _mm256_add_epi32(s[4], e), s[5] = _mm256_add_epi32(s[5], f);
+            s[6] = _mm256_add_epi32(s[6], g), s[7] = _mm256_add_epi32(s[7], h);
+        }
+#endif
+
+        // Fin de message (reste + 0x80 + zéros + longueur) : 1 ou 2 blocs.
+        struct Tail
+        {
+            std::uint8_t bytes[2 * SHA256Hasher::kBlockSize];
+            std::size_t blocks;
+        };
+
+        void buildTail(Tail &tail, const std::uint8_t *data, std::size_t size)
+        {
+            const std::size_t rem = size % SHA256Hasher::kBlockSize;
+            std::memset(tail.bytes, 0, sizeof(tail.bytes));
+            std::memcpy(tail.bytes, data + (size - rem), rem);
+            tail.bytes[rem] = 0x80;
+            tail.blocks = rem + 9 > SHA256Hasher::kBlockSize ? 2 : 1;
+
+            const std::uint64_t bits = static_cast<std::uint64_t>(size) * 8;
+            std::uint8_t *len = tail.bytes + tail.blocks * SHA256Hasher::kBlockSize - 8;
+            store32be(len, static_cast<std::uint32_t>(bits >> 32));
+            store32be(len + 4, static_cast<std::uint32_t>(bits));
+        }
+
+        void writeDigest(const std::uint32_t state[8], SHA256Hasher::Digest &out)
+        {
+            for (int i = 0; i < 8; ++i)
+                store32be(out.data() + i * 4, state[i]);
+        }
+
+        void hashOne(Compress compress, const std::uint8_t *data, std::size_t size, SHA256Hasher::Digest &out)
+        {
+            std::uint32_t state[8];
+            std::memcpy(state, kInit, sizeof(state));
+            compress(state, data, size / SHA256Hasher::kBlockSize);
+
+            Tail tail;
+            buildTail(tail, data, size);
+            compress(state, tail.bytes, tail.blocks);
+            writeDigest(state, out);
+        }
+
+        Sha256Backend detect()
+        {
+#if SA_SHA256_X86
+            __builtin_cpu_init();
+            unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+            const bool sha = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && ((ebx >> 29) & 1);
+            if (sha && __builtin_cpu_supports("sse4.1"))
+                return Sha256Backend::ShaNi;
+            if (__builtin_cpu_supports("avx2"))
+                return Sha256Backend::Avx2;
+#endif
+            return Sha256Backend::Portable;
+        }
+
+        Sha256Backend detected()
+        {
+            static const Sha256Backend b = detect();
+            return b;
+        }
+
+        // Compression d'un seul message : SHA-NI si présent, sinon portable.
+        Compress singleCompress()
+        {
+#if SA_SHA256_X86
+            if (detected() == Sha256Backend::ShaNi)
+                return compressShaNi;
+#endif
+            return compressPortable;
+        }
+
+        Compress compressFn()
+        {
+            static const Compress c = singleCompress();
+            return c;
+        }
+
+#if SA_SHA256_X86
+        __attribute__((target("avx2"))) void hashManyAvx2(std::span<const std::string_view> inputs, std::span<SHA256Hasher::Digest> out)
+        {
+            // Les messages de longueurs voisines sont groupés pour que les 8 voies
+            // finissent à peu près ensemble.
+            std::vector<std::size_t> order(inputs.size());
+            std::iota(order.begin(), order.end(), std::size_t{0});
+            std::sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y)
+                      { return inputs[x].size() < inputs[y].size(); });
+
+            Tail tails[8];
+            for (std::size_t g = 0; g < order.size(); g += 8)
+            {
+                const std::size_t lanes = std::min<std::size_t>(8, order.size() - g);
+
+                const std::uint8_t *data[8];
+                std::size_t full[8], total[8];
+                std::size_t maxBlocks = 0;
+                for (std::size_t l = 0; l < 8; ++l)
+                {
+                    // Voies vides : on recopie la voie 0, son résultat est ignoré.
+                    const auto &msg = inputs[order[g + (l < lanes ? l : 0)]];
+                    data[l] = reinterpret_cast<const std::uint8_t *>(msg.data());
+                    buildTail(tails[l], data[l], msg.size());
+                    full[l] = msg.size() / SHA256Hasher::kBlockSize;
+                    total[l] = full[l] + tails[l].blocks;
+                    maxBlocks = std::max(maxBlocks, total[l]);
+                }
+
+                __m256i s[8];
+                for (int i = 0; i < 8; ++i)
+                    s[i] = _mm256_set1_epi32(static_cast<int>(kInit[i]));
+
+                for (std::size_t b = 0; b < maxBlocks; ++b)
+                {
+                    const std::uint8_t *blocks[8];
+                    for (std::size_t l = 0; l < 8; ++l)
+                    {
+                        const std::size_t k = std::min(b, total[l] - 1);
+                        blocks[l] = k < full[l] ? data[l] + k * SHA256Hasher::kBlockSize
+                                                : tails[l].bytes + (k - full[l]) * SHA256Hasher::kBlockSize;
+                    }
+                    compress8(s, blocks);
+
+                    for (std::size_t l = 0; l < lanes; ++l)
+                    {
+                        if (total[l] != b + 1)
+                            continue;
+
+                        alignas(32) std::uint32_t words[8][8];
+                        for (int i = 0; i < 8; ++i)
+                            _mm256_store_si256(reinterpret_cast<__m256i *>(words[i]), s[i]);
+
+                        std::uint32_t state[8];
+                        for (int i = 0; i < 8; ++i)
+                            state[i] = words[i][l];
+                        writeDigest(state, out[order[g + l]]);
+                    }
+                }
+            }
+        }
+#endif
+    }
+
+    void SHA256Hasher::reset()
+    {
+        std::memcpy(state_, kInit, sizeof(state_));
+        buffered_ = 0;
+        length_ = 0;
+    }
+
+    SHA256Hasher &SHA256Hasher::update(const void *data, std::size_t size)
+    {
+        auto *p = static_cast<const std::uint8_t *>(data);
+        length_ += size;
+
+        if (buffered_ > 0)
+        {
+            const std::size_t n = std::min(size, kBlockSize - buffered_);
+            std::memcpy(buffer_ + buffered_, p, n);
+            buffered_ += n;
+            p += n;
+            size -= n;
+            if (buffered_ < kBlockSize)
+                return *this;
+            compressFn()(state_, buffer_, 1);
+            buffered_ = 0;
+        }
+
+        const std::size_t blocks = size / kBlockSize;
+        if (blocks > 0)
+        {
+            compressFn()(state_, p, blocks);
+            p += blocks * kBlockSize;
+            size -= blocks * kBlockSize;
+        }
+
+        std::memcpy(buffer_, p, size);
+        buffered_ = size;
+        return *this;
+    }
+
+    SHA256Hasher::Digest SHA256Hasher::finalize()
+    {
+        // buildTail ne regarde que les `buffered_` derniers octets ; la longueur
+        // encodée est celle de tout le message.
+        Tail tail;
+        buildTail(tail, buffer_, buffered_);
+        const std::uint64_t bits = length_ * 8;
+        std::uint8_t *len = tail.bytes + tail.blocks * kBlockSize - 8;
+        store32be(len, static_cast<std::uint32_t>(bits >> 32));
+        store32be(len + 4, static_cast<std::uint32_t>(bits));
+        compressFn()(state_, tail.bytes, tail.blocks);
+
+        Digest out;
+        writeDigest(state_, out);
+        reset();
+        return out;
+    }
+
+    SHA256Hasher::Digest SHA256Hasher::hash(const void *data, std::size_t size)
+    {
+        Digest out;
+        hashOne(compressFn(), static_cast<const std::uint8_t *>(data), size, out);
+        return out;
+    }
+
+    void SHA256Hasher::hashMany(std::span<const std::string_view> inputs, std::span<Digest> out)
+    {
+        hashMany(inputs, out, backend());
+    }
+
+    void SHA256Hasher::hashMany(std::span<const std::string_view> inputs, std::span<Digest> out, Sha256Backend which)
+    {
+        if (out.size() < inputs.size())
+            throw std::invalid_argument("SHA256Hasher::hashMany: out trop petit");
+        if (!supported(which))
+            throw std::invalid_argument(std::string("SHA256Hasher::hashMany: backend non supporté: ") + name(which));
+
+#if SA_SHA256_X86
+        if (which == Sha256Backend::Avx2)
+        {
+            hashManyAvx2(inputs, out);
+            return;
+        }
+        const Compress compress = which == Sha256Backend::ShaNi ? compressShaNi : compressPortable;
+#else
+        const Compress compress = compressPortable;
+#endif
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+            hashOne(compress, reinterpret_cast<const std::uint8_t *>(inputs[i].data()), inputs[i].size(), out[i]);
+    }
+
+    Sha256Backend SHA256Hasher::backend()
+    {
+        return detected();
+    }
+
+    bool SHA256Hasher::supported(Sha256Backend which)
+    {
+        switch (which)
+        {
+        case Sha256Backend::Portable:
+            return true;
+#if SA_SHA256_X86
+        case Sha256Backend::Avx2:
+            return __builtin_cpu_supports("avx2");
+        case Sha256Backend::ShaNi:
+            return detected() == Sha256Backend::ShaNi;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    const char *SHA256Hasher::name(Sha256Backend which)
+    {
+        switch (which)
+        {
+        case Sha256Backend::ShaNi:
+            return "sha-ni";
+        case Sha256Backend::Avx2:
+            return "avx2";
+        default:
+            return "portable";
+        }
+    }
+}
@@ -0,0 +1,325 @@
+#include <adastra/crypto/jwt/JwtVerifier.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+#include <adastra/crypto/signature/SignatureVeirifer.hpp>
+#include <adastra/utils/string/Base64.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+namespace adastra::crypto::jwt
+{
+    namespace
+    {
+        std::int64_t nowSeconds()
+        {
+            using namespace std::chrono;
+            return duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+        }
+
+        // Date numérique (RFC 7519 §2) : entier ou flottant ; 0 si absente.
+        bool numericDate(const nlohmann::json &payload, const char *name, std::int64_t &out)
+        {
+            auto it = payload.find(name);
+            if (it == payload.end())
+                return true;
+            if (it->is_number_integer())
+            {
+                // Entier : sans passer par double (précision au-delà de 2^53).
+                constexpr auto kMax = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+                if (it->is_number_unsigned() && it->get<std::uint64_t>() > kMax)
+                    return false;
+                out = it->get<std::int64_t>();
+                return true;
+            }
+            if (!it->is_number_float())
+                return false;
+
+            // Flottant hors de [-2^63, 2^63) ou NaN : conversion indéfinie, jeton refusé.
+            const double value = it->get<double>();
+            if (!(value >= -9223372036854775808.0 && value < 9223372036854775808.0))
+                return false;
+            out = static_cast<std::int64_t>(value);
+            return true;
+        }
+
+        bool stringClaim(const nlohmann::json &payload, const char *name, std::string &out)
+        {
+            auto it = payload.find(name);
+            if (it == payload.end())
+                return true;
+            if (!it->is_string())
+                return false;
+            out = it->get<std::string>();
+            return true;
+        }
+
+        nlohmann::json parseObject(std::string_view segment, std::string &scratch)
+        {
+            if (!utils::string::base64UrlDecode(segment, scratch))
+                return nullptr;
+            auto j = nlohmann::json::parse(scratch, nullptr, false);
+            return j.is_object() ? j : nlohmann::json(nullptr);
+        }
+    }
+
+    const char *describe(JwtError error)
+    {
+        switch (error)
+        {
+        case JwtError::None:
+            return "ok";
+        case JwtError::Malformed:
+            return "malformed token";
+        case JwtError::UnsupportedAlg:
+            return "unsupported algorithm";
+        case JwtError::UnknownKey:
+            return "unknown key";
+        case JwtError::BadSignature:
+            return "invalid signature";
+        case JwtError::Expired:
+            return "token expired";
+        case JwtError::MissingExpiry:
+            return "missing exp claim";
+        case JwtError::NotYetValid:
+            return "token not yet valid";
+        case JwtError::WrongIssuer:
+            return "invalid issuer";
+        case JwtError::WrongAudience:
+            return "invalid audience";
+        }
+        return "invalid token";
+    }
+
+    std::size_t JwtVerifier::DigestHash::operator()(const Digest &d) const noexcept
+    {
+        std::size_t h;
+        std::memcpy(&h, d.data(), sizeof(h));
+        return h;
+    }
+
+    JwtVerifier::JwtVerifier(JwtOptions options)
+        : options_(std::move(options))
+    {
+        if (options_.cacheCapacity > 0)
+        {
+            const std::size_t shards = std::max<std::size_t>(1, std::min(options_.cacheShards, options_.cacheCapacity));
+            perShard_ = (options_.cacheCapacity + shards - 1) / shards;
+            shards_.reserve(shards);
+            for (std::size_t i = 0; i < shards; ++i)
+            {
+                shards_.push_back(std::make_unique<Shard>());
+                shards_.back()->entries.reserve(perShard_);
+            }
+        }
+    }
+
+    void JwtVerifier::addHmacKey(std::string kid, std::string_view secret)
+    {
+        Key key{Alg::HS256, hash::HmacSha256(secret), {}};
+        keys_.insert_or_assign(std::move(kid), std::move(key));
+    }
+
+    void JwtVerifier::addEd25519Key(std::string kid, const signature::PublicKey &publicKey)
+    {
+        Key key{Alg::EdDSA, std::nullopt, publicKey};
+        keys_.insert_or_assign(std::move(kid), std::move(key));
+    }
+
+    JwtResult JwtVerifier::verify(std::string_view token)
+    {
+        if (token.empty() || token.size() > options_.maxTokenSize)
+            return reject(JwtError::Malformed);
+
+        const std::int64_t now = nowSeconds();
+        if (shards_.empty())
+            return verifyFull(token, now);
+
+        const Digest d = hash::SHA256Hasher::hash(token);
+        {
+            Shard &s = shardOf(d);
+            std::shared_lock<std::shared_mutex> lock(s.mutex);
+            auto it = s.entries.find(d);
+            if (it != s.entries.end() && now <= it->second.cachedUntil)
+            {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return {JwtError::None, it->second.claims};
+            }
+        }
+
+        JwtResult r = verifyFull(token, now);
+        if (r)
+            remember(d, r.claims);
+        return r;
+    }
+
+    JwtResult JwtVerifier::verifyFull(std::string_view token, std::int64_t now)
+    {
+        verified_.fetch_add(1, std::memory_order_relaxed);
+
+        const auto dot1 = token.find('.');
+        const auto dot2 = dot1 == std::string_view::npos ? dot1 : token.find('.', dot1 + 1);
+        if (dot2 == std::string_view::npos || token.find('.', dot2 + 1) != std::string_view::npos)
+            return reject(JwtError::Malformed);
+
+        const std::string_view signingInput = token.substr(0, dot2);
+        std::string scratch;
+
+        // En-tête : alg obligatoire et identique à celui de la clé (pas de "none",
+        // pas de confusion HS256/EdDSA avec une clé publique).
+        const nlohmann::json header = parseObject(token.substr(0, dot1), scratch);
+        if (header.is_null())
+            return reject(JwtError::Malformed);
+        if (header.contains("crit"))
+            return reject(JwtError::UnsupportedAlg);
+
+        auto algIt = header.find("alg");
+        if (algIt == header.end() || !algIt->is_string())
+            return reject(JwtError::UnsupportedAlg);
+
+        std::string kid;
+        if (!stringClaim(header, "kid", kid))
+            return reject(JwtError::Malformed);
+
+        auto keyIt = keys_.find(kid);
+        if (keyIt == keys_.end())
+            return reject(JwtError::UnknownKey);
+        const Key &key = keyIt->second;
+
+        const std::string &alg = algIt->get_ref<const std::string &>();
+        if ((key.alg == Alg::HS256 && alg != "HS256") || (key.alg == Alg::EdDSA && alg != "EdDSA"))
+            return reject(JwtError::UnsupportedAlg);
+
+        std::string sig;
+        if (!utils::string::base64UrlDecode(token.substr(dot2 + 1), sig))
+            return reject(JwtError::Malformed);
+        const auto *sigBytes = reinterpret_cast<const std::uint8_t *>(sig.data());
+
+        bool valid = false;
+        if (key.alg == Alg::HS256)
+            valid = key.hmac->verify(signingInput, {sigBytes, sig.size()});
+        else if (sig.size() == std::tuple_size_v<signature::Signature>)
+        {
+            signature::Signature s;
+            std::memcpy(s.data(), sigBytes, s.size());
+            valid = signature::SignatureVerifier::verifyUncached(
+                key.publicKey, {reinterpret_cast<const std::uint8_t *>(signingInput.data()), signingInput.size()}, s);
+        }
+        if (!valid)
+            return reject(JwtError::BadSignature);
+
+        // Payload décodé seulement une fois la signature acceptée.
+        auto claims = std::make_shared<JwtClaims>();
+        claims->payload = parseObject(token.substr(dot1 + 1, dot2 - dot1 - 1), scratch);
+        if (claims->payload.is_null())
+            return reject(JwtError::Malformed);
+
+        const auto &p = claims->payload;
+        if (!numericDate(p, "exp", claims->expiresAt) || !numericDate(p, "nbf", claims->notBefore) ||
+            !numericDate(p, "iat", claims->issuedAt) || !stringClaim(p, "sub", claims->subject) ||
+            !stringClaim(p, "iss", claims->issuer))
+            return reject(JwtError::Malformed);
+
+        if (auto aud = p.find("aud"); aud != p.end())
+        {
+            if (aud->is_string())
+                claims->audience.push_back(aud->get<std::string>());
+            else if (aud->is_array())
+            {
+                for (const auto &a : *aud)
+                {
+                    if (!a.is_string())
+                        return reject(JwtError::Malformed);
+                    claims->audience.push_back(a.get<std::string>());
+                }
+            }
+            else
+                return reject(JwtError::Malformed);
+        }
+        claims->keyId = std::move(kid);
+
+        if (const JwtError e = checkTimes(*claims, now); e != JwtError::None)
+            return reject(e);
+        if (!options_.issuer.empty() && claims->issuer != options_.issuer)
+            return reject(JwtError::WrongIssuer);
+        if (!options_.audience.empty() &&
+            std::find(claims->audience.begin(), claims->audience.end(), options_.audience) == claims->audience.end())
+            return reject(JwtError::WrongAudience);
+
+        return {JwtError::None, std::move(claims)};
+    }
+
+    JwtError JwtVerifier::checkTimes(const JwtClaims &claims, std::int64_t now) const
+    {
+        if (claims.expiresAt == 0)
+        {
+            if (options_.requireExpiry)
+                return JwtError::MissingExpiry;
+        }
+        else if (now > claims.expiresAt + options_.leewaySeconds)
+            return JwtError::Expired;
+
+        if (claims.notBefore != 0 && now + options_.leewaySeconds < claims.notBefore)
+            return JwtError::NotYetValid;
+        return JwtError::None;
+    }
+
+    JwtVerifier::Shard &JwtVerifier::shardOf(const Digest &d)
+    {
+        std::uint32_t h;
+        std::memcpy(&h, d.data() + 8, sizeof(h));
+        return *shards_[h % shards_.size()];
+    }
+
+    void JwtVerifier::remember(const Digest &d, std::shared_ptr<const JwtClaims> claims)
+    {
+        // Gardé jusqu'à exp (+ tolérance) : au-delà, la vérification complète
+        // renverra Expired.
+        const std::int64_t until = claims->expiresAt != 0
+                                       ? claims->expiresAt + options_.leewaySeconds
+                                       : nowSeconds() + options_.cacheTtlSeconds;
+
+        Shard &s = shardOf(d);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        // Une entrée expirée est remplacée ; son digest est déjà dans la FIFO.
+        const auto [it, inserted] = s.entries.insert_or_assign(d, Entry{std::move(claims), until});
+        if (!inserted)
+            return;
+
+        if (s.fifo.size() < perShard_)
+        {
+            s.fifo.push_back(d);
+            return;
+        }
+
+        s.entries.erase(s.fifo[s.next]);
+        s.fifo[s.next] = d;
+        s.next = (s.next + 1) % perShard_;
+    }
+
+    JwtResult JwtVerifier::reject(JwtError error)
+    {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return {error, nullptr};
+    }
+
+    void JwtVerifier::clearCache()
+    {
+        for (auto &s : shards_)
+        {
+            std::unique_lock<std::shared_mutex> lock(s->mutex);
+            s->entries.clear();
+            s->fifo.clear();
+            s->next = 0;
+        }
+    }
+
+    JwtStats JwtVerifier::stats() const
+    {
+        return {hits_.load(std::memory_order_relaxed),
+                verified_.load(std::memory_order_relaxed),
+                rejected_.load(std::memory_order_relaxed)};
+    }
+}
@@ -0,0 +1,202 @@
+#include <adastra/crypto/password/PasswordHasher.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+#include <adastra/crypto/random/SecureRandom.hpp>
+#include <adastra/utils/string/Base64.hpp>
+
+#include <array>
+#include <charconv>
+#include <stdexcept>
+#include <vector>
+
+#if defined(SA_HAS_OPENSSL)
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#endif
+
+namespace adastra::crypto::password
+{
+    namespace
+    {
+        constexpr std::size_t kSaltSize = 16;
+        constexpr std::size_t kKeySize = 32;
+
+        // Bornes des paramètres relus : un hash stocké ne doit pas pouvoir
+        // demander des Gio de mémoire ou des minutes de calcul.
+        constexpr unsigned kMaxLogN = 20;
+        constexpr unsigned kMaxR = 32;
+        constexpr unsigned kMaxP = 4;
+        constexpr std::uint64_t kMaxScryptMemory = std::uint64_t(256) << 20; // 128 * r * N
+        constexpr unsigned kMaxIterations = 10'000'000;
+
+        // Le coût en calcul vaut p fois le parcours de la mémoire : borné par p et 128 * r * N.
+        bool scryptInBounds(const PasswordParams &p)
+        {
+            if (p.scryptLogN == 0 || p.scryptLogN > kMaxLogN || p.scryptR == 0 || p.scryptR > kMaxR ||
+                p.scryptP == 0 || p.scryptP > kMaxP)
+                return false;
+            return 128 * std::uint64_t(p.scryptR) * (std::uint64_t(1) << p.scryptLogN) <= kMaxScryptMemory;
+        }
+
+        struct Decoded
+        {
+            PasswordParams params;
+            std::string salt;
+            std::string key;
+        };
+
+        bool readUint(std::string_view &s, std::string_view prefix, unsigned &out)
+        {
+            if (s.substr(0, prefix.size()) != prefix)
+                return false;
+            s.remove_prefix(prefix.size());
+            auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+            if (ec != std::errc() || ptr == s.data())
+                return false;
+            s.remove_prefix(static_cast<std::size_t>(ptr - s.data()));
+            return true;
+        }
+
+        std::string_view nextField(std::string_view &s)
+        {
+            const auto pos = s.find('$');
+            std::string_view field = s.substr(0, pos);
+            s.remove_prefix(pos == std::string_view::npos ? s.size() : pos + 1);
+            return field;
+        }
+
+        bool decode(std::string_view encoded, Decoded &out)
+        {
+            if (encoded.empty() || encoded.front() != '$')
+                return false;
+            encoded.remove_prefix(1);
+
+            const std::string_view id = nextField(encoded);
+            std::string_view params = nextField(encoded);
+            const std::string_view salt = nextField(encoded);
+            const std::string_view key = nextField(encoded);
+            if (!encoded.empty())
+                return false;
+
+            if (id == "scrypt")
+            {
+                out.params.algorithm = PasswordAlgorithm::Scrypt;
+                if (!readUint(params, "ln=", out.params.scryptLogN) || !readUint(params, ",r=", out.params.scryptR) ||
+                    !readUint(params, ",p=", out.params.scryptP) || !params.empty())
+                    return false;
+                if (!scryptInBounds(out.params))
+                    return false;
+            }
+            else if (id == "pbkdf2-sha256")
+            {
+                out.params.algorithm = PasswordAlgorithm::Pbkdf2Sha256;
+                if (!readUint(params, "i=", out.params.pbkdf2Iterations) || !params.empty())
+                    return false;
+                if (out.params.pbkdf2Iterations == 0 || out.params.pbkdf2Iterations > kMaxIterations)
+                    return false;
+            }
+            else
+                return false;
+
+            return utils::string::base64UrlDecode(salt, out.salt) && utils::string::base64UrlDecode(key, out.key) &&
+                   !out.salt.empty() && out.key.size() >= 16 && out.key.size() <= 64;
+        }
+
+#if defined(SA_HAS_OPENSSL)
+        void derive(const PasswordParams &p, std::string_view password, std::string_view salt,
+                    std::uint8_t *out, std::size_t outSize)
+        {
+            const auto *salt8 = reinterpret_cast<const unsigned char *>(salt.data());
+            int ok = 0;
+            if (p.algorithm == PasswordAlgorithm::Scrypt)
+            {
+                const std::uint64_t n = std::uint64_t(1) << p.scryptLogN;
+                // Mémoire demandée par scrypt (V + B) plus une marge.
+                const std::uint64_t maxmem = 128 * std::uint64_t(p.scryptR) * (n + p.scryptP + 2) + (1u << 20);
+                ok = EVP_PBE_scrypt(password.data(), password.size(), salt8, salt.size(),
+                                    n, p.scryptR, p.scryptP, maxmem, out, outSize);
+            }
+            else
+            {
+                ok = PKCS5_PBKDF2_HMAC(password.data(), static_cast<int>(password.size()), salt8,
+                                       static_cast<int>(salt.size()), static_cast<int>(p.pbkdf2Iterations),
+                                       EVP_sha256(), static_cast<int>(outSize), out);
+            }
+            if (ok != 1)
+                throw std::runtime_error("PasswordHasher: dérivation de clé échouée");
+        }
+#else
+        void derive(const PasswordParams &, std::string_view, std::string_view, std::uint8_t *, std::size_t)
+        {
+            throw std::runtime_error("PasswordHasher: compilé sans OpenSSL");
+        }
+#endif
+
+        void wipe(void *p, std::size_t n)
+        {
+#if defined(SA_HAS_OPENSSL)
+            OPENSSL_cleanse(p, n);
+#else
+            volatile auto *v = static_cast<volatile std::uint8_t *>(p);
+            while (n--)
+                *v++ = 0;
+#endif
+        }
+    }
+
+    PasswordHasher::PasswordHasher(PasswordParams params)
+        : params_(params)
+    {
+        if (params_.algorithm == PasswordAlgorithm::Scrypt && !scryptInBounds(params_))
+            throw std::invalid_argument("PasswordHasher: paramètres scrypt hors bornes");
+        if (params_.algorithm == PasswordAlgorithm::Pbkdf2Sha256 &&
+            (params_.pbkdf2Iterations == 0 || params_.pbkdf2Iterations > kMaxIterations))
+            throw std::invalid_argument("PasswordHasher: nombre d'itérations PBKDF2 hors bornes");
+    }
+
+    std::string PasswordHasher::hash(std::string_view password) const
+    {
+        std::array<std::uint8_t, kSaltSize> salt;
+        random::SecureRandom::fill(salt.data(), salt.size());
+
+        std::array<std::uint8_t, kKeySize> key;
+        derive(params_, password, {reinterpret_cast<const char *>(salt.data()), salt.size()}, key.data(), key.size());
+
+        std::string out;
+        if (params_.algorithm == PasswordAlgorithm::Scrypt)
+            out = "$scrypt$ln=" + std::to_string(params_.scryptLogN) + ",r=" + std::to_string(params_.scryptR) +
+                  ",p=" + std::to_string(params_.scryptP);
+        else
+            out = "$pbkdf2-sha256$i=" + std::to_string(params_.pbkdf2Iterations);
+
+        out += '$';
+        out += utils::string::base64UrlEncode(salt);
+        out += '$';
+        out += utils::string::base64UrlEncode(key);
+        wipe(key.data(), key.size());
+        return out;
+    }
+
+    bool PasswordHasher::verify(std::string_view password, std::string_view encoded) const
+    {
+        Decoded d;
+        if (!decode(encoded, d))
+            return false;
+
+        std::vector<std::uint8_t> key(d.key.size());
+        derive(d.params, password, d.salt, key.data(), key.size());
+        const bool ok = hash::constantTimeEquals(key, {reinterpret_cast<const std::uint8_t *>(d.key.data()), d.key.size()});
+        wipe(key.data(), key.size());
+        return ok;
+    }
+
+    bool PasswordHasher::needsRehash(std::string_view encoded) const
+    {
+        Decoded d;
+        if (!decode(encoded, d) || d.params.algorithm != params_.algorithm || d.key.size() != kKeySize)
+            return true;
+        if (d.params.algorithm == PasswordAlgorithm::Scrypt)
+            return d.params.scryptLogN != params_.scryptLogN || d.params.scryptR != params_.scryptR ||
+                   d.params.scryptP != params_.scryptP;
+        return d.params.pbkdf2Iterations != params_.pbkdf2Iterations;
+    }
+}
@@ -0,0 +1,297 @@
+#include <adastra/crypto/random/ChaCha20.hpp>
+
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SA_CHACHA_X86 1
+#include <immintrin.h>
+#endif
+
+namespace adastra::crypto::random
+{
+    namespace
+    {
+        constexpr std::uint32_t kSigma[4] = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574}; // "expand 32-byte k"
+
+        void initState(std::uint32_t s[16], const std::uint32_t key[8], std::uint64_t counter, std::uint64_t nonce)
+        {
+            std::memcpy(s, kSigma, sizeof(kSigma));
+            std::memcpy(s + 4, key, 32);
+            s[12] = static_cast<std::uint32_t>(counter);
+            s[13] = static_cast<std::uint32_t>(counter >> 32);
+            s[14] = static_cast<std::uint32_t>(nonce);
+            s[15] = static_cast<std::uint32_t>(nonce >> 32);
+        }
+
+        // ---------------------------------------------------------------- scalaire
+
+        inline std::uint32_t rotl(std::uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+#define SA_QR(a, b, c, d)          \
+    a += b, d ^= a, d = rotl(d, 16); \
+    c += d, b ^= c, b = rotl(b, 12); \
+    a += b, d ^= a, d = rotl(d, 8);  \
+    c += d, b ^= c, b = rotl(b, 7)
+
+        void blocksScalar(const std::uint32_t key[8], std::uint64_t counter, std::uint64_t nonce,
+                          std::uint8_t *out, std::size_t count)
+        {
+            std::uint32_t in[16];
+            for (std::size_t n = 0; n < count; ++n, ++counter, out += ChaCha20::kBlockSize)
+            {
+                initState(in, key, counter, nonce);
+                std::uint32_t x[16];
+                std::memcpy(x, in, sizeof(x));
+
+                for (int r = 0; r < 10; ++r)
+                {
+                    SA_QR(x[0], x[4], x[8], x[12]);
+                    SA_QR(x[1], x[5], x[9], x[13]);
+                    SA_QR(x[2], x[6], x[10], x[14]);
+                    SA_QR(x[3], x[7], x[11], x[15]);
+                    SA_QR(x[0], x[5], x[10], x[15]);
+                    SA_QR(x[1], x[6], x[11], x[12]);
+                    SA_QR(x[2], x[7], x[8], x[13]);
+                    SA_QR(x[3], x[4], x[9], x[14]);
+                }
+
+                for (int i = 0; i < 16; ++i)
+                {
+                    const std::uint32_t v = x[i] + in[i];
+                    out[i * 4 + 0] = static_cast<std::uint8_t>(v);
+                    out[i * 4 + 1] = static_cast<std::uint8_t>(v >> 8);
+                    out[i * 4 + 2] = static_cast<std::uint8_t>(v >> 16);
+                    out[i * 4 + 3] = static_cast<std::uint8_t>(v >> 24);
+                }
+            }
+            std::memset(in, 0, sizeof(in));
+        }
+#undef SA_QR
+
+#if SA_CHACHA_X86
+        // ---------------------------------------------------------------- SSE2
+        // Chaque registre porte le même mot de 4 blocs consécutifs.
+
+        inline __m128i rotl128(__m128i v, int n)
+        {
+            return _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - n));
+        }
+
+#define SA_QR4(a, b, c, d)                                             \
+    a = _mm_add_epi32(a, b), d = rotl128(_mm_xor_si128(d, a), 16);     \
+    c = _mm_add_epi32(c, d), b = rotl128(_mm_xor_si128(b, c), 12);     \
+    a = _mm_add_epi32(a, b), d = rotl128(_mm_xor_si128(d, a), 8);      \
+    c = _mm_add_epi32(c, d), b = rotl128(_mm_xor_si128(b, c), 7)
+
+        // Transpose 4 mots x 4 blocs puis écrit les 16 octets de chaque bloc.
+        inline void store4(std::uint8_t *out, __m128i a, __m128i b, __m128i c, __m128i d)
+        {
+            const __m128i t0 = _mm_unpacklo_epi32(a, b);
+            const __m128i t1 = _mm_unpacklo_epi32(c, d);
+            const __m128i t2 = _mm_unpackhi_epi32(a, b);
+            const __m128i t3 = _mm_unpackhi_epi32(c, d);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 0 * 64), _mm_unpacklo_epi64(t0, t1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 1 * 64), _mm_unpackhi_epi64(t0, t1));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * 64), _mm_unpacklo_epi64(t2, t3));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 3 * 64), _mm_unpackhi_epi64(t2, t3));
+        }
+
+        __attribute__((target("sse2"))) std::size_t blocksSse2(const std::uint32_t key[8], std::uint64_t counter,
+                                                               std::uint64_t nonce, std::uint8_t *out, std::size_t count)
+        {
+            std::uint32_t s[16];
+            std::size_t done = 0;
+            for (; done + 4 <= count; done += 4, counter += 4, out += 4 * ChaCha20::kBlockSize)
+            {
+                initState(s, key, counter, nonce);
+
+                __m128i in[16];
+                for (int i = 0; i < 16; ++i)
+                    in[i] = _mm_set1_epi32(static_cast<int>(s[i]));
+
+                // Compteurs 64 bits des 4 blocs : counter + 0..3, avec retenue.
+                alignas(16) std::uint32_t lo[4], hi[4];
+                for (int l = 0; l < 4; ++l)
+                {
+                    lo[l] = static_cast<std::uint32_t>(counter + l);
+                    hi[l] = static_cast<std::uint32_t>((counter + l) >> 32);
+                }
+                in[12] = _mm_load_si128(reinterpret_cast<const __m128i *>(lo));
+                in[13] = _mm_load_si128(reinterpret_cast<const __m128i *>(hi));
+
+                __m128i x[16];
+                for (int i = 0; i < 16; ++i)
+                    x[i] = in[i];
+
+                for (int r = 0; r < 10; ++r)
+                {
+                    SA_QR4(x[0], x[4], x[8], x[12]);
+                    SA_QR4(x[1], x[5], x[9], x[13]);
+                    SA_QR4(x[2], x[6], x[10], x[14]);
+                    SA_QR4(x[3], x[7], x[11], x[15]);
+                    SA_QR4(x[0], x[5], x[10], x[15]);
+                    SA_QR4(x[1], x[6], x[11], x[12]);
+                    SA_QR4(x[2], x[7], x[8], x[13]);
+                    SA_QR4(x[3], x[4], x[9], x[14]);
+                }
+
+                for (int i = 0; i < 16; ++i)
+                    x[i] = _mm_add_epi32(x[i], in[i]);
+
+                for (int g = 0; g < 4; ++g)
+                    store4(out + g * 16, x[g * 4], x[g * 4 + 1], x[g * 4 + 2], x[g * 4 + 3]);
+            }
+            std::memset(s, 0, sizeof(s));
+            return done;
+        }
+#undef SA_QR4
+
+        // ---------------------------------------------------------------- AVX2
+        // 8 blocs : la moitié basse de chaque registre porte les blocs 0..3,
+        // la moitié haute les blocs 4..7.
+
+        __attribute__((target("avx2"))) inline __m256i rotl256(__m256i v, int n)
+        {
+            return _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - n));
+        }
+
+        __attribute__((target("avx2"))) inline __m256i rot16(__m256i v)
+        {
+            const __m256i m = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                                              13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+            return _mm256_shuffle_epi8(v, m);
+        }
+
+        __attribute__((target("avx2"))) inline __m256i rot8(__m256i v)
+        {
+            const __m256i m = _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+                                              14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+            return _mm256_shuffle_epi8(v, m);
+        }
+
+#define SA_QR8(a, b, c, d)                                                 \
+    a = _mm256_add_epi32(a, b), d = rot16(_mm256_xor_si256(d, a));         \
+    c = _mm256_add_epi32(c, d), b = rotl256(_mm256_xor_si256(b, c), 12);   \
+    a = _mm256_add_epi32(a, b), d = rot8(_mm256_xor_si256(d, a));          \
+    c = _mm256_add_epi32(c, d), b = rotl256(_mm256_xor_si256(b, c), 7)
+
+        __attribute__((target("avx2"))) inline void store8(std::uint8_t *out, __m256i a, __m256i b, __m256i c, __m256i d)
+        {
+            const __m256i t0 = _mm256_unpacklo_epi32(a, b);
+            const __m256i t1 = _mm256_unpacklo_epi32(c, d);
+            const __m256i t2 = _mm256_unpackhi_epi32(a, b);
+            const __m256i t3 = _mm256_unpackhi_epi32(c, d);
+            const __m256i r[4] = {_mm256_unpacklo_epi64(t0, t1), _mm256_unpackhi_epi64(t0, t1),
+                                  _mm256_unpacklo_epi64(t2, t3), _mm256_unpackhi_epi64(t2, t3)};
+            for (int k = 0; k < 4; ++k)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + k * 64), _mm256_castsi256_si128(r[k]));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (k + 4) * 64), _mm256_extracti128_si256(r[k], 1));
+            }
+        }
+
+        __attribute__((target("avx2"))) std::size_t blocksAvx2(const std::uint32_t key[8], std::uint64_t counter,
+                                                               std::uint64_t nonce, std::uint8_t *out, std::size_t count)
+        {
+            std::uint32_t s[16];
+            std::size_t done = 0;
+            for (; done + 8 <= count; done += 8, counter += 8, out += 8 * ChaCha20::kBlockSize)
+            {
+                initState(s, key, counter, nonce);
+
+                __m256i in[16];
+                for (int i = 0; i < 16; ++i)
+                    in[i] = _mm256_set1_epi32(static_cast<int>(s[i]));
+
+                // Voies 0..3 = blocs 0..3, voies 4..7 = blocs 4..7.
+                alignas(32) std::uint32_t lo[8], hi[8];
+                for (int l = 0; l < 8; ++l)
+                {
+                    lo[l] = static_cast<std::uint32_t>(counter + l);
+                    hi[l] = static_cast<std::uint32_t>((counter + l) >> 32);
+                }
+                in[12] = _mm256_load_si256(reinterpret_cast<const __m256i *>(lo));
+                in[13] = _mm256_load_si256(reinterpret_cast<const __m256i *>(hi));
+
+                __m256i x[16];
+                for (int i = 0; i < 16; ++i)
+                    x[i] = in[i];
+
+                for (int r = 0; r < 10; ++r)
+                {
+                    SA_QR8(x[0], x[4], x[8], x[12]);
+                    SA_QR8(x[1], x[5], x[9], x[13]);
+                    SA_QR8(x[2], x[6], x[10], x[14]);
+                    SA_QR8(x[3], x[7], x[11], x[15]);
+                    SA_QR8(x[0], x[5], x[10], x[15]);
+                    SA_QR8(x[1], x[6], x[11], x[12]);
+                    SA_QR8(x[2], x[7], x[8], x[13]);
+                    SA_QR8(x[3], x[4], x[9], x[14]);
+                }
+
+                for (int i = 0; i < 16; ++i)
+                    x[i] = _mm256_add_epi32(x[i], in[i]);
+
+                for (int g = 0; g < 4; ++g)
+                    store8(out + g * 16, x[g * 4], x[g * 4 + 1], x[g * 4 + 2], x[g * 4 + 3]);
+            }
+            std::memset(s, 0, sizeof(s));
+            return done;
+        }
+#undef SA_QR8
+
+        enum class Backend
+        {
+            Scalar,
+            Sse2,
+            Avx2
+        };
+
+        Backend detect()
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return Backend::Avx2;
+            if (__builtin_cpu_supports("sse2"))
+                return Backend::Sse2;
+            return Backend::Scalar;
+        }
+
+        Backend backendInUse()
+        {
+            static const Backend b = detect();
+            return b;
+        }
+#endif
+    }
+
+    void ChaCha20::blocks(const std::uint32_t key[8], std::uint64_t counter, std::uint64_t nonce,
+                          std::uint8_t *out, std::size_t count)
+    {
+        std::size_t done = 0;
+#if SA_CHACHA_X86
+        const Backend b = backendInUse();
+        if (b == Backend::Avx2)
+            done = blocksAvx2(key, counter, nonce, out, count);
+        if (b != Backend::Scalar)
+            done += blocksSse2(key, counter + done, nonce, out + done * kBlockSize, count - done);
+#endif
+        blocksScalar(key, counter + done, nonce, out + done * kBlockSize, count - done);
+    }
+
+    const char *ChaCha20::backend()
+    {
+#if SA_CHACHA_X86
+        switch (backendInUse())
+        {
+        case Backend::Avx2:
+            return "avx2";
+        case Backend::Sse2:
+            return "sse2";
+        default:
+            break;
+        }
+#endif
+        return "scalar";
+    }
+}
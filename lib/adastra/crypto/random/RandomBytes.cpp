@@ -0,0 +1,131 @@
+#include <adastra/crypto/random/RandomByters.hpp>
+#include <adastra/crypto/random/ChaCha20.hpp>
+#include <adastra/crypto/random/SecureRandom.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace adastra::crypto::random
+{
+    namespace
+    {
+        constexpr std::size_t kKeyBytes = 32;
+        constexpr std::size_t kPoolBlocks = RandomBytes::kPoolSize / ChaCha20::kBlockSize;
+
+        // Nonces distincts pour le tampon, la sortie directe et le changement de clé.
+        constexpr std::uint64_t kNoncePool = 0;
+        constexpr std::uint64_t kNonceDirect = 1;
+        constexpr std::uint64_t kNonceRekey = 2;
+
+        // Incrémenté dans l'enfant à chaque fork() ; chaque DRBG compare avec sa copie.
+        std::atomic<std::uint64_t> g_forkGeneration{1};
+
+        std::uint64_t forkGeneration()
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            static const bool registered = []
+            {
+                ::pthread_atfork(nullptr, nullptr, []
+                                 { g_forkGeneration.fetch_add(1, std::memory_order_relaxed); });
+                return true;
+            }();
+            (void)registered;
+#endif
+            return g_forkGeneration.load(std::memory_order_relaxed);
+        }
+
+        struct Drbg
+        {
+            std::uint32_t key[8];
+            std::uint8_t pool[RandomBytes::kPoolSize];
+            std::size_t pos = RandomBytes::kPoolSize; // tampon vide
+            std::uint64_t generation = 0;             // 0 = jamais amorcé
+            std::uint64_t sinceReseed = 0;
+
+            ~Drbg()
+            {
+                std::memset(key, 0, sizeof(key));
+                std::memset(pool, 0, sizeof(pool));
+            }
+
+            void reseed()
+            {
+                // Nouvelle clé = ancienne XOR entropie fraîche : un noyau défaillant
+                // ne fait pas perdre l'état déjà accumulé.
+                std::uint32_t fresh[8];
+                SecureRandom::fill(fresh, sizeof(fresh));
+                for (int i = 0; i < 8; ++i)
+                    key[i] ^= fresh[i];
+                std::memset(fresh, 0, sizeof(fresh));
+
+                std::memset(pool, 0, sizeof(pool));
+                pos = RandomBytes::kPoolSize;
+                sinceReseed = 0;
+            }
+
+            void refill()
+            {
+                ChaCha20::blocks(key, 0, kNoncePool, pool, kPoolBlocks);
+                std::memcpy(key, pool, kKeyBytes);
+                std::memset(pool, 0, kKeyBytes);
+                pos = kKeyBytes;
+            }
+
+            void rekey()
+            {
+                std::uint8_t block[ChaCha20::kBlockSize];
+                ChaCha20::blocks(key, 0, kNonceRekey, block, 1);
+                std::memcpy(key, block, kKeyBytes);
+                std::memset(block, 0, sizeof(block));
+            }
+
+            void generate(std::uint8_t *dst, std::size_t size)
+            {
+                const std::uint64_t gen = forkGeneration();
+                if (generation != gen || sinceReseed >= RandomBytes::kReseedBytes)
+                {
+                    if (generation == 0)
+                        std::memset(key, 0, sizeof(key));
+                    reseed();
+                    generation = gen;
+                }
+                sinceReseed += size;
+
+                // Gros tirage : le flux est écrit directement dans `dst`, puis la clé change.
+                if (size >= RandomBytes::kPoolSize)
+                {
+                    const std::size_t blocks = size / ChaCha20::kBlockSize;
+                    ChaCha20::blocks(key, 0, kNonceDirect, dst, blocks);
+                    rekey();
+                    dst += blocks * ChaCha20::kBlockSize;
+                    size -= blocks * ChaCha20::kBlockSize;
+                }
+
+                while (size > 0)
+                {
+                    if (pos == RandomBytes::kPoolSize)
+                        refill();
+
+                    const std::size_t n = std::min(size, RandomBytes::kPoolSize - pos);
+                    std::memcpy(dst, pool + pos, n);
+                    std::memset(pool + pos, 0, n);
+                    pos += n;
+                    dst += n;
+                    size -= n;
+                }
+            }
+        };
+
+        thread_local Drbg t_drbg;
+    }
+
+    void RandomBytes::fill(void *out, std::size_t size)
+    {
+        t_drbg.generate(static_cast<std::uint8_t *>(out), size);
+    }
+}
@@ -0,0 +1,52 @@
+#include <adastra/crypto/random/SecureRandom.hpp>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sys/random.h>
+#endif
+
+namespace adastra::crypto::random
+{
+    namespace
+    {
+        void fromUrandom(std::uint8_t *out, std::size_t size)
+        {
+            std::FILE *f = std::fopen("/dev/urandom", "rb");
+            if (!f)
+                throw std::runtime_error("SecureRandom: /dev/urandom indisponible");
+
+            const std::size_t got = std::fread(out, 1, size, f);
+            std::fclose(f);
+            if (got != size)
+                throw std::runtime_error("SecureRandom: lecture /dev/urandom incomplète");
+        }
+    }
+
+    void SecureRandom::fill(void *out, std::size_t size)
+    {
+        auto *p = static_cast<std::uint8_t *>(out);
+
+#if defined(__linux__)
+        while (size > 0)
+        {
+            const ssize_t n = ::getrandom(p, size, 0);
+            if (n < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                if (errno == ENOSYS)
+                    break; // noyau trop ancien
+                throw std::runtime_error("SecureRandom: getrandom a échoué");
+            }
+            p += n;
+            size -= static_cast<std::size_t>(n);
+        }
+#endif
+        if (size > 0)
+            fromUrandom(p, size);
+    }
+}
@@ -0,0 +1,62 @@
+#include <adastra/crypto/signature/DigitalSigner.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+#if defined(SA_HAS_OPENSSL)
+#include <openssl/evp.h>
+#endif
+
+namespace adastra::crypto::signature
+{
+#if defined(SA_HAS_OPENSSL)
+    DigitalSigner::DigitalSigner(const PrivateKey &key)
+    {
+        EVP_PKEY *pkey = EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, nullptr, key.data(), key.size());
+        if (!pkey)
+            throw std::runtime_error("DigitalSigner: clé Ed25519 invalide");
+
+        std::size_t len = publicKey_.size();
+        if (EVP_PKEY_get_raw_public_key(pkey, publicKey_.data(), &len) != 1)
+        {
+            EVP_PKEY_free(pkey);
+            throw std::runtime_error("DigitalSigner: clé publique illisible");
+        }
+        key_ = pkey;
+    }
+
+    DigitalSigner::~DigitalSigner()
+    {
+        EVP_PKEY_free(static_cast<EVP_PKEY *>(key_));
+    }
+
+    Signature DigitalSigner::sign(std::span<const std::uint8_t> message) const
+    {
+        // Un contexte par thread : EVP_PKEY est partageable, EVP_MD_CTX non.
+        thread_local std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+        if (!ctx)
+            throw std::runtime_error("DigitalSigner: EVP_MD_CTX_new a échoué");
+
+        Signature sig{};
+        std::size_t len = sig.size();
+        const bool ok = EVP_DigestSignInit(ctx.get(), nullptr, nullptr, nullptr, static_cast<EVP_PKEY *>(key_)) == 1 &&
+                        EVP_DigestSign(ctx.get(), sig.data(), &len, message.data(), message.size()) == 1;
+        EVP_MD_CTX_reset(ctx.get());
+        if (!ok || len != sig.size())
+            throw std::runtime_error("DigitalSigner: signature impossible");
+        return sig;
+    }
+#else
+    DigitalSigner::DigitalSigner(const PrivateKey &)
+    {
+        throw std::runtime_error("DigitalSigner: compilé sans OpenSSL");
+    }
+
+    DigitalSigner::~DigitalSigner() = default;
+
+    Signature DigitalSigner::sign(std::span<const std::uint8_t>) const
+    {
+        throw std::runtime_error("DigitalSigner: compilé sans OpenSSL");
+    }
+#endif
+}
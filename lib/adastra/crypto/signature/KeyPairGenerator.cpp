@@ -0,0 +1,50 @@
+#include <adastra/crypto/signature/KeyPairGenerator.hpp>
+#include <adastra/crypto/random/SecureRandom.hpp>
+
+#include <stdexcept>
+
+#if defined(SA_HAS_OPENSSL)
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#endif
+
+namespace adastra::crypto::signature
+{
+    KeyPair KeyPairGenerator::generate()
+    {
+        PrivateKey seed;
+        random::SecureRandom::fill(seed.data(), seed.size());
+        KeyPair pair = fromSeed(seed);
+#if defined(SA_HAS_OPENSSL)
+        OPENSSL_cleanse(seed.data(), seed.size());
+#endif
+        return pair;
+    }
+
+    KeyPair KeyPairGenerator::fromSeed(const PrivateKey &seed)
+    {
+        return KeyPair{publicKeyOf(seed), seed};
+    }
+
+#if defined(SA_HAS_OPENSSL)
+    PublicKey KeyPairGenerator::publicKeyOf(const PrivateKey &seed)
+    {
+        EVP_PKEY *pkey = EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, nullptr, seed.data(), seed.size());
+        if (!pkey)
+            throw std::runtime_error("KeyPairGenerator: clé Ed25519 invalide");
+
+        PublicKey pub{};
+        std::size_t len = pub.size();
+        const int ok = EVP_PKEY_get_raw_public_key(pkey, pub.data(), &len);
+        EVP_PKEY_free(pkey);
+        if (ok != 1 || len != pub.size())
+            throw std::runtime_error("KeyPairGenerator: dérivation de la clé publique impossible");
+        return pub;
+    }
+#else
+    PublicKey KeyPairGenerator::publicKeyOf(const PrivateKey &)
+    {
+        throw std::runtime_error("KeyPairGenerator: compilé sans OpenSSL");
+    }
+#endif
+}
@@ -0,0 +1,207 @@
+#include <adastra/crypto/signature/SignatureVeirifer.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+
+#if defined(SA_HAS_OPENSSL)
+#include <openssl/evp.h>
+#endif
+
+namespace adastra::crypto::signature
+{
+    namespace
+    {
+        // En dessous, le réveil du pool coûte plus que les vérifications.
+        constexpr std::size_t kParallelMin = 16;
+
+        // Signatures par tâche du pool.
+        constexpr std::size_t kGrain = 4;
+    }
+
+    std::size_t SignatureVerifier::DigestHash::operator()(const Digest &d) const noexcept
+    {
+        std::size_t h;
+        std::memcpy(&h, d.data(), sizeof(h));
+        return h;
+    }
+
+    SignatureVerifier::SignatureVerifier(VerifierOptions options)
+        : options_(options)
+    {
+        if (options_.cacheCapacity > 0)
+        {
+            const std::size_t shards = std::max<std::size_t>(1, std::min(options_.cacheShards, options_.cacheCapacity));
+            perShard_ = (options_.cacheCapacity + shards - 1) / shards;
+            shards_.reserve(shards);
+            for (std::size_t i = 0; i < shards; ++i)
+            {
+                shards_.push_back(std::make_unique<Shard>());
+                shards_.back()->entries.reserve(perShard_);
+            }
+        }
+    }
+
+    SignatureVerifier::Digest SignatureVerifier::cacheKey(const PublicKey &key, std::span<const std::uint8_t> message,
+                                                          const Signature &signature)
+    {
+        hash::SHA256Hasher h;
+        h.update(key.data(), key.size());
+        h.update(signature.data(), signature.size());
+        h.update(message.data(), message.size());
+        return h.finalize();
+    }
+
+    SignatureVerifier::Shard &SignatureVerifier::shardOf(const Digest &d)
+    {
+        // Octets différents de ceux de DigestHash pour ne pas corréler shard et bucket.
+        std::uint32_t h;
+        std::memcpy(&h, d.data() + 8, sizeof(h));
+        return *shards_[h % shards_.size()];
+    }
+
+    bool SignatureVerifier::cached(const Digest &d)
+    {
+        if (shards_.empty())
+            return false;
+
+        Shard &s = shardOf(d);
+        std::shared_lock<std::shared_mutex> lock(s.mutex);
+        return s.entries.count(d) != 0;
+    }
+
+    void SignatureVerifier::remember(const Digest &d)
+    {
+        if (shards_.empty())
+            return;
+
+        Shard &s = shardOf(d);
+        std::unique_lock<std::shared_mutex> lock(s.mutex);
+        if (!s.entries.insert(d).second)
+            return;
+
+        if (s.fifo.size() < perShard_)
+        {
+            s.fifo.push_back(d);
+            return;
+        }
+
+        // Shard plein : la plus ancienne entrée laisse sa place.
+        s.entries.erase(s.fifo[s.next]);
+        s.fifo[s.next] = d;
+        s.next = (s.next + 1) % perShard_;
+    }
+
+    bool SignatureVerifier::check(const SignedMessage &item, const Digest &d)
+    {
+        verified_.fetch_add(1, std::memory_order_relaxed);
+        if (!verifyUncached(*item.key, item.message, *item.signature))
+        {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        remember(d);
+        return true;
+    }
+
+    bool SignatureVerifier::verify(const PublicKey &key, std::span<const std::uint8_t> message, const Signature &signature)
+    {
+        const Digest d = cacheKey(key, message, signature);
+        if (cached(d))
+        {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return check({&key, message, &signature}, d);
+    }
+
+    std::size_t SignatureVerifier::verifyBatch(std::span<const SignedMessage> items, std::span<bool> results)
+    {
+        if (results.size() < items.size())
+            throw std::invalid_argument("SignatureVerifier::verifyBatch: results trop petit");
+
+        std::vector<std::size_t> misses;
+        std::vector<Digest> keys;
+
+        std::size_t valid = 0;
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+            Digest d = cacheKey(*items[i].key, items[i].message, *items[i].signature);
+            if (cached(d))
+            {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                results[i] = true;
+                ++valid;
+                continue;
+            }
+            misses.push_back(i);
+            keys.push_back(d);
+        }
+
+        auto checkRange = [&](std::size_t begin, std::size_t end)
+        {
+            std::size_t ok = 0;
+            for (std::size_t k = begin; k < end; ++k)
+            {
+                const std::size_t i = misses[k];
+                results[i] = check(items[i], keys[k]);
+                ok += results[i];
+            }
+            return ok;
+        };
+
+        if (misses.size() < kParallelMin)
+            return valid + checkRange(0, misses.size());
+
+        // Le thread appelant participe ; le pool partagé prend le reste par paquets.
+        return valid + adastra::core::concurrency::TaskScheduler::shared().parallelReduce(
+                           0, misses.size(), std::size_t{0}, checkRange, std::plus<std::size_t>(),
+                           {kGrain, options_.workers});
+    }
+
+    void SignatureVerifier::clearCache()
+    {
+        for (auto &s : shards_)
+        {
+            std::unique_lock<std::shared_mutex> lock(s->mutex);
+            s->entries.clear();
+            s->fifo.clear();
+            s->next = 0;
+        }
+    }
+
+    VerifierStats SignatureVerifier::stats() const
+    {
+        return {hits_.load(std::memory_order_relaxed),
+                verified_.load(std::memory_order_relaxed),
+                rejected_.load(std::memory_order_relaxed)};
+    }
+
+#if defined(SA_HAS_OPENSSL)
+    bool SignatureVerifier::verifyUncached(const PublicKey &key, std::span<const std::uint8_t> message,
+                                           const Signature &signature)
+    {
+        thread_local std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+        if (!ctx)
+            throw std::runtime_error("SignatureVerifier: EVP_MD_CTX_new a échoué");
+
+        EVP_PKEY *pkey = EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519, nullptr, key.data(), key.size());
+        if (!pkey)
+            return false;
+
+        const bool ok = EVP_DigestVerifyInit(ctx.get(), nullptr, nullptr, nullptr, pkey) == 1 &&
+                        EVP_DigestVerify(ctx.get(), signature.data(), signature.size(),
+                                         message.data(), message.size()) == 1;
+        EVP_MD_CTX_reset(ctx.get());
+        EVP_PKEY_free(pkey);
+        return ok;
+    }
+#else
+    bool SignatureVerifier::verifyUncached(const PublicKey &, std::span<const std::uint8_t>, const Signature &)
+    {
+        throw std::runtime_error("SignatureVerifier: compilé sans OpenSSL");
+    }
+#endif
+}
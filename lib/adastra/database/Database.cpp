@@ -1 +1,208 @@
 #include <adastra/database/Database.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(SA_HAS_SQLITE)
+#include <sqlite3.h>
+#endif
+
+namespace adastra::database
+{
+#if defined(SA_HAS_SQLITE)
+    namespace
+    {
+        [[noreturn]] void fail(sqlite3 *db, const std::string &what)
+        {
+            throw std::runtime_error("SQLite: " + what + ": " + (db ? sqlite3_errmsg(db) : "connexion absente"));
+        }
+    }
+
+    Statement::Statement(sqlite3 *db, std::string_view sql)
+        : db_(db)
+    {
+        if (sqlite3_prepare_v3(db_, sql.data(), static_cast<int>(sql.size()), SQLITE_PREPARE_PERSISTENT, &stmt_, nullptr) != SQLITE_OK)
+            fail(db_, "préparation de « " + std::string(sql) + " »");
+    }
+
+    Statement::~Statement()
+    {
+        sqlite3_finalize(stmt_);
+    }
+
+    Statement &Statement::bind(int index, std::int64_t value)
+    {
+        if (sqlite3_bind_int64(stmt_, index, value) != SQLITE_OK)
+            fail(db_, "bind");
+        return *this;
+    }
+
+    Statement &Statement::bind(int index, double value)
+    {
+        if (sqlite3_bind_double(stmt_, index, value) != SQLITE_OK)
+            fail(db_, "bind");
+        return *this;
+    }
+
+    Statement &Statement::bind(int index, std::string_view text)
+    {
+        if (sqlite3_bind_text64(stmt_, index, text.data(), text.size(), SQLITE_TRANSIENT, SQLITE_UTF8) != SQLITE_OK)
+            fail(db_, "bind");
+        return *this;
+    }
+
+    Statement &Statement::bindNull(int index)
+    {
+        if (sqlite3_bind_null(stmt_, index) != SQLITE_OK)
+            fail(db_, "bind");
+        return *this;
+    }
+
+    bool Statement::step()
+    {
+        const int rc = sqlite3_step(stmt_);
+        if (rc == SQLITE_ROW)
+            return true;
+        if (rc == SQLITE_DONE)
+            return false;
+        fail(db_, "exécution de « " + std::string(sqlite3_sql(stmt_)) + " »");
+    }
+
+    void Statement::run()
+    {
+        while (step())
+        {
+        }
+    }
+
+    void Statement::reset()
+    {
+        sqlite3_reset(stmt_);
+        sqlite3_clear_bindings(stmt_);
+    }
+
+    bool Statement::isNull(int column) const
+    {
+        return sqlite3_column_type(stmt_, column) == SQLITE_NULL;
+    }
+
+    std::int64_t Statement::columnInt64(int column) const
+    {
+        return sqlite3_column_int64(stmt_, column);
+    }
+
+    double Statement::columnDouble(int column) const
+    {
+        return sqlite3_column_double(stmt_, column);
+    }
+
+    std::string_view Statement::columnText(int column) const
+    {
+        const auto *text = sqlite3_column_text(stmt_, column);
+        return text ? std::string_view(reinterpret_cast<const char *>(text), static_cast<std::size_t>(sqlite3_column_bytes(stmt_, column)))
+                    : std::string_view();
+    }
+
+    Connection::Connection(const std::string &path, ConnectionOptions options)
+        : options_(options)
+    {
+        // NOMUTEX : une connexion par thread, le verrouillage interne de SQLite est inutile.
+        const int flags = (options_.readOnly ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) |
+                          SQLITE_OPEN_NOMUTEX;
+        if (sqlite3_open_v2(path.c_str(), &db_, flags, nullptr) != SQLITE_OK)
+        {
+            const std::string message = db_ ? sqlite3_errmsg(db_) : "mémoire insuffisante";
+            sqlite3_close(db_);
+            throw std::runtime_error("SQLite: impossible d'ouvrir " + path + ": " + message);
+        }
+
+        sqlite3_busy_timeout(db_, options_.busyTimeoutMs);
+        exec("PRAGMA mmap_size=" + std::to_string(options_.mmapSize) +
+             ";PRAGMA cache_size=-" + std::to_string(options_.cacheSizeKiB) +
+             ";PRAGMA temp_store=MEMORY");
+        if (options_.readOnly)
+            exec("PRAGMA query_only=1");
+    }
+
+    Connection::~Connection()
+    {
+        statements_.clear(); // finalisées avant la fermeture
+        sqlite3_close(db_);
+    }
+
+    void Connection::exec(std::string_view sql)
+    {
+        const std::string text(sql);
+        char *error = nullptr;
+        if (sqlite3_exec(db_, text.c_str(), nullptr, nullptr, &error) != SQLITE_OK)
+        {
+            const std::string message = error ? error : sqlite3_errmsg(db_);
+            sqlite3_free(error);
+            throw std::runtime_error("SQLite: « " + text + " »: " + message);
+        }
+    }
+
+    std::int64_t Connection::lastInsertId() const
+    {
+        return sqlite3_last_insert_rowid(db_);
+    }
+
+    int Connection::changes() const
+    {
+        return sqlite3_changes(db_);
+    }
+#else
+    Statement::Statement(sqlite3 *db, std::string_view)
+        : db_(db)
+    {
+        throw std::runtime_error("SQLite: support non compilé (SA_HAS_SQLITE)");
+    }
+
+    Statement::~Statement() = default;
+    Statement &Statement::bind(int, std::int64_t) { return *this; }
+    Statement &Statement::bind(int, double) { return *this; }
+    Statement &Statement::bind(int, std::string_view) { return *this; }
+    Statement &Statement::bindNull(int) { return *this; }
+    bool Statement::step() { return false; }
+    void Statement::run() {}
+    void Statement::reset() {}
+    bool Statement::isNull(int) const { return true; }
+    std::int64_t Statement::columnInt64(int) const { return 0; }
+    double Statement::columnDouble(int) const { return 0; }
+    std::string_view Statement::columnText(int) const { return {}; }
+
+    Connection::Connection(const std::string &, ConnectionOptions options)
+        : options_(options)
+    {
+        throw std::runtime_error("SQLite: support non compilé (SA_HAS_SQLITE)");
+    }
+
+    Connection::~Connection() = default;
+    void Connection::exec(std::string_view) {}
+    std::int64_t Connection::lastInsertId() const { return 0; }
+    int Connection::changes() const { return 0; }
+#endif
+
+    Statement &Connection::prepare(const std::string &sql)
+    {
+        auto it = statements_.find(sql);
+        if (it != statements_.end())
+        {
+            lru_.splice(lru_.begin(), lru_, it->second.lru);
+            it->second.statement->reset();
+            return *it->second.statement;
+        }
+
+        auto statement = std::make_unique<Statement>(db_, sql);
+        if (statements_.size() >= std::max<std::size_t>(1, options_.statementCache))
+        {
+            statements_.erase(lru_.back());
+            lru_.pop_back();
+        }
+        lru_.push_front(sql);
+        auto &slot = statements_[sql];
+        slot.statement = std::move(statement);
+        slot.lru = lru_.begin();
+        return *slot.statement;
+    }
+}
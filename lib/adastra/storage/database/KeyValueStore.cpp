@@ -0,0 +1,1117 @@
+#include <adastra/storage/database/KeyValueStore.hpp>
+#include <adastra/storage/filesystem/MappedFile.hpp>
+#include <adastra/tools/time/DurationFormatter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define SA_KV_X86 1
+#include <nmmintrin.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace adastra::storage::database
+{
+    namespace
+    {
+        using adastra::storage::filesystem::MappedFile;
+
+        // Enregistrement : crc32c | keyLen | valueLen | seq | clé | valeur.
+        // Le CRC couvre tout ce qui le suit ; un tombstone n'a pas de valeur.
+        constexpr std::size_t kHeader = 20;
+        constexpr std::uint32_t kTombstone = 0xFFFFFFFFu;
+        constexpr std::size_t kMaxKey = std::size_t{64} << 10;
+        constexpr std::size_t kMaxValue = std::size_t{256} << 20;
+        constexpr std::uint64_t kMaxSegment = std::uint64_t{1} << 30; // offsets sur 32 bits
+
+        // Hint : magic | id du segment | entrées (seq | offset | keyLen | valueLen | clé) | crc32c.
+        constexpr char kHintMagic[8] = {'S', 'A', 'K', 'V', 'H', 'N', 'T', '1'};
+        constexpr std::size_t kHintHeader = 12;
+        constexpr std::size_t kHintEntry = 20;
+
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        template <typename T>
+        T load(const std::uint8_t *p)
+        {
+            T v;
+            std::memcpy(&v, p, sizeof(T));
+            return v;
+        }
+
+        template <typename T>
+        void store(std::uint8_t *p, T v)
+        {
+            std::memcpy(p, &v, sizeof(T));
+        }
+
+        // ---- CRC32C (Castagnoli) : instruction SSE4.2 si présente
+        std::uint32_t crc32cPortable(std::uint32_t crc, const std::uint8_t *p, std::size_t n)
+        {
+            static const auto table = []
+            {
+                std::array<std::uint32_t, 256> t{};
+                for (std::uint32_t i = 0; i < 256; ++i)
+                {
+                    std::uint32_t c = i;
+                    for (int k = 0; k < 8; ++k)
+                        c = (c & 1) ? (c >> 1) ^ 0x82F63B78u : c >> 1;
+                    t[i] = c;
+                }
+                return t;
+            }();
+
+            for (std::size_t i = 0; i < n; ++i)
+                crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+            return crc;
+        }
+
+#if SA_KV_X86
+        __attribute__((target("sse4.2"))) std::uint32_t crc32cHw(std::uint32_t crc, const std::uint8_t *p, std::size_t n)
+        {
+            std::uint64_t c = crc;
+            for (; n >= 8; p += 8, n -= 8)
+                c = _mm_crc32_u64(c, load<std::uint64_t>(p));
+            auto c32 = static_cast<std::uint32_t>(c);
+            for (; n > 0; ++p, --n)
+                c32 = _mm_crc32_u8(c32, *p);
+            return c32;
+        }
+#endif
+
+        std::uint32_t crc32c(const std::uint8_t *p, std::size_t n)
+        {
+#if SA_KV_X86
+            static const bool hw = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("sse4.2") != 0;
+            }();
+            if (hw)
+                return ~crc32cHw(0xFFFFFFFFu, p, n);
+#endif
+            return ~crc32cPortable(0xFFFFFFFFu, p, n);
+        }
+
+        std::uint64_t hashKey(std::string_view key)
+        {
+            return std::hash<std::string_view>{}(key);
+        }
+
+        std::uint64_t recordBytes(std::uint32_t keyLen, std::uint32_t valueLen)
+        {
+            return kHeader + keyLen + (valueLen == kTombstone ? 0 : valueLen);
+        }
+
+        bool writeAll(int fd, const void *data, std::size_t length, std::uint64_t offset)
+        {
+            auto *src = static_cast<const std::uint8_t *>(data);
+            while (length > 0)
+            {
+                const ssize_t n = ::pwrite(fd, src, length, static_cast<off_t>(offset));
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    return false;
+                src += n;
+                offset += static_cast<std::uint64_t>(n);
+                length -= static_cast<std::size_t>(n);
+            }
+            return true;
+        }
+
+        void syncDirectory(const std::string &dir)
+        {
+            const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0)
+                return;
+            ::fsync(fd);
+            ::close(fd);
+        }
+
+        std::string segmentName(std::uint32_t id, const char *ext)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "%010u%s", id, ext);
+            return name;
+        }
+
+        // Parcourt les enregistrements intègres de [data, data + size) ; retourne la
+        // longueur de la partie valide (le reste est une fin tronquée ou corrompue).
+        template <typename Fn>
+        std::uint64_t forEachRecord(const std::uint8_t *data, std::uint64_t size, Fn &&fn)
+        {
+            std::uint64_t pos = 0;
+            while (size - pos >= kHeader)
+            {
+                const std::uint8_t *h = data + pos;
+                const auto keyLen = load<std::uint32_t>(h + 4);
+                const auto valueLen = load<std::uint32_t>(h + 8);
+                if (keyLen > kMaxKey || (valueLen != kTombstone && valueLen > kMaxValue))
+                    break;
+
+                const std::uint64_t len = recordBytes(keyLen, valueLen);
+                if (len > size - pos || crc32c(h + 4, len - 4) != load<std::uint32_t>(h))
+                    break;
+
+                fn(load<std::uint64_t>(h + 12), static_cast<std::uint32_t>(pos), keyLen, valueLen,
+                   std::string_view(reinterpret_cast<const char *>(h + kHeader), keyLen), h);
+                pos += len;
+            }
+            return pos;
+        }
+
+        // Contenu complet d'un segment scellé, projeté ou copié si mmap a échoué.
+        struct SegmentBytes
+        {
+            const std::uint8_t *data = nullptr;
+            std::vector<std::uint8_t> copy;
+
+            explicit SegmentBytes(const MappedFile &file)
+            {
+                if (file.mapped() || file.size() == 0)
+                {
+                    data = file.data();
+                    return;
+                }
+                copy.resize(file.size());
+                file.read(0, copy.data(), copy.size());
+                data = copy.data();
+            }
+        };
+    }
+
+    struct KeyValueStore::Segment
+    {
+        std::uint32_t id = 0;
+        std::string path;
+        int fd = -1; // lecture/écriture, gardé pour fdatasync et les lectures du segment actif
+        std::atomic<std::uint64_t> size{0};
+        std::unique_ptr<MappedFile> map; // segments scellés (indexMutex_)
+        bool sealed = false;             // indexMutex_
+        std::uint64_t deadBytes = 0;     // indexMutex_
+        std::atomic<bool> hinted{false};
+
+        ~Segment()
+        {
+            if (fd >= 0)
+                ::close(fd);
+        }
+
+        std::string hintPath() const
+        {
+            return path.substr(0, path.size() - 5) + ".hint";
+        }
+
+        void read(std::uint64_t offset, void *out, std::size_t length) const
+        {
+            if (map)
+            {
+                map->read(offset, out, length);
+                return;
+            }
+
+            auto *dst = static_cast<std::uint8_t *>(out);
+            while (length > 0)
+            {
+                const ssize_t n = ::pread(fd, dst, length, static_cast<off_t>(offset));
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    throw std::runtime_error("KeyValueStore: lecture courte dans " + path);
+                dst += n;
+                offset += static_cast<std::uint64_t>(n);
+                length -= static_cast<std::size_t>(n);
+            }
+        }
+    };
+
+    KeyValueStore::KeyValueStore(std::string directory, KeyValueOptions options)
+        : directory_(std::move(directory)), options_(options)
+    {
+        options_.segmentBytes = std::clamp<std::uint64_t>(options_.segmentBytes, 4096, kMaxSegment);
+
+        const auto t0 = std::chrono::steady_clock::now();
+        open();
+        const auto took = std::chrono::steady_clock::now() - t0;
+        openSeconds_ = std::chrono::duration<double>(took).count();
+
+        std::cerr << "[KeyValueStore] " << used_ << " clés chargées depuis " << directory_
+                  << " (hint=" << hintSegments_ << " scan=" << scannedSegments_ << ", "
+                  << adastra::tools::time::formatDuration(took) << ")\n";
+        maybeScheduleMaintenance();
+    }
+
+    KeyValueStore::~KeyValueStore()
+    {
+        closing_ = true;
+        {
+            std::lock_guard<std::mutex> lock(maintenanceTaskMutex_);
+            if (maintenanceTask_.valid())
+                maintenanceTask_.wait();
+        }
+
+        // Le segment actif est scellé avec son hint : la prochaine ouverture n'a rien à relire.
+        try
+        {
+            std::lock_guard<std::mutex> guard(maintenanceMutex_);
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            if (active_->size.load() == 0)
+            {
+                std::remove(active_->path.c_str());
+            }
+            else
+            {
+                if (::fdatasync(active_->fd) != 0)
+                    throw std::runtime_error("fdatasync de " + active_->path + " a échoué");
+                active_->map = std::make_unique<MappedFile>(active_->path);
+                active_->sealed = true;
+                ++unhinted_;
+            }
+
+            for (auto &[id, segment] : segments_)
+                if (segment->sealed && !segment->hinted)
+                    writeHint(*segment);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[KeyValueStore] ⚠️ fermeture de " << directory_ << " : " << e.what() << "\n";
+        }
+    }
+
+    // ---------------------------------------------------------------- index
+
+    std::size_t KeyValueStore::findSlot(std::string_view key, std::uint64_t hash) const
+    {
+        if (slots_.empty())
+            return npos;
+
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = hash & mask; slots_[i].segment != 0; i = (i + 1) & mask)
+        {
+            const Slot &s = slots_[i];
+            if (s.hash == hash && s.keyLen == key.size() && keyMatches(s, key))
+                return i;
+        }
+        return npos;
+    }
+
+    // Un enregistrement est identifié par (segment, offset) : aucune clé à relire.
+    std::size_t KeyValueStore::findRecord(std::uint64_t hash, std::uint32_t segment, std::uint32_t offset) const
+    {
+        if (slots_.empty())
+            return npos;
+
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = hash & mask; slots_[i].segment != 0; i = (i + 1) & mask)
+        {
+            const Slot &s = slots_[i];
+            if (s.hash == hash && s.segment == segment && s.offset == offset)
+                return i;
+        }
+        return npos;
+    }
+
+    bool KeyValueStore::keyMatches(const Slot &slot, std::string_view key) const
+    {
+        const Segment &segment = *segments_.at(slot.segment);
+        const std::uint64_t at = std::uint64_t{slot.offset} + kHeader;
+        if (segment.map && segment.map->mapped())
+            return std::memcmp(segment.map->data() + at, key.data(), key.size()) == 0;
+
+        std::string stored(slot.keyLen, '\0');
+        segment.read(at, stored.data(), stored.size());
+        return stored == key;
+    }
+
+    std::string KeyValueStore::readValue(const Slot &slot) const
+    {
+        std::string value(slot.valueLen, '\0');
+        segments_.at(slot.segment)->read(std::uint64_t{slot.offset} + kHeader + slot.keyLen, value.data(), value.size());
+        return value;
+    }
+
+    void KeyValueStore::growIndex()
+    {
+        std::vector<Slot> old(std::max<std::size_t>(1024, slots_.size() * 2), Slot{0, 0, 0, 0, 0, 0});
+        old.swap(slots_);
+
+        const std::size_t mask = slots_.size() - 1;
+        for (const Slot &s : old)
+        {
+            if (s.segment == 0)
+                continue;
+            std::size_t i = s.hash & mask;
+            while (slots_[i].segment != 0)
+                i = (i + 1) & mask;
+            slots_[i] = s;
+        }
+    }
+
+    void KeyValueStore::markDead(std::uint32_t segment, std::uint64_t bytes)
+    {
+        const auto it = segments_.find(segment);
+        if (it != segments_.end())
+            it->second->deadBytes += bytes;
+        deadBytes_ += bytes;
+    }
+
+    void KeyValueStore::upsert(std::string_view key, std::uint64_t hash, const Slot &slot)
+    {
+        const std::size_t pos = findSlot(key, hash);
+        if (pos != npos)
+        {
+            const Slot &old = slots_[pos];
+            if (old.valueLen != kTombstone) // un tombstone est compté mort dès son écriture
+                markDead(old.segment, recordBytes(old.keyLen, old.valueLen));
+            slots_[pos] = slot;
+            return;
+        }
+
+        if ((used_ + 1) * 4 > slots_.size() * 3)
+            growIndex();
+
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t i = hash & mask;
+        while (slots_[i].segment != 0)
+            i = (i + 1) & mask;
+        slots_[i] = slot;
+        ++used_;
+    }
+
+    // Suppression par décalage arrière : pas de marqueur, les sondages restent courts.
+    void KeyValueStore::eraseAt(std::size_t pos)
+    {
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t hole = pos;
+        for (std::size_t j = (hole + 1) & mask; slots_[j].segment != 0; j = (j + 1) & mask)
+        {
+            const std::size_t home = slots_[j].hash & mask;
+            // L'entrée reste si sa case d'origine est dans (hole, j] (cycliquement).
+            const bool stays = hole <= j ? (hole < home && home <= j) : (hole < home || home <= j);
+            if (stays)
+                continue;
+            slots_[hole] = slots_[j];
+            hole = j;
+        }
+        slots_[hole].segment = 0;
+        --used_;
+    }
+
+    // ---------------------------------------------------------------- ouverture
+
+    void KeyValueStore::open()
+    {
+        fs::create_directories(directory_);
+
+        std::vector<std::uint32_t> ids;
+        for (const auto &entry : fs::directory_iterator(directory_))
+        {
+            const fs::path &p = entry.path();
+            const std::string stem = p.stem().string();
+            if (p.extension() == ".tmp")
+            {
+                std::error_code ec;
+                fs::remove(p, ec); // hint interrompu
+                continue;
+            }
+            if (p.extension() != ".data" || stem.empty() ||
+                !std::all_of(stem.begin(), stem.end(), [](char c)
+                             { return c >= '0' && c <= '9'; }))
+                continue;
+            ids.push_back(static_cast<std::uint32_t>(std::stoul(stem)));
+        }
+        std::sort(ids.begin(), ids.end());
+
+        for (const std::uint32_t id : ids)
+        {
+            auto segment = std::make_shared<Segment>();
+            segment->id = id;
+            segment->path = (fs::path(directory_) / segmentName(id, ".data")).string();
+            segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CLOEXEC);
+            if (segment->fd < 0)
+                throw std::runtime_error("KeyValueStore: impossible d'ouvrir " + segment->path + ": " + std::strerror(errno));
+            segment->map = std::make_unique<MappedFile>(segment->path);
+            segment->size = segment->map->size();
+            segment->sealed = true;
+            segments_[id] = segment;
+            nextSegment_ = id + 1;
+
+            if (loadHint(*segment))
+            {
+                segment->hinted = true;
+                ++hintSegments_;
+            }
+            else
+            {
+                scanSegment(*segment);
+                ++scannedSegments_;
+                ++unhinted_;
+            }
+
+            if (segment->size.load() == 0)
+            {
+                segments_.erase(id);
+                if (!segment->hinted)
+                    --unhinted_;
+                std::remove(segment->path.c_str());
+                std::remove(segment->hintPath().c_str());
+            }
+        }
+
+        dropTombstones();
+        writtenSeq_ = syncedSeq_ = nextSeq_ - 1;
+        nextCheck_ = deadBytes_.load() + options_.compactMinBytes;
+
+        active_ = createSegment();
+        segments_[active_->id] = active_;
+    }
+
+    void KeyValueStore::loadRecord(std::uint32_t segment, const Located &rec, std::string_view key)
+    {
+        nextSeq_ = std::max(nextSeq_, rec.seq + 1);
+
+        const std::uint64_t hash = hashKey(key);
+        const std::uint64_t bytes = recordBytes(rec.keyLen, rec.valueLen);
+        const Slot slot{hash, rec.seq, segment, rec.offset, rec.keyLen, rec.valueLen};
+
+        // Le plus grand numéro de séquence gagne ; les tombstones restent dans
+        // l'index jusqu'à la fin du chargement pour masquer les valeurs plus anciennes.
+        const std::size_t pos = findSlot(key, hash);
+        if (pos != npos && slots_[pos].seq >= rec.seq)
+        {
+            if (rec.valueLen != kTombstone)
+                markDead(segment, bytes);
+        }
+        else
+        {
+            upsert(key, hash, slot);
+        }
+
+        if (rec.valueLen == kTombstone)
+            markDead(segment, bytes);
+    }
+
+    bool KeyValueStore::loadHint(Segment &segment)
+    {
+        const std::string path = segment.hintPath();
+        if (!fs::exists(path))
+            return false;
+
+        try
+        {
+            MappedFile file(path);
+            const SegmentBytes bytes(file);
+            const std::uint8_t *p = bytes.data;
+            const std::uint64_t size = file.size();
+
+            if (size < kHintHeader + 4 || std::memcmp(p, kHintMagic, sizeof(kHintMagic)) != 0 ||
+                load<std::uint32_t>(p + 8) != segment.id ||
+                crc32c(p, size - 4) != load<std::uint32_t>(p + size - 4))
+                throw std::runtime_error("en-tête ou CRC invalide");
+
+            // Validation complète avant d'appliquer quoi que ce soit à l'index.
+            const std::uint64_t end = size - 4;
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (std::uint64_t pos = kHintHeader; pos < end;)
+                {
+                    if (end - pos < kHintEntry)
+                        throw std::runtime_error("entrée tronquée");
+
+                    const Located rec{load<std::uint64_t>(p + pos), load<std::uint32_t>(p + pos + 8),
+                                      load<std::uint32_t>(p + pos + 12), load<std::uint32_t>(p + pos + 16)};
+                    if (rec.keyLen > kMaxKey || end - pos - kHintEntry < rec.keyLen ||
+                        rec.offset + recordBytes(rec.keyLen, rec.valueLen) > segment.size.load())
+                        throw std::runtime_error("entrée hors du segment");
+
+                    if (pass == 1)
+                        loadRecord(segment.id, rec,
+                                   std::string_view(reinterpret_cast<const char *>(p + pos + kHintEntry), rec.keyLen));
+                    pos += kHintEntry + rec.keyLen;
+                }
+            }
+            return true;
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[KeyValueStore] ⚠️ hint ignoré " << path << " : " << e.what() << "\n";
+            return false;
+        }
+    }
+
+    void KeyValueStore::scanSegment(Segment &segment)
+    {
+        const SegmentBytes bytes(*segment.map);
+        const std::uint64_t valid = forEachRecord(
+            bytes.data, segment.size.load(),
+            [&](std::uint64_t seq, std::uint32_t offset, std::uint32_t keyLen, std::uint32_t valueLen,
+                std::string_view key, const std::uint8_t *)
+            { loadRecord(segment.id, Located{seq, offset, keyLen, valueLen}, key); });
+
+        if (valid == segment.size.load())
+            return;
+
+        // Fin écrite pendant un crash : coupée pour que le segment reste lisible d'un bout à l'autre.
+        std::cerr << "[KeyValueStore] ⚠️ " << segment.path << " tronqué à " << valid << " octets (sur "
+                  << segment.size.load() << ")\n";
+        segment.map.reset();
+        if (::ftruncate(segment.fd, static_cast<off_t>(valid)) != 0 || ::fdatasync(segment.fd) != 0)
+            throw std::runtime_error("KeyValueStore: impossible de tronquer " + segment.path);
+        segment.map = std::make_unique<MappedFile>(segment.path);
+        segment.size = valid;
+    }
+
+    void KeyValueStore::dropTombstones()
+    {
+        if (std::none_of(slots_.begin(), slots_.end(), [](const Slot &s)
+                         { return s.segment != 0 && s.valueLen == kTombstone; }))
+            return;
+
+        std::vector<Slot> old(slots_.size(), Slot{0, 0, 0, 0, 0, 0});
+        old.swap(slots_);
+        used_ = 0;
+
+        const std::size_t mask = slots_.size() - 1;
+        for (const Slot &s : old)
+        {
+            if (s.segment == 0 || s.valueLen == kTombstone)
+                continue;
+            std::size_t i = s.hash & mask;
+            while (slots_[i].segment != 0)
+                i = (i + 1) & mask;
+            slots_[i] = s;
+            ++used_;
+        }
+    }
+
+    // ---------------------------------------------------------------- écriture
+
+    KeyValueStore::SegmentPtr KeyValueStore::createSegment()
+    {
+        auto segment = std::make_shared<Segment>();
+        segment->id = nextSegment_++;
+        segment->path = (fs::path(directory_) / segmentName(segment->id, ".data")).string();
+        segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (segment->fd < 0)
+            throw std::runtime_error("KeyValueStore: impossible de créer " + segment->path + ": " + std::strerror(errno));
+        syncDirectory(directory_);
+        return segment;
+    }
+
+    // Scelle le segment actif (durable, projeté en mémoire) et en ouvre un nouveau.
+    void KeyValueStore::rotate()
+    {
+        if (::fdatasync(active_->fd) != 0)
+            throw std::runtime_error("KeyValueStore: fdatasync de " + active_->path + " a échoué");
+        ++syncs_;
+        syncedSeq_ = writtenSeq_;
+        synced_.notify_all();
+
+        auto map = std::make_unique<MappedFile>(active_->path);
+        auto next = createSegment();
+        {
+            std::unique_lock<std::shared_mutex> lock(indexMutex_);
+            active_->map = std::move(map);
+            active_->sealed = true;
+            segments_[next->id] = next;
+        }
+        active_ = std::move(next);
+        ++unhinted_;
+    }
+
+    std::uint64_t KeyValueStore::append(std::string_view key, std::string_view value, bool tombstone)
+    {
+        const auto keyLen = static_cast<std::uint32_t>(key.size());
+        const std::uint32_t valueLen = tombstone ? kTombstone : static_cast<std::uint32_t>(value.size());
+        const std::uint64_t len = recordBytes(keyLen, valueLen);
+
+        if (active_->size.load() > 0 && active_->size.load() + len > options_.segmentBytes)
+            rotate();
+
+        const std::uint64_t seq = nextSeq_;
+        thread_local std::vector<std::uint8_t> record;
+        record.resize(len);
+        store(record.data() + 4, keyLen);
+        store(record.data() + 8, valueLen);
+        store(record.data() + 12, seq);
+        std::memcpy(record.data() + kHeader, key.data(), key.size());
+        if (!tombstone)
+            std::memcpy(record.data() + kHeader + key.size(), value.data(), value.size());
+        store(record.data(), crc32c(record.data() + 4, len - 4));
+
+        const std::uint64_t offset = active_->size.load();
+        if (!writeAll(active_->fd, record.data(), record.size(), offset))
+        {
+            const int err = errno;
+            [[maybe_unused]] const int rc = ::ftruncate(active_->fd, static_cast<off_t>(offset));
+            throw std::runtime_error("KeyValueStore: écriture dans " + active_->path + " a échoué: " + std::strerror(err));
+        }
+        active_->size = offset + len;
+        ++nextSeq_;
+        if (record.capacity() > (std::size_t{1} << 20))
+            std::vector<std::uint8_t>().swap(record); // pas de grosse valeur gardée par thread
+        writtenSeq_ = seq;
+
+        const std::uint64_t hash = hashKey(key);
+        std::unique_lock<std::shared_mutex> lock(indexMutex_);
+        if (tombstone)
+        {
+            const std::size_t pos = findSlot(key, hash);
+            if (pos != npos)
+            {
+                markDead(slots_[pos].segment, recordBytes(slots_[pos].keyLen, slots_[pos].valueLen));
+                eraseAt(pos);
+            }
+            markDead(active_->id, len);
+        }
+        else
+        {
+            upsert(key, hash, Slot{hash, seq, active_->id, static_cast<std::uint32_t>(offset), keyLen, valueLen});
+        }
+        return seq;
+    }
+
+    // Commit groupé : le premier écrivain qui trouve la voie libre synchronise tout
+    // ce qui a été écrit jusque-là, les suivants attendent son fdatasync.
+    void KeyValueStore::waitDurable(std::unique_lock<std::mutex> &lock, std::uint64_t seq)
+    {
+        while (syncedSeq_ < seq)
+        {
+            if (syncing_)
+            {
+                synced_.wait(lock);
+                continue;
+            }
+
+            syncing_ = true;
+            const SegmentPtr segment = active_;
+            const std::uint64_t target = writtenSeq_;
+            lock.unlock();
+
+            const bool ok = ::fdatasync(segment->fd) == 0;
+
+            lock.lock();
+            syncing_ = false;
+            if (ok)
+            {
+                syncedSeq_ = std::max(syncedSeq_, target);
+                ++syncs_;
+            }
+            synced_.notify_all();
+            if (!ok)
+                throw std::runtime_error("KeyValueStore: fdatasync de " + segment->path + " a échoué");
+        }
+    }
+
+    void KeyValueStore::put(std::string_view key, std::string_view value)
+    {
+        if (key.size() > kMaxKey || value.size() > kMaxValue)
+            throw std::length_error("KeyValueStore: clé ou valeur trop grande");
+
+        {
+            std::unique_lock<std::mutex> lock(writeMutex_);
+            const std::uint64_t seq = append(key, value, false);
+            ++puts_;
+            if (options_.syncWrites)
+                waitDurable(lock, seq);
+        }
+        maybeScheduleMaintenance();
+    }
+
+    bool KeyValueStore::remove(std::string_view key)
+    {
+        if (key.size() > kMaxKey)
+            return false;
+
+        {
+            std::unique_lock<std::mutex> lock(writeMutex_);
+            if (!contains(key))
+                return false;
+            const std::uint64_t seq = append(key, {}, true);
+            ++removes_;
+            if (options_.syncWrites)
+                waitDurable(lock, seq);
+        }
+        maybeScheduleMaintenance();
+        return true;
+    }
+
+    std::int64_t KeyValueStore::increment(std::string_view key, std::int64_t delta)
+    {
+        if (key.size() > kMaxKey)
+            throw std::length_error("KeyValueStore: clé trop grande");
+
+        std::int64_t next = 0;
+        {
+            // writeMutex_ tenu de la lecture à l'écriture : aucun put ne s'intercale.
+            std::unique_lock<std::mutex> lock(writeMutex_);
+            std::int64_t current = 0;
+            if (const auto stored = get(key))
+            {
+                const auto [end, ec] = std::from_chars(stored->data(), stored->data() + stored->size(), current);
+                if (ec != std::errc() || end != stored->data() + stored->size())
+                    throw std::invalid_argument("KeyValueStore: la valeur n'est pas un compteur");
+            }
+            if (__builtin_add_overflow(current, delta, &next))
+                throw std::overflow_error("KeyValueStore: dépassement du compteur");
+
+            const std::string text = std::to_string(next);
+            const std::uint64_t seq = append(key, text, false);
+            ++puts_;
+            if (options_.syncWrites)
+                waitDurable(lock, seq);
+        }
+        maybeScheduleMaintenance();
+        return next;
+    }
+
+    void KeyValueStore::sync()
+    {
+        std::unique_lock<std::mutex> lock(writeMutex_);
+        waitDurable(lock, writtenSeq_);
+    }
+
+    // ---------------------------------------------------------------- lecture
+
+    std::optional<std::string> KeyValueStore::get(std::string_view key) const
+    {
+        const std::uint64_t hash = hashKey(key);
+        std::shared_lock<std::shared_mutex> lock(indexMutex_);
+        const std::size_t pos = findSlot(key, hash);
+        if (pos == npos)
+            return std::nullopt;
+        return readValue(slots_[pos]);
+    }
+
+    bool KeyValueStore::contains(std::string_view key) const
+    {
+        const std::uint64_t hash = hashKey(key);
+        std::shared_lock<std::shared_mutex> lock(indexMutex_);
+        return findSlot(key, hash) != npos;
+    }
+
+    std::size_t KeyValueStore::size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(indexMutex_);
+        return used_;
+    }
+
+    KeyValueStats KeyValueStore::stats() const
+    {
+        KeyValueStats s;
+        {
+            std::shared_lock<std::shared_mutex> lock(indexMutex_);
+            s.keys = used_;
+            s.indexCapacity = slots_.size();
+            s.segments = segments_.size();
+            for (const auto &[id, segment] : segments_)
+            {
+                s.diskBytes += segment->size.load();
+                s.deadBytes += segment->deadBytes;
+            }
+        }
+        s.puts = puts_.load();
+        s.removes = removes_.load();
+        s.syncs = syncs_.load();
+        s.compactions = compactions_.load();
+        s.reclaimedBytes = reclaimed_.load();
+        s.hintSegments = hintSegments_;
+        s.scannedSegments = scannedSegments_;
+        s.openSeconds = openSeconds_;
+        return s;
+    }
+
+    // ---------------------------------------------------------------- fond
+
+    void KeyValueStore::maybeScheduleMaintenance()
+    {
+        if (!options_.backgroundCompaction || closing_.load())
+            return;
+        if (unhinted_.load() == 0 && deadBytes_.load() < nextCheck_.load())
+            return;
+        if (maintenanceQueued_.exchange(true))
+            return;
+
+        std::lock_guard<std::mutex> lock(maintenanceTaskMutex_);
+        maintenanceTask_ = adastra::core::concurrency::TaskScheduler::shared().submit(
+            [this]
+            {
+                try
+                {
+                    maintenance(false);
+                }
+                catch (const std::exception &e)
+                {
+                    std::cerr << "[KeyValueStore] ⚠️ maintenance de " << directory_ << " : " << e.what() << "\n";
+                }
+                maintenanceQueued_ = false;
+            },
+            adastra::core::concurrency::TaskPriority::Background);
+    }
+
+    std::uint64_t KeyValueStore::maintenance(bool force)
+    {
+        std::lock_guard<std::mutex> guard(maintenanceMutex_);
+
+        std::vector<SegmentPtr> unhinted;
+        std::uint64_t sealedBytes = 0, sealedDead = 0;
+        {
+            std::shared_lock<std::shared_mutex> lock(indexMutex_);
+            for (const auto &[id, segment] : segments_)
+            {
+                if (!segment->sealed)
+                    continue;
+                if (!segment->hinted)
+                    unhinted.push_back(segment);
+                sealedBytes += segment->size.load();
+                sealedDead += segment->deadBytes;
+            }
+        }
+
+        for (const auto &segment : unhinted)
+        {
+            if (closing_.load())
+                return 0;
+            writeHint(*segment);
+        }
+
+        std::uint64_t reclaimed = 0;
+        if (force || (sealedDead >= options_.compactMinBytes &&
+                      static_cast<double>(sealedDead) >= options_.compactRatio * static_cast<double>(sealedBytes)))
+            reclaimed = merge();
+
+        nextCheck_ = deadBytes_.load() + options_.compactMinBytes;
+        return reclaimed;
+    }
+
+    void KeyValueStore::writeHint(Segment &segment)
+    {
+        std::vector<std::uint8_t> out(kHintHeader);
+        std::memcpy(out.data(), kHintMagic, sizeof(kHintMagic));
+        store(out.data() + 8, segment.id);
+
+        const SegmentBytes bytes(*segment.map);
+        forEachRecord(bytes.data, segment.size.load(),
+                      [&](std::uint64_t seq, std::uint32_t offset, std::uint32_t keyLen, std::uint32_t valueLen,
+                          std::string_view key, const std::uint8_t *)
+                      {
+                          const std::size_t at = out.size();
+                          out.resize(at + kHintEntry + keyLen);
+                          store(out.data() + at, seq);
+                          store(out.data() + at + 8, offset);
+                          store(out.data() + at + 12, keyLen);
+                          store(out.data() + at + 16, valueLen);
+                          std::memcpy(out.data() + at + kHintEntry, key.data(), keyLen);
+                      });
+        const std::uint32_t crc = crc32c(out.data(), out.size());
+        out.resize(out.size() + 4);
+        store(out.data() + out.size() - 4, crc);
+
+        // Écrit à côté puis renommé : un hint présent est toujours complet.
+        const std::string path = segment.hintPath();
+        const std::string tmp = path + ".tmp";
+        const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("KeyValueStore: impossible de créer " + tmp);
+        const bool ok = writeAll(fd, out.data(), out.size(), 0) && ::fdatasync(fd) == 0;
+        ::close(fd);
+        if (!ok || std::rename(tmp.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmp.c_str());
+            throw std::runtime_error("KeyValueStore: écriture de " + path + " a échoué");
+        }
+        syncDirectory(directory_);
+
+        if (!segment.hinted.exchange(true))
+            --unhinted_;
+    }
+
+    // Réécrit les valeurs vivantes de tous les segments scellés dans de nouveaux
+    // segments, bascule l'index puis supprime les anciens fichiers. Les écritures
+    // continuent pendant la fusion : une valeur remplacée entre-temps n'est pas
+    // rebasculée et reste comptée morte dans le nouveau segment.
+    std::uint64_t KeyValueStore::merge()
+    {
+        struct Move
+        {
+            std::uint64_t hash;
+            std::uint32_t fromSegment;
+            std::uint32_t fromOffset;
+            std::uint32_t toSegment;
+            std::uint32_t toOffset;
+            std::uint32_t bytes;
+        };
+
+        std::vector<SegmentPtr> inputs;
+        {
+            std::shared_lock<std::shared_mutex> lock(indexMutex_);
+            for (const auto &[id, segment] : segments_)
+                if (segment->sealed)
+                    inputs.push_back(segment);
+        }
+        if (inputs.empty())
+            return 0;
+
+        std::vector<SegmentPtr> outputs;
+        std::vector<Move> moves;
+        std::vector<std::uint64_t> newest(inputs.size(), 0); // plus grand seq de chaque entrée
+        std::vector<std::uint8_t> buffer;
+        buffer.reserve(1 << 20);
+
+        const auto flushBuffer = [&]
+        {
+            Segment &out = *outputs.back();
+            if (!buffer.empty() && !writeAll(out.fd, buffer.data(), buffer.size(), out.size.load() - buffer.size()))
+                throw std::runtime_error("KeyValueStore: écriture dans " + out.path + " a échoué");
+            buffer.clear();
+        };
+        const auto sealOutput = [&]
+        {
+            flushBuffer();
+            Segment &out = *outputs.back();
+            if (::fdatasync(out.fd) != 0)
+                throw std::runtime_error("KeyValueStore: fdatasync de " + out.path + " a échoué");
+            out.map = std::make_unique<MappedFile>(out.path);
+            out.sealed = true;
+            ++unhinted_; // rendu par writeHint()
+            writeHint(out);
+        };
+        const auto abandon = [&]
+        {
+            for (const auto &out : outputs)
+            {
+                if (out->sealed && !out->hinted.exchange(true))
+                    --unhinted_;
+                std::remove(out->path.c_str());
+                std::remove(out->hintPath().c_str());
+            }
+        };
+
+        try
+        {
+            for (std::size_t i = 0; i < inputs.size(); ++i)
+            {
+                const SegmentPtr &in = inputs[i];
+                if (closing_.load())
+                {
+                    abandon();
+                    return 0;
+                }
+
+                const SegmentBytes bytes(*in->map);
+                forEachRecord(
+                    bytes.data, in->size.load(),
+                    [&](std::uint64_t seq, std::uint32_t offset, std::uint32_t keyLen, std::uint32_t valueLen,
+                        std::string_view key, const std::uint8_t *record)
+                    {
+                        newest[i] = std::max(newest[i], seq);
+                        if (valueLen == kTombstone)
+                            return; // les valeurs qu'il masque disparaissent avant lui (voir plus bas)
+
+                        const std::uint64_t hash = hashKey(key);
+                        {
+                            std::shared_lock<std::shared_mutex> lock(indexMutex_);
+                            if (findRecord(hash, in->id, offset) == npos)
+                                return;
+                        }
+
+                        const std::uint64_t len = recordBytes(keyLen, valueLen);
+                        if (outputs.empty() || outputs.back()->size.load() + len > options_.segmentBytes)
+                        {
+                            if (!outputs.empty())
+                                sealOutput();
+                            std::lock_guard<std::mutex> lock(writeMutex_);
+                            outputs.push_back(createSegment());
+                        }
+
+                        Segment &out = *outputs.back();
+                        moves.push_back({hash, in->id, offset, out.id, static_cast<std::uint32_t>(out.size.load()),
+                                         static_cast<std::uint32_t>(len)});
+                        buffer.insert(buffer.end(), record, record + len);
+                        out.size += len;
+                        if (buffer.size() >= (1 << 20))
+                            flushBuffer();
+                    });
+            }
+            if (!outputs.empty())
+                sealOutput();
+        }
+        catch (...)
+        {
+            abandon();
+            throw;
+        }
+
+        std::uint64_t inputBytes = 0, outputBytes = 0;
+        {
+            std::unique_lock<std::shared_mutex> lock(indexMutex_);
+            for (const auto &out : outputs)
+            {
+                segments_[out->id] = out;
+                outputBytes += out->size.load();
+            }
+            for (const Move &m : moves)
+            {
+                const std::size_t pos = findRecord(m.hash, m.fromSegment, m.fromOffset);
+                if (pos == npos)
+                {
+                    markDead(m.toSegment, m.bytes);
+                    continue;
+                }
+                slots_[pos].segment = m.toSegment;
+                slots_[pos].offset = m.toOffset;
+            }
+            for (const auto &in : inputs)
+            {
+                inputBytes += in->size.load();
+                deadBytes_ -= in->deadBytes;
+                segments_.erase(in->id);
+            }
+        }
+
+        // Les tombstones ne sont pas recopiés : les entrées sont supprimées de la plus
+        // ancienne donnée à la plus récente, pour qu'un crash au milieu ne laisse
+        // jamais une valeur sans le tombstone plus récent qui la masque. L'ordre des
+        // ids ne suffit pas : une sortie de fusion a un id récent mais des seq anciens.
+        // Les lecteurs en cours gardent leur SegmentPtr : le fichier supprimé reste lisible.
+        std::vector<std::size_t> order(inputs.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+                  { return newest[a] < newest[b]; });
+        for (const std::size_t i : order)
+        {
+            std::remove(inputs[i]->path.c_str());
+            std::remove(inputs[i]->hintPath().c_str());
+        }
+        syncDirectory(directory_);
+
+        const std::uint64_t reclaimed = inputBytes > outputBytes ? inputBytes - outputBytes : 0;
+        ++compactions_;
+        reclaimed_ += reclaimed;
+        std::cerr << "[KeyValueStore] Fusion de " << inputs.size() << " segments en " << outputs.size()
+                  << " (" << (reclaimed >> 10) << " Kio récupérés)\n";
+        return reclaimed;
+    }
+
+    std::uint64_t KeyValueStore::compact()
+    {
+        return maintenance(true);
+    }
+}
@@ -0,0 +1,195 @@
+#include <adastra/storage/database/LocalDB.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace adastra::storage::database
+{
+    namespace
+    {
+        std::atomic<std::uint64_t> g_instances{0};
+
+        // Connexions de lecture du thread courant, par instance de LocalDB. Le
+        // registre de l'instance les possède : elles se ferment avec elle.
+        thread_local std::unordered_map<std::uint64_t, std::weak_ptr<adastra::database::Connection>> tlsReaders;
+    }
+
+    LocalDB::LocalDB(std::string path, LocalDBOptions options, const std::string &schema)
+        : path_(std::move(path)),
+          options_(options),
+          instance_(++g_instances)
+    {
+        writer_ = std::make_unique<Connection>(path_, connectionOptions(false));
+        writer_->exec("PRAGMA journal_mode=WAL");
+        writer_->exec(options_.fullSync ? "PRAGMA synchronous=FULL" : "PRAGMA synchronous=NORMAL");
+        writer_->exec("PRAGMA foreign_keys=ON");
+
+        if (!schema.empty())
+            write([&](Connection &db)
+                  { db.exec(schema); });
+    }
+
+    LocalDB::~LocalDB()
+    {
+        {
+            std::lock_guard<std::mutex> lock(readersMutex_);
+            readers_.clear();
+        }
+
+        // Statistiques du planificateur mises à jour pour les index réellement utilisés.
+        try
+        {
+            writer_->exec("PRAGMA optimize");
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[LocalDB] ⚠️ " << e.what() << "\n";
+        }
+    }
+
+    adastra::database::ConnectionOptions LocalDB::connectionOptions(bool readOnly) const
+    {
+        adastra::database::ConnectionOptions o;
+        o.readOnly = readOnly;
+        o.mmapSize = options_.mmapSize;
+        o.cacheSizeKiB = options_.cacheSizeKiB;
+        o.busyTimeoutMs = options_.busyTimeoutMs;
+        o.statementCache = options_.statementCache;
+        return o;
+    }
+
+    LocalDB::Connection &LocalDB::readConnection() const
+    {
+        auto it = tlsReaders.find(instance_);
+        if (it != tlsReaders.end())
+        {
+            // Le registre garde la connexion en vie tant que l'instance existe.
+            if (auto *conn = it->second.lock().get())
+                return *conn;
+        }
+
+        auto conn = std::make_shared<Connection>(path_, connectionOptions(true));
+        {
+            std::lock_guard<std::mutex> lock(readersMutex_);
+            readers_.push_back(conn);
+        }
+        tlsReaders[instance_] = conn;
+        return *conn;
+    }
+
+    void LocalDB::runBatch(const std::vector<Job *> &batch)
+    {
+        try
+        {
+            writer_->exec("BEGIN IMMEDIATE");
+        }
+        catch (...)
+        {
+            for (Job *job : batch)
+                job->error = std::current_exception();
+            failedWrites_ += batch.size();
+            return;
+        }
+
+        for (Job *job : batch)
+        {
+            try
+            {
+                writer_->exec("SAVEPOINT sa_write");
+                job->fn(*writer_);
+                writer_->exec("RELEASE sa_write");
+            }
+            catch (...)
+            {
+                job->error = std::current_exception();
+                ++failedWrites_;
+                try
+                {
+                    writer_->exec("ROLLBACK TO sa_write; RELEASE sa_write");
+                }
+                catch (...)
+                {
+                    // Transaction déjà annulée par SQLite : le COMMIT échouera pour tout le lot.
+                }
+            }
+        }
+
+        try
+        {
+            writer_->exec("COMMIT");
+            ++transactions_;
+        }
+        catch (...)
+        {
+            const auto error = std::current_exception();
+            try
+            {
+                writer_->exec("ROLLBACK");
+            }
+            catch (...)
+            {
+            }
+            for (Job *job : batch)
+            {
+                if (!job->error)
+                {
+                    job->error = error;
+                    ++failedWrites_;
+                }
+            }
+        }
+    }
+
+    void LocalDB::write(std::function<void(Connection &)> fn)
+    {
+        Job job{std::move(fn), nullptr, false};
+
+        std::unique_lock<std::mutex> lock(writeMutex_);
+        queue_.push_back(&job);
+        ++writes_;
+
+        while (!job.done)
+        {
+            if (writing_)
+            {
+                written_.wait(lock);
+                continue;
+            }
+
+            // Ce thread valide les écritures en attente (la sienne comprise) pendant
+            // que les suivantes s'accumulent pour le lot d'après.
+            writing_ = true;
+            std::vector<Job *> batch;
+            while (!queue_.empty() && batch.size() < std::max<std::size_t>(1, options_.maxBatch))
+            {
+                batch.push_back(queue_.front());
+                queue_.pop_front();
+            }
+            lock.unlock();
+
+            runBatch(batch);
+
+            lock.lock();
+            for (Job *j : batch)
+                j->done = true;
+            writing_ = false;
+            written_.notify_all();
+        }
+
+        if (job.error)
+            std::rethrow_exception(job.error);
+    }
+
+    LocalDBStats LocalDB::stats() const
+    {
+        LocalDBStats s;
+        s.writes = writes_.load();
+        s.transactions = transactions_.load();
+        s.failedWrites = failedWrites_.load();
+        std::lock_guard<std::mutex> lock(readersMutex_);
+        s.readConnections = readers_.size();
+        return s;
+    }
+}
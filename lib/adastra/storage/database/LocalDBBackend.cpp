@@ -0,0 +1,155 @@
+#include <adastra/storage/database/LocalDBBackend.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace adastra::storage::database
+{
+    namespace
+    {
+        using adastra::database::Connection;
+        using adastra::database::Statement;
+
+        // Noms interpolés dans le SQL : lettres, chiffres et '_' uniquement.
+        const std::string &checkIdentifier(const std::string &name)
+        {
+            const bool ok = !name.empty() && !(name[0] >= '0' && name[0] <= '9') &&
+                            std::all_of(name.begin(), name.end(), [](char c)
+                                        { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                                                 (c >= '0' && c <= '9') || c == '_'; });
+            if (!ok)
+                throw std::invalid_argument("LocalDBBackend: identifiant invalide « " + name + " »");
+            return name;
+        }
+
+        // Même texte que l'expression de l'index, sinon SQLite ne l'utilise pas.
+        std::string fieldExpr(const std::string &field)
+        {
+            return "json_extract(body, '$." + checkIdentifier(field) + "')";
+        }
+
+        void bindJson(Statement &st, int index, const nlohmann::json &value)
+        {
+            if (value.is_number_unsigned())
+                st.bind(index, static_cast<std::int64_t>(value.get<std::uint64_t>()));
+            else if (value.is_number_integer())
+                st.bind(index, value.get<std::int64_t>());
+            else if (value.is_number_float())
+                st.bind(index, value.get<double>());
+            else if (value.is_boolean())
+                st.bind(index, std::int64_t{value.get<bool>() ? 1 : 0}); // json_extract rend 0/1
+            else if (value.is_string())
+                st.bind(index, std::string_view(value.get_ref<const std::string &>()));
+            else
+                throw std::invalid_argument("LocalDBBackend: valeur de recherche non scalaire");
+        }
+
+        std::vector<nlohmann::json> collect(Statement &st)
+        {
+            std::vector<nlohmann::json> out;
+            while (st.step())
+                out.push_back(nlohmann::json::parse(st.columnText(0)));
+            return out;
+        }
+
+        void upsertAll(Connection &db, const std::string &sql,
+                       const std::vector<std::pair<std::uint64_t, nlohmann::json>> &items)
+        {
+            Statement &st = db.prepare(sql);
+            for (const auto &[id, doc] : items)
+            {
+                st.reset();
+                if (id == 0)
+                    st.bindNull(1);
+                else
+                    st.bind(1, static_cast<std::int64_t>(id));
+                st.bind(2, std::string_view(doc.dump())).run();
+            }
+        }
+    }
+
+    LocalDBBackend::LocalDBBackend(std::shared_ptr<LocalDB> db, std::string table, std::vector<std::string> indexedFields)
+        : db_(std::move(db)), table_(checkIdentifier(table))
+    {
+        upsertSql_ = "INSERT INTO " + quoted() + " (id, body) VALUES (?1, ?2) "
+                                                 "ON CONFLICT(id) DO UPDATE SET body = excluded.body";
+
+        std::string schema = "CREATE TABLE IF NOT EXISTS " + quoted() + " (id INTEGER PRIMARY KEY, body TEXT NOT NULL);";
+        for (const auto &field : indexedFields)
+            schema += "CREATE INDEX IF NOT EXISTS \"" + table_ + "_" + checkIdentifier(field) + "\" ON " + quoted() +
+                      " (" + fieldExpr(field) + ");";
+
+        db_->write([&](Connection &c)
+                   { c.exec(schema); });
+    }
+
+    std::vector<nlohmann::json> LocalDBBackend::loadAll()
+    {
+        return db_->read([&](Connection &c)
+                         { return collect(c.prepare("SELECT body FROM " + quoted() + " ORDER BY id")); });
+    }
+
+    void LocalDBBackend::replaceAll(const std::vector<nlohmann::json> &items)
+    {
+        std::vector<std::pair<std::uint64_t, nlohmann::json>> docs;
+        docs.reserve(items.size());
+        for (const auto &item : items)
+            docs.emplace_back(adastra::core::repository::documentId(item), item);
+
+        db_->write([&](Connection &c)
+                   {
+            c.prepare("DELETE FROM " + quoted()).run();
+            upsertAll(c, upsertSql_, docs); });
+    }
+
+    void LocalDBBackend::upsert(const std::vector<std::pair<std::uint64_t, nlohmann::json>> &items)
+    {
+        if (items.empty())
+            return;
+        db_->write([&](Connection &c)
+                   { upsertAll(c, upsertSql_, items); });
+    }
+
+    std::optional<nlohmann::json> LocalDBBackend::findById(std::uint64_t id)
+    {
+        return db_->read([&](Connection &c) -> std::optional<nlohmann::json>
+                         {
+            Statement &st = c.prepare("SELECT body FROM " + quoted() + " WHERE id = ?1");
+            st.bind(1, static_cast<std::int64_t>(id));
+            std::optional<nlohmann::json> doc;
+            if (st.step())
+                doc = nlohmann::json::parse(st.columnText(0));
+            // Une requête laissée en cours garderait ouverte la transaction de
+            // lecture implicite, et la connexion ne verrait plus les écritures.
+            st.reset();
+            return doc; });
+    }
+
+    std::vector<nlohmann::json> LocalDBBackend::findBy(const std::string &field, const nlohmann::json &value,
+                                                       std::size_t limit, std::size_t offset)
+    {
+        const std::string sql = "SELECT body FROM " + quoted() + " WHERE " + fieldExpr(field) +
+                                " = ?1 ORDER BY id LIMIT ?2 OFFSET ?3";
+        const auto clamp = [](std::size_t n)
+        { return static_cast<std::int64_t>(std::min<std::size_t>(n, std::numeric_limits<std::int64_t>::max())); };
+
+        return db_->read([&](Connection &c)
+                         {
+            Statement &st = c.prepare(sql);
+            bindJson(st, 1, value);
+            st.bind(2, clamp(limit)).bind(3, clamp(offset));
+            return collect(st); });
+    }
+
+    std::size_t LocalDBBackend::count()
+    {
+        return db_->read([&](Connection &c)
+                         {
+            Statement &st = c.prepare("SELECT count(*) FROM " + quoted());
+            st.step();
+            const auto n = static_cast<std::size_t>(st.columnInt64(0));
+            st.reset();
+            return n; });
+    }
+}
@@ -0,0 +1,657 @@
+#include <adastra/storage/database/MetadataStore.hpp>
+#include <adastra/storage/filesystem/MappedFile.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SA_METADATA_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace adastra::storage::database
+{
+    namespace
+    {
+        using adastra::storage::filesystem::MappedFile;
+
+        // Fichier de colonne :
+        //   en-tête  magic | rows u32 | blocks u32 | dataWords u64 | réservé u64
+        //   blocs    base u32 | max u32 | offset u32 (en mots) | width u8 | 3 octets nuls
+        //   données  dataWords mots de 32 bits
+        // Un bloc couvre 128 slots, rangés en 4 voies : la valeur i est dans la voie
+        // i % 4, à la position i / 4 du flux de bits de cette voie. Le mot j de la
+        // voie l est data[offset + 4 * j + l] : un bloc de largeur w occupe 4 * w mots.
+        constexpr char kMagic[8] = {'S', 'A', 'M', 'D', 'C', 'O', 'L', '1'};
+        constexpr std::size_t kHeader = 32;
+        constexpr std::size_t kBlockEntry = 16;
+        constexpr std::size_t kBlock = 128;
+
+        template <typename T>
+        T load(const std::uint8_t *p)
+        {
+            T v;
+            std::memcpy(&v, p, sizeof(T));
+            return v;
+        }
+
+        template <typename T>
+        void store(std::uint8_t *p, T v)
+        {
+            std::memcpy(p, &v, sizeof(T));
+        }
+
+        struct Block
+        {
+            std::uint32_t base = 0;
+            std::uint32_t max = 0; // plus grande valeur du bloc : scans qui l'écartent sans le décoder
+            std::uint32_t offset = 0;
+            std::uint32_t width = 0;
+        };
+
+        std::uint32_t widthMask(std::uint32_t width)
+        {
+            return width == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << width) - 1;
+        }
+
+        // Valeur i d'un bloc, sans décoder le reste.
+        std::uint32_t decodeOne(const std::uint32_t *in, const Block &b, std::size_t i)
+        {
+            if (b.width == 0)
+                return b.base;
+            const std::size_t bit = (i / 4) * b.width;
+            const std::size_t lane = i % 4;
+            const std::size_t j = bit / 32;
+            const std::uint32_t s = bit % 32;
+            std::uint32_t v = in[4 * j + lane] >> s;
+            if (s + b.width > 32)
+                v |= in[4 * (j + 1) + lane] << (32 - s);
+            return b.base + (v & widthMask(b.width));
+        }
+
+#if defined(SA_METADATA_SSE2)
+        // SSE2 (toujours disponible en x86-64) : les 4 voies sont décodées ensemble,
+        // avec le même décalage pour les 4 valeurs d'une position.
+        void decodeSse2(const std::uint32_t *in, const Block &b, std::uint32_t *out)
+        {
+            const __m128i base = _mm_set1_epi32(static_cast<int>(b.base));
+            if (b.width == 0)
+            {
+                for (std::size_t k = 0; k < kBlock; k += 4)
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + k), base);
+                return;
+            }
+
+            const __m128i mask = _mm_set1_epi32(static_cast<int>(widthMask(b.width)));
+            for (std::size_t k = 0; k < kBlock / 4; ++k)
+            {
+                const std::size_t bit = k * b.width;
+                const std::size_t j = bit / 32;
+                const int s = static_cast<int>(bit % 32);
+
+                __m128i v = _mm_srl_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4 * j)),
+                                          _mm_cvtsi32_si128(s));
+                if (s + b.width > 32)
+                    v = _mm_or_si128(v, _mm_sll_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4 * (j + 1))),
+                                                      _mm_cvtsi32_si128(32 - s)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4 * k), _mm_add_epi32(_mm_and_si128(v, mask), base));
+            }
+        }
+#endif
+
+        void decodeBlock(const std::uint32_t *in, const Block &b, std::uint32_t *out)
+        {
+#if defined(SA_METADATA_SSE2)
+            decodeSse2(in, b, out);
+#else
+            for (std::size_t i = 0; i < kBlock; ++i)
+                out[i] = decodeOne(in, b, i);
+#endif
+        }
+
+        // Ajoute à `words` le bloc des n premières valeurs de `values` (n <= 128).
+        Block encodeBlock(const std::uint32_t *values, std::size_t n, std::vector<std::uint32_t> &words)
+        {
+            Block b;
+            b.offset = static_cast<std::uint32_t>(words.size());
+            const auto [lo, hi] = std::minmax_element(values, values + n);
+            b.base = *lo;
+            b.max = *hi;
+            b.width = static_cast<std::uint32_t>(std::bit_width(*hi - *lo));
+            if (b.width == 0)
+                return b;
+
+            words.resize(words.size() + 4 * b.width, 0);
+            std::uint32_t *out = words.data() + b.offset;
+            for (std::size_t i = 0; i < kBlock; ++i)
+            {
+                // Les slots après n (fin de colonne) valent base : écart nul.
+                const std::uint32_t v = i < n ? values[i] - b.base : 0;
+                const std::size_t bit = (i / 4) * b.width;
+                const std::size_t lane = i % 4;
+                const std::size_t j = bit / 32;
+                const std::uint32_t s = bit % 32;
+                out[4 * j + lane] |= v << s;
+                if (s + b.width > 32)
+                    out[4 * (j + 1) + lane] |= v >> (32 - s);
+            }
+            return b;
+        }
+
+        bool writeAll(int fd, const void *data, std::size_t length)
+        {
+            auto *src = static_cast<const std::uint8_t *>(data);
+            while (length > 0)
+            {
+                const ssize_t n = ::write(fd, src, length);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    return false;
+                src += n;
+                length -= static_cast<std::size_t>(n);
+            }
+            return true;
+        }
+
+        void syncDirectory(const std::string &dir)
+        {
+            const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0)
+                return;
+            ::fsync(fd);
+            ::close(fd);
+        }
+
+        const std::string &checkName(const std::string &name)
+        {
+            const bool ok = !name.empty() && std::all_of(name.begin(), name.end(), [](char c)
+                                                         { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                                                                  (c >= '0' && c <= '9') || c == '_'; });
+            if (!ok)
+                throw std::invalid_argument("MetadataStore: nom de colonne invalide « " + name + " »");
+            return name;
+        }
+
+        std::string columnPath(const std::string &directory, const std::string &name)
+        {
+            return (fs::path(directory) / (name + ".col")).string();
+        }
+    }
+
+    // Colonne projetée (ou copiée si mmap a échoué), en lecture seule.
+    struct MetadataStore::ColumnFile
+    {
+        std::unique_ptr<MappedFile> map;
+        std::vector<std::uint8_t> copy;
+        const std::uint8_t *blocks = nullptr;
+        const std::uint32_t *data = nullptr;
+        std::uint32_t rows = 0;
+        std::uint32_t blockCount = 0;
+        std::uint64_t bytes = 0;
+
+        // Fichier absent : colonne vide.
+        static ColumnFilePtr open(const std::string &path)
+        {
+            auto file = std::make_shared<ColumnFile>();
+            if (!fs::exists(path))
+                return file;
+
+            file->map = std::make_unique<MappedFile>(path);
+            file->bytes = file->map->size();
+            const std::uint8_t *p = file->map->data();
+            if (!file->map->mapped())
+            {
+                file->copy.resize(file->bytes);
+                file->map->read(0, file->copy.data(), file->copy.size());
+                p = file->copy.data();
+            }
+
+            const auto corrupt = [&](const char *why)
+            { return std::runtime_error("MetadataStore: " + path + " corrompu (" + why + ")"); };
+
+            if (file->bytes < kHeader || std::memcmp(p, kMagic, sizeof(kMagic)) != 0)
+                throw corrupt("en-tête");
+            file->rows = load<std::uint32_t>(p + 8);
+            file->blockCount = load<std::uint32_t>(p + 12);
+            const auto dataWords = load<std::uint64_t>(p + 16);
+            if (file->blockCount != (std::uint64_t{file->rows} + kBlock - 1) / kBlock ||
+                file->bytes != kHeader + kBlockEntry * std::uint64_t{file->blockCount} + 4 * dataWords)
+                throw corrupt("taille");
+
+            file->blocks = p + kHeader;
+            file->data = reinterpret_cast<const std::uint32_t *>(file->blocks + kBlockEntry * file->blockCount);
+            for (std::uint32_t i = 0; i < file->blockCount; ++i)
+            {
+                const Block b = file->block(i);
+                if (b.width > 32 || b.max < b.base || b.offset + std::uint64_t{4} * b.width > dataWords)
+                    throw corrupt("bloc");
+            }
+            return file;
+        }
+
+        Block block(std::size_t i) const
+        {
+            const std::uint8_t *e = blocks + kBlockEntry * i;
+            return {load<std::uint32_t>(e), load<std::uint32_t>(e + 4), load<std::uint32_t>(e + 8), e[12]};
+        }
+
+        // Valeurs du bloc i dans out[0..128) : 0 pour les slots au-delà de rows.
+        void decode(std::size_t i, std::uint32_t *out) const
+        {
+            if (i >= blockCount)
+            {
+                std::fill_n(out, kBlock, 0);
+                return;
+            }
+            const Block b = block(i);
+            decodeBlock(data + b.offset, b, out);
+            const std::size_t start = i * kBlock;
+            if (start + kBlock > rows)
+                std::fill(out + (rows - start), out + kBlock, 0);
+        }
+
+        std::uint32_t value(std::uint32_t slot) const
+        {
+            if (slot >= rows)
+                return 0;
+            const Block b = block(slot / kBlock);
+            return decodeOne(data + b.offset, b, slot % kBlock);
+        }
+
+        // Réécrit la colonne avec `delta` appliqué dans `path` (écrit à côté puis
+        // renommé : un fichier présent est toujours complet).
+        void rewrite(const std::string &path, const std::map<std::uint32_t, std::uint32_t> &delta) const
+        {
+            std::uint64_t rows = this->rows;
+            if (!delta.empty())
+                rows = std::max<std::uint64_t>(rows, std::uint64_t{delta.rbegin()->first} + 1);
+            const std::size_t blockCount = (rows + kBlock - 1) / kBlock;
+
+            std::vector<std::uint8_t> directory(kBlockEntry * blockCount, 0);
+            std::vector<std::uint32_t> words;
+            alignas(16) std::uint32_t values[kBlock];
+
+            auto d = delta.begin();
+            for (std::size_t i = 0; i < blockCount; ++i)
+            {
+                const std::uint64_t start = i * kBlock;
+                const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(kBlock, rows - start));
+                decode(i, values);
+                for (; d != delta.end() && d->first < start + n; ++d)
+                    values[d->first - start] = d->second;
+
+                const Block b = encodeBlock(values, n, words);
+                std::uint8_t *e = directory.data() + kBlockEntry * i;
+                store(e, b.base);
+                store(e + 4, b.max);
+                store(e + 8, b.offset);
+                e[12] = static_cast<std::uint8_t>(b.width);
+            }
+
+            std::uint8_t header[kHeader] = {};
+            std::memcpy(header, kMagic, sizeof(kMagic));
+            store(header + 8, static_cast<std::uint32_t>(rows));
+            store(header + 12, static_cast<std::uint32_t>(blockCount));
+            store(header + 16, static_cast<std::uint64_t>(words.size()));
+
+            const std::string tmp = path + ".tmp";
+            const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0)
+                throw std::runtime_error("MetadataStore: impossible de créer " + tmp);
+            const bool ok = writeAll(fd, header, sizeof(header)) &&
+                            writeAll(fd, directory.data(), directory.size()) &&
+                            writeAll(fd, words.data(), words.size() * sizeof(std::uint32_t)) &&
+                            ::fdatasync(fd) == 0;
+            ::close(fd);
+            if (!ok || std::rename(tmp.c_str(), path.c_str()) != 0)
+            {
+                std::remove(tmp.c_str());
+                throw std::runtime_error("MetadataStore: écriture de " + path + " a échoué");
+            }
+        }
+    };
+
+    MetadataStore::MetadataStore(std::string directory, std::vector<std::string> columns, MetadataStoreOptions options)
+        : directory_(std::move(directory)), options_(options)
+    {
+        std::error_code ec;
+        fs::create_directories(directory_, ec);
+        if (ec)
+            throw std::runtime_error("MetadataStore: impossible de créer " + directory_ + " : " + ec.message());
+
+        columns_.reserve(columns.size());
+        for (auto &name : columns)
+        {
+            checkName(name);
+            if (std::any_of(columns_.begin(), columns_.end(), [&](const ColumnState &c)
+                            { return c.name == name; }))
+                throw std::invalid_argument("MetadataStore: colonne « " + name + " » en double");
+
+            ColumnState state;
+            state.file = ColumnFile::open(columnPath(directory_, name));
+            state.name = std::move(name);
+            columns_.push_back(std::move(state));
+        }
+    }
+
+    MetadataStore::~MetadataStore()
+    {
+        if (backgroundMerge_.valid())
+            backgroundMerge_.wait();
+
+        try
+        {
+            merge();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[MetadataStore] ⚠️ fusion finale de " << directory_ << " : " << e.what() << "\n";
+        }
+    }
+
+    MetadataStore::Column MetadataStore::column(std::string_view name) const
+    {
+        for (std::size_t i = 0; i < columns_.size(); ++i)
+            if (columns_[i].name == name)
+                return i;
+        throw std::out_of_range("MetadataStore: colonne inconnue « " + std::string(name) + " »");
+    }
+
+    // ------------------------------------------------------------ points
+
+    std::uint32_t MetadataStore::valueAt(const ColumnState &column, std::uint32_t slot) const
+    {
+        const auto it = column.delta.find(slot);
+        return it != column.delta.end() ? it->second : column.file->value(slot);
+    }
+
+    std::uint32_t MetadataStore::get(Column c, std::uint32_t slot) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return valueAt(columns_.at(c), slot);
+    }
+
+    void MetadataStore::set(Column c, std::uint32_t slot, std::uint32_t value)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (columns_.at(c).delta.insert_or_assign(slot, value).second)
+            ++pending_;
+        noteUpdate(lock);
+    }
+
+    std::uint32_t MetadataStore::add(Column c, std::uint32_t slot, std::int64_t delta)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ColumnState &column = columns_.at(c);
+
+        const std::int64_t next = std::clamp<std::int64_t>(
+            std::int64_t{valueAt(column, slot)} + delta, 0, std::numeric_limits<std::uint32_t>::max());
+        const auto value = static_cast<std::uint32_t>(next);
+        if (column.delta.insert_or_assign(slot, value).second)
+            ++pending_;
+        noteUpdate(lock);
+        return value;
+    }
+
+    void MetadataStore::noteUpdate(std::unique_lock<std::shared_mutex> &lock)
+    {
+        if (pending_ < options_.maxDelta)
+            return;
+
+        if (!options_.backgroundMerge)
+        {
+            lock.unlock();
+            merge();
+            return;
+        }
+
+        if (mergeScheduled_.exchange(true))
+            return;
+
+        backgroundMerge_ = adastra::core::concurrency::TaskScheduler::shared().submit(
+            [this]
+            {
+                try
+                {
+                    merge();
+                }
+                catch (const std::exception &e)
+                {
+                    std::cerr << "[MetadataStore] ⚠️ fusion de " << directory_ << " : " << e.what() << "\n";
+                }
+                mergeScheduled_ = false;
+            },
+            adastra::core::concurrency::TaskPriority::Background);
+    }
+
+    // ------------------------------------------------------------ scans
+
+    template <typename Fn, typename Skip>
+    void MetadataStore::scan(const ColumnState &column, Fn &&fn, Skip &&skip) const
+    {
+        const ColumnFile &file = *column.file;
+        std::uint64_t rows = file.rows;
+        if (!column.delta.empty())
+            rows = std::max<std::uint64_t>(rows, std::uint64_t{column.delta.rbegin()->first} + 1);
+
+        alignas(16) std::uint32_t values[kBlock];
+        auto d = column.delta.begin();
+        for (std::uint64_t start = 0, i = 0; start < rows; start += kBlock, ++i)
+        {
+            const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(kBlock, rows - start));
+            const bool patched = d != column.delta.end() && d->first < start + n;
+            if (!patched)
+            {
+                const Block b = i < file.blockCount ? file.block(i) : Block{};
+                if (skip(b.base, b.max))
+                    continue;
+            }
+
+            file.decode(i, values);
+            for (; d != column.delta.end() && d->first < start + n; ++d)
+                values[d->first - start] = d->second;
+            fn(static_cast<std::uint32_t>(start), n, values);
+        }
+    }
+
+    void MetadataStore::read(Column c, std::uint32_t begin, std::span<std::uint32_t> out) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const ColumnState &column = columns_.at(c);
+
+        alignas(16) std::uint32_t values[kBlock];
+        std::size_t done = 0;
+        while (done < out.size())
+        {
+            const std::uint64_t slot = std::uint64_t{begin} + done;
+            const std::size_t i = static_cast<std::size_t>(slot / kBlock);
+            const std::size_t from = static_cast<std::size_t>(slot % kBlock);
+            const std::size_t n = std::min(kBlock - from, out.size() - done);
+
+            column.file->decode(i, values);
+            std::copy_n(values + from, n, out.begin() + done);
+            for (auto d = column.delta.lower_bound(static_cast<std::uint32_t>(slot));
+                 d != column.delta.end() && d->first < slot + n; ++d)
+                out[done + (d->first - slot)] = d->second;
+            done += n;
+        }
+    }
+
+    std::uint64_t MetadataStore::sum(Column c) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        std::uint64_t total = 0;
+        scan(
+            columns_.at(c),
+            [&](std::uint32_t, std::size_t n, const std::uint32_t *values)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    total += values[i];
+            },
+            [](std::uint32_t, std::uint32_t max)
+            { return max == 0; });
+        return total;
+    }
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> MetadataStore::top(Column c, std::size_t k) const
+    {
+        using Entry = std::pair<std::uint32_t, std::uint32_t>; // slot, valeur
+        std::vector<Entry> heap;
+        if (k == 0)
+            return heap;
+        heap.reserve(k);
+
+        // Tas dont heap.front() est le plus faible des k retenus. Les slots arrivent
+        // par ordre croissant : à valeur égale, un nouveau slot ne le remplace jamais.
+        const auto stronger = [](const Entry &a, const Entry &b)
+        { return a.second != b.second ? a.second > b.second : a.first < b.first; };
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        scan(
+            columns_.at(c),
+            [&](std::uint32_t start, std::size_t n, const std::uint32_t *values)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const std::uint32_t v = values[i];
+                    if (v == 0 || (heap.size() == k && v <= heap.front().second))
+                        continue;
+                    if (heap.size() == k)
+                    {
+                        std::pop_heap(heap.begin(), heap.end(), stronger);
+                        heap.pop_back();
+                    }
+                    heap.emplace_back(start + static_cast<std::uint32_t>(i), v);
+                    std::push_heap(heap.begin(), heap.end(), stronger);
+                }
+            },
+            [&](std::uint32_t, std::uint32_t max)
+            { return max == 0 || (heap.size() == k && max <= heap.front().second); });
+        lock.unlock();
+
+        std::sort(heap.begin(), heap.end(), [](const Entry &a, const Entry &b)
+                  { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+        return heap;
+    }
+
+    adastra::core::columnar::Selection MetadataStore::atLeast(Column c, std::uint32_t min) const
+    {
+        using namespace adastra::core::columnar;
+
+        Selection out;
+        std::uint64_t words[wordsFor(kBlock)];
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        scan(
+            columns_.at(c),
+            [&](std::uint32_t start, std::size_t n, const std::uint32_t *values)
+            {
+                maskRange(std::span<const std::uint32_t>(values, n), min, std::numeric_limits<std::uint32_t>::max(),
+                          std::span<std::uint64_t>(words, wordsFor(n)));
+                appendSelection(std::span<const std::uint64_t>(words, wordsFor(n)), n, start, out);
+            },
+            [&](std::uint32_t, std::uint32_t max)
+            { return max < min; });
+        return out;
+    }
+
+    // ------------------------------------------------------------ fusion
+
+    // Les colonnes modifiées sont réécrites depuis une copie du delta, sans bloquer
+    // les lectures ni les mises à jour ; seule la bascule des fichiers prend le
+    // verrou exclusif. Une entrée du delta modifiée entre-temps est conservée.
+    void MetadataStore::merge()
+    {
+        std::lock_guard<std::mutex> guard(mergeMutex_);
+
+        struct Job
+        {
+            Column column;
+            ColumnFilePtr old;
+            std::map<std::uint32_t, std::uint32_t> delta;
+            ColumnFilePtr written;
+        };
+        std::vector<Job> jobs;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            for (std::size_t i = 0; i < columns_.size(); ++i)
+                if (!columns_[i].delta.empty())
+                    jobs.push_back({i, columns_[i].file, columns_[i].delta, nullptr});
+        }
+        if (jobs.empty())
+            return;
+
+        for (auto &job : jobs)
+        {
+            const std::string path = columnPath(directory_, columns_[job.column].name);
+            job.old->rewrite(path, job.delta);
+            job.written = ColumnFile::open(path);
+        }
+        syncDirectory(directory_);
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (auto &job : jobs)
+        {
+            ColumnState &column = columns_[job.column];
+            column.file = std::move(job.written);
+            for (const auto &[slot, value] : job.delta)
+            {
+                const auto it = column.delta.find(slot);
+                if (it != column.delta.end() && it->second == value)
+                    column.delta.erase(it);
+            }
+        }
+
+        pending_ = 0;
+        for (const auto &column : columns_)
+            pending_ += column.delta.size();
+        ++merges_;
+    }
+
+    void MetadataStore::flush()
+    {
+        merge();
+    }
+
+    // ------------------------------------------------------------ état
+
+    std::size_t MetadataStore::rows() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        std::size_t rows = 0;
+        for (const auto &column : columns_)
+        {
+            rows = std::max<std::size_t>(rows, column.file->rows);
+            if (!column.delta.empty())
+                rows = std::max<std::size_t>(rows, std::size_t{column.delta.rbegin()->first} + 1);
+        }
+        return rows;
+    }
+
+    MetadataStats MetadataStore::stats() const
+    {
+        MetadataStats s;
+        s.rows = rows();
+        s.merges = merges_.load();
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        s.columns = columns_.size();
+        s.pendingUpdates = pending_;
+        for (const auto &column : columns_)
+            s.packedBytes += column.file->bytes;
+        return s;
+    }
+}
@@ -0,0 +1,133 @@
+#include <adastra/storage/encryption/EncryptedFileWriter.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <unistd.h>
+
+namespace adastra::storage::encryption
+{
+    using adastra::crypto::encryption::EncryptionOptions;
+    using adastra::crypto::encryption::EncryptionStats;
+
+    EncryptedFileWriter::EncryptedFileWriter(const std::string &path, std::span<const std::uint8_t> key,
+                                             EncryptionOptions options)
+        : path_(path),
+          maxBuffered_(options.blockSize * std::max<std::size_t>(2, options.queueDepth)),
+          encryptor_(key, options)
+    {
+        const std::string part = path_ + ".part";
+        std::FILE *out = std::fopen(part.c_str(), "wb");
+        if (!out)
+            throw std::runtime_error("EncryptedFileWriter: impossible de créer " + part);
+
+        worker_ = std::thread([this, out, part]
+                              {
+            try
+            {
+                stats_ = encryptor_.encrypt(
+                    [this](std::uint8_t *buf, std::size_t size) { return pull(buf, size); },
+                    [&](const std::uint8_t *data, std::size_t size) {
+                        if (std::fwrite(data, 1, size, out) != size)
+                            throw std::runtime_error("EncryptedFileWriter: erreur d'écriture de " + part);
+                    });
+                if (std::fflush(out) != 0 || ::fsync(::fileno(out)) != 0)
+                    throw std::runtime_error("EncryptedFileWriter: fsync de " + part + " a échoué");
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                error_ = std::current_exception();
+                cv_.notify_all();
+            }
+            std::fclose(out); });
+    }
+
+    EncryptedFileWriter::~EncryptedFileWriter()
+    {
+        if (closed_)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            aborted_ = true;
+            cv_.notify_all();
+        }
+        if (worker_.joinable())
+            worker_.join();
+        std::remove((path_ + ".part").c_str());
+        std::cerr << "[EncryptedFileWriter] ⚠️ " << path_ << " non fermé, fichier partiel supprimé\n";
+    }
+
+    std::size_t EncryptedFileWriter::pull(std::uint8_t *out, std::size_t size)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]
+                 { return aborted_ || closing_ || !pending_.empty(); });
+        if (aborted_)
+            throw std::runtime_error("EncryptedFileWriter: abandonné");
+
+        std::size_t got = 0;
+        while (got < size && !pending_.empty())
+        {
+            auto &front = pending_.front();
+            const std::size_t n = std::min(size - got, front.size() - pendingFront_);
+            std::memcpy(out + got, front.data() + pendingFront_, n);
+            got += n;
+            pendingFront_ += n;
+            if (pendingFront_ == front.size())
+            {
+                pending_.pop_front();
+                pendingFront_ = 0;
+            }
+        }
+        buffered_ -= got;
+        cv_.notify_all();
+        return got; // 0 seulement après close()
+    }
+
+    void EncryptedFileWriter::write(std::span<const std::uint8_t> data)
+    {
+        if (data.empty())
+            return;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closing_)
+            throw std::logic_error("EncryptedFileWriter: write() après close()");
+        cv_.wait(lock, [&]
+                 { return error_ || buffered_ < maxBuffered_; });
+        if (error_)
+            std::rethrow_exception(error_);
+
+        pending_.emplace_back(data.begin(), data.end());
+        buffered_ += data.size();
+        cv_.notify_all();
+    }
+
+    EncryptionStats EncryptedFileWriter::close()
+    {
+        if (closed_)
+            return stats_;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closing_ = true;
+            cv_.notify_all();
+        }
+        worker_.join();
+        closed_ = true;
+
+        const std::string part = path_ + ".part";
+        if (error_)
+        {
+            std::remove(part.c_str());
+            std::rethrow_exception(error_);
+        }
+        if (std::rename(part.c_str(), path_.c_str()) != 0)
+            throw std::runtime_error("EncryptedFileWriter: impossible de renommer " + part);
+        return stats_;
+    }
+}
@@ -0,0 +1,180 @@
+#include <adastra/storage/encryption/FileDecryptor.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace adastra::storage::encryption
+{
+    using adastra::crypto::encryption::AESCipher;
+    using adastra::crypto::encryption::ContainerHeader;
+
+    namespace
+    {
+        ContainerHeader readHeader(const adastra::storage::filesystem::MappedFile &file)
+        {
+            if (file.size() < ContainerHeader::kSize)
+                throw std::runtime_error("FileDecryptor: fichier trop court " + file.path());
+            std::uint8_t bytes[ContainerHeader::kSize];
+            file.read(0, bytes, sizeof(bytes));
+            return ContainerHeader::parse(bytes);
+        }
+    }
+
+    FileDecryptor::FileDecryptor(const std::string &path, std::span<const std::uint8_t> key)
+        : file_(path), header_(readHeader(file_))
+    {
+        if (key.size() != key_.size())
+            throw std::invalid_argument("FileDecryptor: la clé doit faire 32 octets");
+        std::copy(key.begin(), key.end(), key_.begin());
+
+        // Tous les blocs sont pleins sauf le dernier, strictement plus court.
+        const std::uint64_t body = file_.size() - ContainerHeader::kSize;
+        const std::uint64_t record = header_.recordSize();
+        blockCount_ = body / record + 1;
+        const std::uint64_t lastRecord = body % record;
+        if (lastRecord < ContainerHeader::kRecordOverhead)
+            throw std::runtime_error("FileDecryptor: taille incohérente (fichier tronqué ?) " + path);
+        plaintextSize_ = (blockCount_ - 1) * header_.blockSize + (lastRecord - ContainerHeader::kRecordOverhead);
+
+        // Le dernier bloc (vide si la taille est un multiple de blockSize) porte la
+        // marque final : l'authentifier ici valide plaintextSize_ pour read(), qui
+        // sinon ne le lirait jamais et ne verrait pas une troncature à une frontière.
+        std::vector<std::uint8_t> last(static_cast<std::size_t>(lastRecord - ContainerHeader::kRecordOverhead));
+        try
+        {
+            AESCipher cipher(key_);
+            std::vector<std::uint8_t> record;
+            decryptBlock(cipher, blockCount_ - 1, record, last.data());
+        }
+        catch (...)
+        {
+            std::fill(key_.begin(), key_.end(), std::uint8_t{0}); // pas de destructeur si le constructeur lance
+            throw;
+        }
+        std::fill(last.begin(), last.end(), std::uint8_t{0});
+    }
+
+    FileDecryptor::~FileDecryptor()
+    {
+        std::fill(key_.begin(), key_.end(), std::uint8_t{0});
+    }
+
+    std::size_t FileDecryptor::decryptBlock(AESCipher &cipher, std::uint64_t index,
+                                            std::vector<std::uint8_t> &record, std::uint8_t *out) const
+    {
+        const bool final = index + 1 == blockCount_;
+        const std::size_t length = final ? static_cast<std::size_t>(plaintextSize_ - index * header_.blockSize)
+                                         : header_.blockSize;
+
+        record.resize(length + ContainerHeader::kRecordOverhead);
+        file_.read(header_.recordOffset(index), record.data(), record.size());
+
+        AESCipher::Nonce nonce;
+        AESCipher::Tag tag;
+        std::memcpy(nonce.data(), record.data(), nonce.size());
+        std::memcpy(tag.data(), record.data() + nonce.size() + length, tag.size());
+
+        if (!cipher.decrypt(nonce, header_.aad(index, final), {record.data() + nonce.size(), length}, tag, out))
+            throw std::runtime_error("FileDecryptor: bloc " + std::to_string(index) + " invalide dans " + file_.path());
+        return length;
+    }
+
+    std::vector<std::uint8_t> FileDecryptor::readBlocks(std::uint64_t first, std::uint64_t count) const
+    {
+        if (first > blockCount_ || count > blockCount_ - first)
+            throw std::out_of_range("FileDecryptor::readBlocks: plage hors du fichier");
+
+        // Borné par la taille en clair réelle, pas seulement par count * blockSize.
+        const std::uint64_t end = std::min(plaintextSize_, (first + count) * header_.blockSize);
+        std::vector<std::uint8_t> out(static_cast<std::size_t>(end > first * header_.blockSize ? end - first * header_.blockSize : 0));
+        AESCipher cipher(key_);
+        std::vector<std::uint8_t> record;
+
+        std::size_t written = 0;
+        for (std::uint64_t i = first; i < first + count; ++i)
+            written += decryptBlock(cipher, i, record, out.data() + written);
+        out.resize(written);
+        return out;
+    }
+
+    std::vector<std::uint8_t> FileDecryptor::read(std::uint64_t offset, std::size_t length) const
+    {
+        if (offset >= plaintextSize_ || length == 0)
+            return {};
+        length = static_cast<std::size_t>(std::min<std::uint64_t>(length, plaintextSize_ - offset));
+
+        const std::uint64_t first = offset / header_.blockSize;
+        const std::uint64_t last = (offset + length - 1) / header_.blockSize;
+        auto blocks = readBlocks(first, last - first + 1);
+
+        const std::size_t skip = static_cast<std::size_t>(offset - first * header_.blockSize);
+        return {blocks.begin() + skip, blocks.begin() + skip + length};
+    }
+
+    void FileDecryptor::decryptTo(const std::string &out, unsigned threads) const
+    {
+        const std::string part = out + ".part";
+        const int fd = ::open(part.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0)
+            throw std::runtime_error("FileDecryptor: impossible de créer " + part);
+
+        // Blocs répartis sur le TaskScheduler partagé ; chacun est écrit à son offset (pwrite).
+        auto work = [&](std::size_t begin, std::size_t end)
+        {
+            AESCipher cipher(key_);
+            std::vector<std::uint8_t> record;
+            std::vector<std::uint8_t> plain(header_.blockSize);
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const std::size_t n = decryptBlock(cipher, i, record, plain.data());
+                std::size_t done = 0;
+                while (done < n)
+                {
+                    const ssize_t w = ::pwrite(fd, plain.data() + done, n - done,
+                                               static_cast<off_t>(i * header_.blockSize + done));
+                    if (w < 0 && errno == EINTR)
+                        continue;
+                    if (w <= 0)
+                        throw std::runtime_error("FileDecryptor: erreur d'écriture de " + part);
+                    done += static_cast<std::size_t>(w);
+                }
+            }
+            std::fill(plain.begin(), plain.end(), std::uint8_t{0});
+        };
+
+        auto &scheduler = adastra::core::concurrency::TaskScheduler::shared();
+        if (threads == 0)
+            threads = scheduler.cores();
+        const auto blocks = static_cast<std::size_t>(blockCount_);
+
+        std::exception_ptr error;
+        try
+        {
+            scheduler.parallelFor(0, blocks, work, {std::max<std::size_t>(1, blocks / (4 * threads)), threads});
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        if (!error && ::fsync(fd) != 0)
+            error = std::make_exception_ptr(std::runtime_error("FileDecryptor: fsync de " + part + " a échoué"));
+        ::close(fd);
+
+        if (error || std::rename(part.c_str(), out.c_str()) != 0)
+        {
+            std::remove(part.c_str());
+            if (error)
+                std::rethrow_exception(error);
+            throw std::runtime_error("FileDecryptor: impossible de renommer " + part);
+        }
+    }
+}
@@ -0,0 +1,244 @@
+#include <adastra/storage/filesystem/ChunkManager.hpp>
+#include <adastra/storage/filesystem/MappedFile.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <string_view>
+
+namespace adastra::storage::filesystem
+{
+    namespace
+    {
+        using adastra::crypto::hash::SHA256Hasher;
+
+        // Table gear figée (splitmix64, graine fixe) : les frontières doivent être
+        // identiques d'une exécution et d'une machine à l'autre.
+        constexpr std::array<std::uint64_t, 256> makeGear(std::uint64_t seed)
+        {
+            std::array<std::uint64_t, 256> t{};
+            for (auto &v : t)
+            {
+                seed += 0x9e3779b97f4a7c15ULL;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                v = z ^ (z >> 31);
+            }
+            return t;
+        }
+
+        constexpr auto kGear = makeGear(0x5afeadd5ca1ab1eULL);
+
+        // Gear décalé d'un bit : deux octets par itération avec un seul décalage.
+        constexpr auto kGearShifted = []
+        {
+            std::array<std::uint64_t, 256> t{};
+            for (std::size_t i = 0; i < t.size(); ++i)
+                t[i] = kGear[i] << 1;
+            return t;
+        }();
+
+        // `bits` bits répartis sur les bits 62..16 : les bits hauts du gear hash
+        // dépendent de la fenêtre la plus large. Le bit 63 est exclu pour que
+        // mask << 1 ne perde rien.
+        std::uint64_t spreadMask(unsigned bits)
+        {
+            std::uint64_t mask = 0;
+            const unsigned span = 47;
+            for (unsigned i = 0; i < bits; ++i)
+                mask |= 1ULL << (62 - (i * span) / bits);
+            return mask;
+        }
+
+        std::span<const std::uint8_t> bytesOf(const std::vector<std::uint8_t> &v) { return {v.data(), v.size()}; }
+    }
+
+    // ------------------------------------------------------------------ ChunkRecipe
+
+    nlohmann::json ChunkRecipe::toJson() const
+    {
+        nlohmann::json list = nlohmann::json::array();
+        for (const auto &c : chunks)
+            list.push_back({{"hash", adastra::crypto::hash::toHex(c.hash)}, {"length", c.length}});
+        return {{"size", size}, {"chunks", std::move(list)}};
+    }
+
+    ChunkRecipe ChunkRecipe::fromJson(const nlohmann::json &j)
+    {
+        ChunkRecipe r;
+        r.size = j.at("size").get<std::uint64_t>();
+
+        std::uint64_t total = 0;
+        for (const auto &c : j.at("chunks"))
+        {
+            const auto bytes = adastra::crypto::hash::fromHex(c.at("hash").get<std::string>());
+            if (!bytes || bytes->size() != std::tuple_size_v<Digest>)
+                throw std::invalid_argument("ChunkRecipe: hash invalide");
+
+            ChunkRef ref;
+            std::copy(bytes->begin(), bytes->end(), ref.hash.begin());
+            ref.length = c.at("length").get<std::uint32_t>();
+            total += ref.length;
+            r.chunks.push_back(ref);
+        }
+        if (total != r.size)
+            throw std::invalid_argument("ChunkRecipe: la somme des chunks ne correspond pas à size");
+        return r;
+    }
+
+    // ------------------------------------------------------------------ ContentDefinedChunker
+
+    ContentDefinedChunker::ContentDefinedChunker(ChunkingOptions options)
+        : options_(options)
+    {
+        if (!std::has_single_bit(options_.avgSize) || options_.minSize == 0 ||
+            options_.minSize > options_.avgSize || options_.avgSize > options_.maxSize)
+            throw std::invalid_argument("ContentDefinedChunker: tailles invalides (min <= avg <= max, avg puissance de 2)");
+
+        // Chunking normalisé (niveau 2) : ±2 bits autour de log2(avg).
+        const unsigned bits = static_cast<unsigned>(std::countr_zero(options_.avgSize));
+        maskS_ = spreadMask(bits + 2);
+        maskL_ = spreadMask(bits > 2 ? bits - 2 : 1);
+        maskS2_ = maskS_ << 1;
+        maskL2_ = maskL_ << 1;
+    }
+
+    std::size_t ContentDefinedChunker::cut(std::span<const std::uint8_t> data) const
+    {
+        std::size_t n = data.size();
+        if (n <= options_.minSize)
+            return n;
+        if (n > options_.maxSize)
+            n = options_.maxSize;
+        const std::size_t normal = std::min(n, options_.avgSize);
+
+        const std::uint8_t *p = data.data();
+        std::uint64_t h = 0;
+        std::size_t i = options_.minSize;
+
+        // Deux octets par tour : h << 2 + gear[a] << 1 puis + gear[b]. Tester
+        // le premier octet avec mask << 1 équivaut à tester h << 1 + gear[a]
+        // avec mask : mêmes frontières qu'octet par octet.
+        for (; i + 1 < normal; i += 2)
+        {
+            h = (h << 2) + kGearShifted[p[i]];
+            if (!(h & maskS2_))
+                return i + 1;
+            h += kGear[p[i + 1]];
+            if (!(h & maskS_))
+                return i + 2;
+        }
+        for (; i < normal; ++i)
+        {
+            h = (h << 1) + kGear[p[i]];
+            if (!(h & maskS_))
+                return i + 1;
+        }
+
+        for (; i + 1 < n; i += 2)
+        {
+            h = (h << 2) + kGearShifted[p[i]];
+            if (!(h & maskL2_))
+                return i + 1;
+            h += kGear[p[i + 1]];
+            if (!(h & maskL_))
+                return i + 2;
+        }
+        for (; i < n; ++i)
+        {
+            h = (h << 1) + kGear[p[i]];
+            if (!(h & maskL_))
+                return i + 1;
+        }
+        return n;
+    }
+
+    std::vector<std::size_t> ContentDefinedChunker::split(std::span<const std::uint8_t> data) const
+    {
+        std::vector<std::size_t> lengths;
+        lengths.reserve(data.size() / options_.avgSize + 1);
+        while (!data.empty())
+        {
+            const std::size_t len = cut(data);
+            lengths.push_back(len);
+            data = data.subspan(len);
+        }
+        return lengths;
+    }
+
+    // ------------------------------------------------------------------ ChunkManager
+
+    ChunkManager::ChunkManager(ChunkStore &store, ChunkingOptions options)
+        : store_(store), chunker_(options) {}
+
+    ChunkRecipe ChunkManager::store(std::span<const std::uint8_t> data, StoreStats *stats)
+    {
+        const auto lengths = chunker_.split(data);
+
+        // Tous les chunks sont hachés d'un coup (hashMany : SHA-NI ou 8 voies AVX2).
+        std::vector<std::string_view> views;
+        views.reserve(lengths.size());
+        std::size_t offset = 0;
+        for (std::size_t len : lengths)
+        {
+            views.emplace_back(reinterpret_cast<const char *>(data.data()) + offset, len);
+            offset += len;
+        }
+        std::vector<Digest> hashes(views.size());
+        SHA256Hasher::hashMany(views, hashes);
+
+        ChunkRecipe recipe;
+        recipe.size = data.size();
+        recipe.chunks.reserve(views.size());
+
+        StoreStats local;
+        local.chunks = views.size();
+        offset = 0;
+        for (std::size_t i = 0; i < views.size(); ++i)
+        {
+            const auto chunk = data.subspan(offset, lengths[i]);
+            if (store_.put(hashes[i], chunk))
+            {
+                ++local.chunksWritten;
+                local.bytesWritten += chunk.size();
+            }
+            else
+            {
+                local.bytesReused += chunk.size();
+            }
+            recipe.chunks.push_back({hashes[i], static_cast<std::uint32_t>(lengths[i])});
+            offset += lengths[i];
+        }
+
+        if (stats)
+            *stats = local;
+        return recipe;
+    }
+
+    ChunkRecipe ChunkManager::storeFile(const std::string &path, StoreStats *stats)
+    {
+        MappedFile file(path);
+        if (file.mapped() || file.size() == 0)
+            return store({file.data(), static_cast<std::size_t>(file.size())}, stats);
+
+        std::vector<std::uint8_t> data(static_cast<std::size_t>(file.size()));
+        file.read(0, data.data(), data.size());
+        return store(bytesOf(data), stats);
+    }
+
+    std::vector<std::uint8_t> ChunkManager::assemble(const ChunkRecipe &recipe) const
+    {
+        std::vector<std::uint8_t> out;
+        out.reserve(static_cast<std::size_t>(recipe.size));
+        for (const auto &ref : recipe.chunks)
+        {
+            auto chunk = store_.get(ref.hash);
+            if (!chunk || chunk->size() != ref.length)
+                throw std::runtime_error("ChunkManager: chunk manquant " + adastra::crypto::hash::toHex(ref.hash));
+            out.insert(out.end(), chunk->begin(), chunk->end());
+        }
+        return out;
+    }
+}
@@ -0,0 +1,218 @@
+#include <adastra/storage/filesystem/ChunkStore.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace adastra::storage::filesystem
+{
+    namespace
+    {
+        using adastra::crypto::hash::SHA256Hasher;
+
+        std::atomic<std::uint64_t> g_tmpCounter{0};
+
+        // Contenu synchronisé avant le rename : sans cela, un crash peut laisser
+        // un chunk renommé mais vide ou tronqué.
+        bool writeFile(const std::string &path, std::span<const std::uint8_t> data)
+        {
+            const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0)
+                return false;
+
+            const std::uint8_t *p = data.data();
+            std::size_t left = data.size();
+            while (left > 0)
+            {
+                const ssize_t n = ::write(fd, p, left);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                {
+                    ::close(fd);
+                    return false;
+                }
+                p += n;
+                left -= static_cast<std::size_t>(n);
+            }
+            const bool synced = ::fdatasync(fd) == 0;
+            return ::close(fd) == 0 && synced;
+        }
+
+        void syncDirectory(const fs::path &dir)
+        {
+            const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0)
+                return;
+            ::fsync(fd);
+            ::close(fd);
+        }
+
+        // Lit exactement data.size() octets ; false si le fichier a une autre taille.
+        bool readAll(std::FILE *f, std::vector<std::uint8_t> &data)
+        {
+            const bool ok = std::fread(data.data(), 1, data.size(), f) == data.size() && std::fgetc(f) == EOF;
+            std::fclose(f);
+            return ok;
+        }
+    }
+
+    ChunkStore::ChunkStore(std::string root, bool verify)
+        : root_(std::move(root))
+    {
+        const fs::path objects = fs::path(root_) / "objects";
+        fs::create_directories(objects);
+
+        std::size_t removed = 0;
+        for (const auto &entry : fs::recursive_directory_iterator(objects))
+        {
+            if (!entry.is_regular_file())
+                continue;
+
+            // Nom = les 62 derniers chiffres hex, le dossier = les 2 premiers.
+            const std::string name = entry.path().filename().string();
+            const std::string hex = entry.path().parent_path().filename().string() + name;
+            const auto bytes = adastra::crypto::hash::fromHex(hex);
+            if (!bytes || bytes->size() != std::tuple_size_v<Digest>)
+            {
+                // Fichier temporaire d'un put() interrompu.
+                if (name.find(".tmp.") != std::string::npos)
+                    std::remove(entry.path().c_str());
+                continue;
+            }
+
+            Digest d;
+            std::copy(bytes->begin(), bytes->end(), d.begin());
+            const auto size = static_cast<std::uint64_t>(entry.file_size());
+            if (verify)
+            {
+                std::vector<std::uint8_t> data(size);
+                std::FILE *f = std::fopen(entry.path().c_str(), "rb");
+                if (!f || !readAll(f, data) || SHA256Hasher::hash(data.data(), data.size()) != d)
+                {
+                    std::remove(entry.path().c_str());
+                    ++removed;
+                    continue;
+                }
+            }
+            sizes_.emplace(d, size);
+            totalBytes_ += size;
+        }
+
+        if (removed > 0)
+            std::cerr << "[ChunkStore] ⚠️ " << removed << " chunk(s) corrompu(s) supprimé(s) dans " << root_ << "\n";
+    }
+
+    std::string ChunkStore::pathOf(const Digest &hash) const
+    {
+        const std::string hex = adastra::crypto::hash::toHex(hash);
+        return (fs::path(root_) / "objects" / hex.substr(0, 2) / hex.substr(2)).string();
+    }
+
+    bool ChunkStore::put(const Digest &hash, std::span<const std::uint8_t> data)
+    {
+        const std::string path = pathOf(hash);
+        if (contains(hash))
+        {
+            // Contrôle bon marché (un stat) : un chunk tronqué ou disparu est réécrit.
+            struct stat st{};
+            if (::stat(path.c_str(), &st) == 0 && static_cast<std::uint64_t>(st.st_size) == data.size())
+                return false;
+            forget(hash);
+        }
+
+        const fs::path dir = fs::path(path).parent_path();
+        const bool newDir = fs::create_directories(dir);
+
+        // Deux écrivains du même chunk écrivent le même contenu : le dernier
+        // rename gagne, sans effet visible.
+        const std::string tmp = path + ".tmp." + std::to_string(::getpid()) + "." +
+                                std::to_string(g_tmpCounter.fetch_add(1, std::memory_order_relaxed));
+        if (!writeFile(tmp, data))
+        {
+            std::remove(tmp.c_str());
+            throw std::runtime_error("ChunkStore: écriture impossible de " + tmp);
+        }
+        std::error_code ec;
+        fs::rename(tmp, path, ec);
+        if (ec)
+        {
+            std::remove(tmp.c_str());
+            throw std::runtime_error("ChunkStore: rename " + path + ": " + ec.message());
+        }
+        syncDirectory(dir);
+        if (newDir)
+            syncDirectory(dir.parent_path());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sizes_.emplace(hash, data.size()).second)
+            totalBytes_ += data.size();
+        return true;
+    }
+
+    bool ChunkStore::contains(const Digest &hash) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return sizes_.count(hash) > 0;
+    }
+
+    std::optional<std::vector<std::uint8_t>> ChunkStore::get(const Digest &hash) const
+    {
+        if (!contains(hash))
+            return std::nullopt;
+
+        const std::string path = pathOf(hash);
+        std::FILE *f = std::fopen(path.c_str(), "rb");
+        if (!f)
+            return std::nullopt;
+
+        std::vector<std::uint8_t> data(sizeOf(hash));
+        if (!readAll(f, data) || SHA256Hasher::hash(data.data(), data.size()) != hash)
+        {
+            forget(hash);
+            throw std::runtime_error("ChunkStore: chunk corrompu " + path);
+        }
+        return data;
+    }
+
+    void ChunkStore::forget(const Digest &hash) const
+    {
+        std::remove(pathOf(hash).c_str());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = sizes_.find(hash);
+        if (it == sizes_.end())
+            return;
+        totalBytes_ -= it->second;
+        sizes_.erase(it);
+    }
+
+    std::uint64_t ChunkStore::sizeOf(const Digest &hash) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = sizes_.find(hash);
+        return it == sizes_.end() ? 0 : it->second;
+    }
+
+    std::size_t ChunkStore::chunkCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return sizes_.size();
+    }
+
+    std::uint64_t ChunkStore::totalBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return totalBytes_;
+    }
+}
@@ -0,0 +1,183 @@
+#include <adastra/storage/filesystem/FileHasher.hpp>
+#include <adastra/storage/filesystem/MappedFile.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace adastra::storage::filesystem
+{
+    namespace
+    {
+        using adastra::crypto::hash::SHA256Hasher;
+
+        constexpr std::uint8_t kLeafTag = 0x00;
+        constexpr std::uint8_t kNodeTag = 0x01;
+
+        std::size_t chunkCount(std::uint64_t size, std::size_t chunkSize)
+        {
+            // Un fichier vide a une feuille (vide) pour que la racine soit définie.
+            return size == 0 ? 1 : static_cast<std::size_t>((size + chunkSize - 1) / chunkSize);
+        }
+
+        // Un indice en double ferait écrire deux tâches dans la même case de hashChunks().
+        void sortUnique(std::vector<std::size_t> &indices)
+        {
+            std::sort(indices.begin(), indices.end());
+            indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+        }
+
+        // Hache les chunks `indices` (sans doublon) du fichier dans out[indices[k]], en parallèle
+        // sur le TaskScheduler partagé (au plus `threads` participants).
+        void hashChunks(const MappedFile &file, std::size_t chunkSize, unsigned threads,
+                        std::span<const std::size_t> indices, std::vector<Digest> &out)
+        {
+            auto work = [&](std::size_t begin, std::size_t end)
+            {
+                std::vector<std::uint8_t> buffer; // chemin pread seulement
+                SHA256Hasher h;
+                for (std::size_t k = begin; k < end; ++k)
+                {
+                    const std::size_t i = indices[k];
+                    const std::uint64_t offset = static_cast<std::uint64_t>(i) * chunkSize;
+                    const std::size_t length = static_cast<std::size_t>(
+                        std::min<std::uint64_t>(chunkSize, file.size() - std::min(offset, file.size())));
+
+                    file.prefetch(offset, length);
+                    h.update(&kLeafTag, 1);
+                    if (file.mapped())
+                    {
+                        h.update(file.data() + offset, length);
+                    }
+                    else
+                    {
+                        buffer.resize(length);
+                        file.read(offset, buffer.data(), length);
+                        h.update(buffer.data(), length);
+                    }
+                    out[i] = h.finalize();
+                }
+            };
+
+            // Quelques chunks par tâche : le hasher et le tampon sont réutilisés.
+            const std::size_t grain = std::max<std::size_t>(1, indices.size() / (4 * std::max(1u, threads)));
+            adastra::core::concurrency::TaskScheduler::shared().parallelFor(0, indices.size(), work, {grain, threads});
+        }
+    }
+
+    std::string FileDigest::rootHex() const
+    {
+        return adastra::crypto::hash::toHex(root);
+    }
+
+    FileHasher::FileHasher(FileHashOptions options)
+        : options_(options)
+    {
+        if (options_.chunkSize == 0)
+            throw std::invalid_argument("FileHasher: chunkSize doit être > 0");
+        if (options_.threads == 0)
+            options_.threads = adastra::core::concurrency::TaskScheduler::shared().cores();
+    }
+
+    FileDigest FileHasher::hash(const std::string &path) const
+    {
+        MappedFile file(path, options_.useMmap);
+
+        FileDigest d;
+        d.fileSize = file.size();
+        d.chunkSize = options_.chunkSize;
+        d.chunks.resize(chunkCount(d.fileSize, d.chunkSize));
+
+        std::vector<std::size_t> all(d.chunks.size());
+        std::iota(all.begin(), all.end(), std::size_t{0});
+        hashChunks(file, d.chunkSize, options_.threads, all, d.chunks);
+
+        d.root = merkleRoot(d.chunks);
+        return d;
+    }
+
+    std::vector<std::size_t> FileHasher::verify(const std::string &path, const FileDigest &expected,
+                                                std::span<const std::size_t> chunks) const
+    {
+        if (expected.chunkSize == 0)
+            throw std::invalid_argument("FileHasher::verify: empreinte sans chunkSize");
+
+        MappedFile file(path, options_.useMmap);
+        const std::size_t count = chunkCount(file.size(), expected.chunkSize);
+
+        // Chunks demandés qui existent des deux côtés ; les autres sont différents d'office.
+        std::vector<std::size_t> wanted;
+        std::vector<std::size_t> mismatched;
+        if (chunks.empty())
+        {
+            wanted.resize(std::min(count, expected.chunks.size()));
+            std::iota(wanted.begin(), wanted.end(), std::size_t{0});
+            for (std::size_t i = wanted.size(); i < std::max(count, expected.chunks.size()); ++i)
+                mismatched.push_back(i);
+        }
+        else
+        {
+            for (std::size_t i : chunks)
+                (i < count && i < expected.chunks.size() ? wanted : mismatched).push_back(i);
+            sortUnique(wanted);
+        }
+
+        std::vector<Digest> actual(count);
+        hashChunks(file, expected.chunkSize, options_.threads, wanted, actual);
+
+        for (std::size_t i : wanted)
+            if (actual[i] != expected.chunks[i])
+                mismatched.push_back(i);
+
+        std::sort(mismatched.begin(), mismatched.end());
+        mismatched.erase(std::unique(mismatched.begin(), mismatched.end()), mismatched.end());
+        return mismatched;
+    }
+
+    void FileHasher::refresh(const std::string &path, FileDigest &digest, std::span<const std::size_t> chunks) const
+    {
+        MappedFile file(path, options_.useMmap);
+        if (file.size() != digest.fileSize || digest.chunkSize == 0)
+        {
+            FileHasher full(FileHashOptions{digest.chunkSize ? digest.chunkSize : options_.chunkSize,
+                                            options_.threads, options_.useMmap});
+            digest = full.hash(path);
+            return;
+        }
+
+        std::vector<std::size_t> wanted;
+        for (std::size_t i : chunks)
+            if (i < digest.chunks.size())
+                wanted.push_back(i);
+        sortUnique(wanted);
+
+        hashChunks(file, digest.chunkSize, options_.threads, wanted, digest.chunks);
+        digest.root = merkleRoot(digest.chunks);
+    }
+
+    Digest FileHasher::merkleRoot(std::span<const Digest> leaves)
+    {
+        if (leaves.empty())
+            return SHA256Hasher::hash(&kLeafTag, 1);
+
+        std::vector<Digest> level(leaves.begin(), leaves.end());
+        SHA256Hasher h;
+        while (level.size() > 1)
+        {
+            std::size_t out = 0;
+            for (std::size_t i = 0; i + 1 < level.size(); i += 2)
+            {
+                h.update(&kNodeTag, 1);
+                h.update(level[i].data(), level[i].size());
+                h.update(level[i + 1].data(), level[i + 1].size());
+                level[out++] = h.finalize();
+            }
+            if (level.size() % 2 == 1)
+                level[out++] = level.back();
+            level.resize(out);
+        }
+        return level.front();
+    }
+}
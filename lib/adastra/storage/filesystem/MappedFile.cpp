@@ -0,0 +1,86 @@
+#include <adastra/storage/filesystem/MappedFile.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace adastra::storage::filesystem
+{
+    MappedFile::MappedFile(const std::string &path, bool map)
+        : path_(path)
+    {
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0)
+            throw std::runtime_error("MappedFile: impossible d'ouvrir " + path + ": " + std::strerror(errno));
+
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0)
+        {
+            const int err = errno;
+            ::close(fd_);
+            throw std::runtime_error("MappedFile: fstat " + path + ": " + std::strerror(err));
+        }
+        size_ = static_cast<std::uint64_t>(st.st_size);
+
+        if (map && S_ISREG(st.st_mode) && size_ > 0)
+        {
+            void *p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (p != MAP_FAILED)
+                data_ = static_cast<std::uint8_t *>(p);
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (data_)
+            ::munmap(data_, size_);
+        if (fd_ >= 0)
+            ::close(fd_);
+    }
+
+    void MappedFile::read(std::uint64_t offset, void *out, std::size_t length) const
+    {
+        if (data_)
+        {
+            if (offset + length > size_)
+                throw std::runtime_error("MappedFile: lecture hors du fichier " + path_);
+            std::memcpy(out, data_ + offset, length);
+            return;
+        }
+
+        auto *dst = static_cast<std::uint8_t *>(out);
+        while (length > 0)
+        {
+            const ssize_t n = ::pread(fd_, dst, length, static_cast<off_t>(offset));
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                throw std::runtime_error("MappedFile: lecture courte dans " + path_);
+            dst += n;
+            offset += static_cast<std::uint64_t>(n);
+            length -= static_cast<std::size_t>(n);
+        }
+    }
+
+    void MappedFile::prefetch(std::uint64_t offset, std::size_t length) const
+    {
+        if (data_)
+        {
+            // madvise veut une adresse alignée sur la page.
+            const std::uint64_t page = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+            const std::uint64_t begin = offset / page * page;
+            ::madvise(data_ + begin, length + (offset - begin), MADV_WILLNEED);
+        }
+#if defined(POSIX_FADV_WILLNEED)
+        else
+        {
+            ::posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+        }
+#endif
+    }
+}
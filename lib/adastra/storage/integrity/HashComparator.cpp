@@ -0,0 +1,26 @@
+#include <adastra/storage/integrity/HashComparator.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+
+#include <unordered_set>
+
+namespace adastra::storage::integrity
+{
+    bool HashComparator::equal(const Digest &a, const Digest &b)
+    {
+        return adastra::crypto::hash::constantTimeEquals(a, b);
+    }
+
+    std::vector<std::size_t> HashComparator::changedChunks(const ChunkRecipe &before, const ChunkRecipe &after)
+    {
+        std::unordered_set<Digest, adastra::storage::filesystem::DigestHash> known;
+        known.reserve(before.chunks.size());
+        for (const auto &c : before.chunks)
+            known.insert(c.hash);
+
+        std::vector<std::size_t> out;
+        for (std::size_t i = 0; i < after.chunks.size(); ++i)
+            if (!known.count(after.chunks[i].hash))
+                out.push_back(i);
+        return out;
+    }
+}
@@ -0,0 +1,59 @@
+#include <adastra/storage/integrity/RedundancyChecker.hpp>
+
+#include <string_view>
+#include <vector>
+
+namespace adastra::storage::integrity
+{
+    using adastra::crypto::hash::SHA256Hasher;
+    using namespace adastra::storage::filesystem;
+
+    nlohmann::json RedundancyReport::toJson() const
+    {
+        return {{"logical_bytes", logicalBytes},
+                {"unique_bytes", uniqueBytes},
+                {"chunks", chunks},
+                {"unique_chunks", uniqueChunks},
+                {"ratio", ratio()},
+                {"saved", savedFraction()}};
+    }
+
+    RedundancyChecker::RedundancyChecker(ChunkingOptions options)
+        : chunker_(options) {}
+
+    void RedundancyChecker::add(const ChunkRecipe &recipe)
+    {
+        for (const auto &c : recipe.chunks)
+        {
+            report_.logicalBytes += c.length;
+            ++report_.chunks;
+            if (seen_[c.hash]++ == 0)
+            {
+                report_.uniqueBytes += c.length;
+                ++report_.uniqueChunks;
+            }
+        }
+    }
+
+    void RedundancyChecker::add(std::span<const std::uint8_t> data)
+    {
+        const auto lengths = chunker_.split(data);
+
+        std::vector<std::string_view> views;
+        views.reserve(lengths.size());
+        std::size_t offset = 0;
+        for (std::size_t len : lengths)
+        {
+            views.emplace_back(reinterpret_cast<const char *>(data.data()) + offset, len);
+            offset += len;
+        }
+        std::vector<Digest> hashes(views.size());
+        SHA256Hasher::hashMany(views, hashes);
+
+        ChunkRecipe recipe;
+        recipe.size = data.size();
+        for (std::size_t i = 0; i < views.size(); ++i)
+            recipe.chunks.push_back({hashes[i], static_cast<std::uint32_t>(lengths[i])});
+        add(recipe);
+    }
+}
@@ -0,0 +1,122 @@
+#include <adastra/tools/id/SnowflakeGenerator.hpp>
+#include <adastra/tools/time/TImestampUtils.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace adastra::tools::id
+{
+    namespace
+    {
+        // ms écoulées depuis kEpochMs (0 si l'horloge est avant l'époque).
+        std::uint64_t sinceEpoch(std::uint64_t ms)
+        {
+            return ms > SnowflakeGenerator::kEpochMs ? ms - SnowflakeGenerator::kEpochMs : 0;
+        }
+
+        std::uint64_t nowMs()
+        {
+            using namespace std::chrono;
+            return sinceEpoch(static_cast<std::uint64_t>(
+                duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count()));
+        }
+
+        // Horloge grossière (résolution du tick noyau) : quelques ns au lieu d'un
+        // appel complet, suffisant pour savoir si un bloc local a vieilli.
+        std::uint64_t coarseNowMs()
+        {
+            return sinceEpoch(static_cast<std::uint64_t>(tools::time::coarseNowMs()));
+        }
+
+        std::atomic<std::uint64_t> g_instances{0};
+
+        struct LocalBlock
+        {
+            std::uint64_t instance = 0; // 0 = vide
+            std::uint64_t next = 0;
+            std::uint64_t end = 0;
+        };
+
+        thread_local LocalBlock t_block;
+
+        // SA_NODE_ID : absent ou vide = 0. Une valeur invalide ou hors plage
+        // ferait partager un nœud à deux processus : on refuse de démarrer.
+        std::uint16_t nodeIdFromEnv()
+        {
+            const char *env = std::getenv("SA_NODE_ID");
+            if (!env || !*env)
+                return 0;
+
+            const std::string_view s(env);
+            unsigned value = 0;
+            const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+            if (ec != std::errc() || ptr != s.data() + s.size() || value > SnowflakeGenerator::kMaxNodeId)
+                throw std::invalid_argument("SnowflakeGenerator: SA_NODE_ID invalide « " + std::string(s) +
+                                            " » (attendu 0.." + std::to_string(SnowflakeGenerator::kMaxNodeId) + ")");
+            return static_cast<std::uint16_t>(value);
+        }
+    }
+
+    SnowflakeGenerator::SnowflakeGenerator(std::uint16_t nodeId)
+        : nodeId_(nodeId), instance_(g_instances.fetch_add(1, std::memory_order_relaxed) + 1)
+    {
+        if (nodeId > kMaxNodeId)
+            throw std::invalid_argument("SnowflakeGenerator: node id > " + std::to_string(kMaxNodeId));
+    }
+
+    std::uint64_t SnowflakeGenerator::reserve(std::uint64_t now, std::uint32_t count)
+    {
+        // Nouvelle ms : séquence 0 à l'heure courante. Sinon (même ms, horloge en
+        // retard, séquence épuisée) : valeur précédente + 1, la retenue passe
+        // naturellement dans les bits de ms. Jamais d'attente.
+        const std::uint64_t floor = now << kSequenceBits;
+        std::uint64_t last = state_.load(std::memory_order_relaxed);
+        std::uint64_t first;
+        do
+        {
+            first = std::max(last + 1, floor);
+        } while (!state_.compare_exchange_weak(last, first + count - 1,
+                                               std::memory_order_relaxed,
+                                               std::memory_order_relaxed));
+        return first;
+    }
+
+    std::uint64_t SnowflakeGenerator::compose(std::uint64_t logical) const
+    {
+        return ((logical >> kSequenceBits) << (kNodeBits + kSequenceBits)) |
+               (static_cast<std::uint64_t>(nodeId_) << kSequenceBits) |
+               (logical & kMaxSequence);
+    }
+
+    std::uint64_t SnowflakeGenerator::next()
+    {
+        return compose(reserve(nowMs(), 1));
+    }
+
+    std::uint64_t SnowflakeGenerator::nextLocal()
+    {
+        LocalBlock &b = t_block;
+
+        // Bloc d'un autre générateur, épuisé ou trop vieux : on en réserve un neuf.
+        // Le reste d'un bloc abandonné est perdu, ce qui ne fait que des trous.
+        const std::uint64_t now = coarseNowMs();
+        if (b.instance != instance_ || b.next == b.end || (b.next >> kSequenceBits) + 1 < now)
+        {
+            b.next = reserve(now, kBlockSize);
+            b.end = b.next + kBlockSize;
+            b.instance = instance_;
+        }
+        return compose(b.next++);
+    }
+
+    SnowflakeGenerator &SnowflakeGenerator::shared()
+    {
+        static SnowflakeGenerator instance(nodeIdFromEnv());
+        return instance;
+    }
+}
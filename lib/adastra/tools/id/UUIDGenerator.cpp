@@ -0,0 +1,161 @@
+#include <adastra/tools/id/UUIDGenerator.hpp>
+#include <adastra/crypto/random/RandomByters.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+namespace adastra::tools::id
+{
+    namespace
+    {
+        using adastra::crypto::random::RandomBytes;
+
+        // Chaque octet -> ses deux chiffres hexadécimaux.
+        constexpr auto kHexPairs = []
+        {
+            constexpr char digits[] = "0123456789abcdef";
+            std::array<char, 512> t{};
+            for (int i = 0; i < 256; ++i)
+            {
+                t[i * 2] = digits[i >> 4];
+                t[i * 2 + 1] = digits[i & 0xF];
+            }
+            return t;
+        }();
+
+        int hexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            return -1;
+        }
+
+        void setVersion(Uuid &u, std::uint8_t version)
+        {
+            u[6] = static_cast<std::uint8_t>((u[6] & 0x0F) | (version << 4));
+            u[8] = static_cast<std::uint8_t>((u[8] & 0x3F) | 0x80); // variant RFC
+        }
+
+        // ms depuis l'epoch + fraction de ms sur 12 bits.
+        void stamp(Uuid &u, std::uint64_t ms, std::uint32_t fraction)
+        {
+            for (int i = 0; i < 6; ++i)
+                u[i] = static_cast<std::uint8_t>(ms >> (40 - 8 * i));
+            u[6] = static_cast<std::uint8_t>(fraction >> 8);
+            u[7] = static_cast<std::uint8_t>(fraction);
+            setVersion(u, 7);
+        }
+
+        void now(std::uint64_t &ms, std::uint32_t &fraction)
+        {
+            using namespace std::chrono;
+            const auto ns = static_cast<std::uint64_t>(
+                duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count());
+            ms = ns / 1000000;
+            fraction = static_cast<std::uint32_t>(((ns % 1000000) << 12) / 1000000);
+        }
+
+        constexpr bool isDash(std::size_t i) { return i == 8 || i == 13 || i == 18 || i == 23; }
+    }
+
+    Uuid UUIDGenerator::v4()
+    {
+        Uuid u;
+        RandomBytes::fill(u.data(), u.size());
+        setVersion(u, 4);
+        return u;
+    }
+
+    Uuid UUIDGenerator::v7()
+    {
+        Uuid u;
+        RandomBytes::fill(u.data() + 8, 8);
+
+        std::uint64_t ms;
+        std::uint32_t fraction;
+        now(ms, fraction);
+        stamp(u, ms, fraction);
+        return u;
+    }
+
+    void UUIDGenerator::v7(std::span<Uuid> out)
+    {
+        if (out.empty())
+            return;
+
+        RandomBytes::fill(out.data(), out.size_bytes());
+
+        std::uint64_t ms;
+        std::uint32_t fraction;
+        now(ms, fraction);
+        for (auto &u : out)
+            stamp(u, ms, fraction);
+
+        // Même horodatage pour tout le lot : l'ordre se joue sur les bits aléatoires.
+        std::sort(out.begin(), out.end());
+    }
+
+    void UUIDGenerator::format(const Uuid &uuid, char *out)
+    {
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < uuid.size(); ++i)
+        {
+            if (i == 4 || i == 6 || i == 8 || i == 10)
+                out[pos++] = '-';
+            out[pos++] = kHexPairs[uuid[i] * 2];
+            out[pos++] = kHexPairs[uuid[i] * 2 + 1];
+        }
+    }
+
+    std::array<char, UUIDGenerator::kTextSize> UUIDGenerator::toChars(const Uuid &uuid)
+    {
+        std::array<char, kTextSize> out;
+        format(uuid, out.data());
+        return out;
+    }
+
+    std::string UUIDGenerator::toString(const Uuid &uuid)
+    {
+        std::string out(kTextSize, '\0');
+        format(uuid, out.data());
+        return out;
+    }
+
+    bool UUIDGenerator::parse(std::string_view text, Uuid &out)
+    {
+        if (text.size() != kTextSize)
+            return false;
+
+        std::size_t byte = 0;
+        for (std::size_t i = 0; i < kTextSize;)
+        {
+            if (isDash(i))
+            {
+                if (text[i] != '-')
+                    return false;
+                ++i;
+                continue;
+            }
+
+            const int hi = hexValue(text[i]);
+            const int lo = hexValue(text[i + 1]);
+            if (hi < 0 || lo < 0)
+                return false;
+            out[byte++] = static_cast<std::uint8_t>((hi << 4) | lo);
+            i += 2;
+        }
+        return true;
+    }
+
+    std::uint64_t UUIDGenerator::timestampMs(const Uuid &uuid)
+    {
+        std::uint64_t ms = 0;
+        for (int i = 0; i < 6; ++i)
+            ms = (ms << 8) | uuid[i];
+        return ms;
+    }
+}
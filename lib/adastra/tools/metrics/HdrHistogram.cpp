@@ -0,0 +1,123 @@
+#include <adastra/tools/metrics/HdrHistogram.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace adastra::tools::metrics
+{
+    namespace
+    {
+        inline unsigned bitLength(std::uint64_t v)
+        {
+            return static_cast<unsigned>(std::bit_width(v));
+        }
+    }
+
+    HdrHistogram::HdrHistogram(std::uint64_t highestTrackable, int significantDigits)
+        : highest_(std::max<std::uint64_t>(highestTrackable, 2))
+    {
+        if (significantDigits < 1 || significantDigits > 5)
+            throw std::invalid_argument("HdrHistogram: significantDigits doit être entre 1 et 5");
+        if (highest_ > (1ULL << 62))
+            throw std::invalid_argument("HdrHistogram: highestTrackable doit être <= 2^62");
+
+        // 2 * 10^digits valeurs distinctes par seau => précision relative 10^-digits.
+        const auto largestSingleUnit = static_cast<std::uint64_t>(2 * std::pow(10.0, significantDigits));
+        const unsigned subBucketCountMagnitude = bitLength(largestSingleUnit - 1);
+        subBucketHalfCountMagnitude_ = subBucketCountMagnitude - 1;
+        subBucketHalfCount_ = 1ULL << subBucketHalfCountMagnitude_;
+        subBucketMask_ = (1ULL << subBucketCountMagnitude) - 1;
+
+        // `trackable` est exclu : highest_ doit lui rester strictement inférieur.
+        std::uint64_t trackable = 1ULL << subBucketCountMagnitude;
+        std::size_t buckets = 1;
+        while (trackable <= highest_)
+        {
+            trackable <<= 1;
+            ++buckets;
+        }
+        counts_.assign((buckets + 1) * subBucketHalfCount_, 0);
+
+        if (indexOf(highest_) >= counts_.size())
+            throw std::logic_error("HdrHistogram: highestTrackable hors des seaux");
+    }
+
+    std::size_t HdrHistogram::indexOf(std::uint64_t value) const
+    {
+        // Seau = position du bit de poids fort au-delà du premier seau ; sous-seau = bits suivants.
+        const int bucket = static_cast<int>(bitLength(value | subBucketMask_)) - static_cast<int>(subBucketHalfCountMagnitude_ + 1);
+        const std::uint64_t subBucket = value >> bucket;
+        return (static_cast<std::size_t>(bucket + 1) << subBucketHalfCountMagnitude_) + (subBucket - subBucketHalfCount_);
+    }
+
+    std::uint64_t HdrHistogram::highestEquivalent(std::size_t index) const
+    {
+        int bucket = static_cast<int>(index >> subBucketHalfCountMagnitude_) - 1;
+        std::uint64_t subBucket = (index & (subBucketHalfCount_ - 1)) + subBucketHalfCount_;
+        if (bucket < 0)
+        {
+            subBucket -= subBucketHalfCount_;
+            bucket = 0;
+        }
+        const std::uint64_t lowest = subBucket << bucket;
+        return lowest + (1ULL << bucket) - 1;
+    }
+
+    void HdrHistogram::record(std::uint64_t value, std::uint64_t count)
+    {
+        value = std::min(value, highest_);
+        counts_[indexOf(value)] += count;
+        total_ += count;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+        sum_ += static_cast<long double>(value) * count;
+    }
+
+    void HdrHistogram::merge(const HdrHistogram &other)
+    {
+        if (other.counts_.size() != counts_.size() || other.subBucketHalfCount_ != subBucketHalfCount_)
+            throw std::invalid_argument("HdrHistogram: configurations différentes");
+
+        for (std::size_t i = 0; i < counts_.size(); ++i)
+            counts_[i] += other.counts_[i];
+        total_ += other.total_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        sum_ += other.sum_;
+    }
+
+    void HdrHistogram::reset()
+    {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        total_ = 0;
+        min_ = UINT64_MAX;
+        max_ = 0;
+        sum_ = 0;
+    }
+
+    double HdrHistogram::mean() const
+    {
+        return total_ ? static_cast<double>(sum_ / total_) : 0.0;
+    }
+
+    std::uint64_t HdrHistogram::valueAtPercentile(double percentile) const
+    {
+        if (total_ == 0)
+            return 0;
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        const auto target = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total_))));
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i)
+        {
+            seen += counts_[i];
+            if (seen >= target)
+                return std::min(highestEquivalent(i), max_);
+        }
+        return max_;
+    }
+}
@@ -0,0 +1,45 @@
+#include <adastra/tools/time/DurationFormatter.hpp>
+
+#include <cstdio>
+
+namespace adastra::tools::time
+{
+    namespace
+    {
+        std::string scaled(double value, const char *unit)
+        {
+            char buf[32];
+            const char *fmt = value < 10 ? "%.2f %s" : value < 100 ? "%.1f %s"
+                                                                   : "%.0f %s";
+            std::snprintf(buf, sizeof(buf), fmt, value, unit);
+            return buf;
+        }
+    }
+
+    std::string formatDuration(std::chrono::nanoseconds d)
+    {
+        const bool negative = d.count() < 0;
+        const long long ns = negative ? -static_cast<long long>(d.count()) : static_cast<long long>(d.count());
+
+        std::string out;
+        if (ns < 1000)
+            out = std::to_string(ns) + " ns";
+        else if (ns < 1000000)
+            out = scaled(ns / 1e3, "us");
+        else if (ns < 1000000000)
+            out = scaled(ns / 1e6, "ms");
+        else if (ns < 60LL * 1000000000)
+            out = scaled(ns / 1e9, "s");
+        else
+        {
+            const long long s = ns / 1000000000;
+            char buf[32];
+            if (s < 3600)
+                std::snprintf(buf, sizeof(buf), "%lldm%02llds", s / 60, s % 60);
+            else
+                std::snprintf(buf, sizeof(buf), "%lldh%02lldm", s / 3600, s / 60 % 60);
+            out = buf;
+        }
+        return negative ? "-" + out : out;
+    }
+}
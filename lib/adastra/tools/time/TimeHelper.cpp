@@ -0,0 +1,37 @@
+#include <adastra/tools/time/TimeHelper.hpp>
+
+namespace adastra::tools::time
+{
+    namespace
+    {
+        template <std::size_t N, void (*Format)(std::int64_t, char *)>
+        struct SecondCache
+        {
+            std::int64_t second = -1;
+            char text[N];
+
+            std::string_view get()
+            {
+                const std::int64_t now = coarseNowSeconds();
+                if (now != second)
+                {
+                    Format(now, text);
+                    second = now;
+                }
+                return {text, N};
+            }
+        };
+    }
+
+    std::string_view httpDateNow()
+    {
+        thread_local SecondCache<kHttpDateSize, formatHttpDate> cache;
+        return cache.get();
+    }
+
+    std::string_view iso8601Now()
+    {
+        thread_local SecondCache<kIso8601Size, formatIso8601> cache;
+        return cache.get();
+    }
+}
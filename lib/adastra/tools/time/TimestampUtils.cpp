@@ -0,0 +1,177 @@
+#include <adastra/tools/time/TImestampUtils.hpp>
+
+#include <chrono>
+#include <ctime>
+
+namespace adastra::tools::time
+{
+    namespace
+    {
+        struct Civil
+        {
+            std::int64_t year;
+            unsigned month, day, hour, minute, second, weekday; // weekday : 0 = dimanche
+        };
+
+        Civil civilFromEpoch(std::int64_t t)
+        {
+            std::int64_t days = t / 86400;
+            std::int64_t secs = t % 86400;
+            if (secs < 0)
+            {
+                secs += 86400;
+                --days;
+            }
+
+            Civil c;
+            c.hour = static_cast<unsigned>(secs / 3600);
+            c.minute = static_cast<unsigned>(secs / 60 % 60);
+            c.second = static_cast<unsigned>(secs % 60);
+            c.weekday = static_cast<unsigned>((days % 7 + 11) % 7); // 1970-01-01 était un jeudi
+
+            // Inverse de daysFromCivil (H. Hinnant).
+            const std::int64_t z = days + 719468;
+            const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+            const unsigned doe = static_cast<unsigned>(z - era * 146097);
+            const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+            const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+            const unsigned mp = (5 * doy + 2) / 153;
+            c.day = doy - (153 * mp + 2) / 5 + 1;
+            c.month = mp < 10 ? mp + 3 : mp - 9;
+            c.year = static_cast<std::int64_t>(yoe) + era * 400 + (c.month <= 2);
+            return c;
+        }
+
+        inline void put2(char *out, unsigned v)
+        {
+            out[0] = static_cast<char>('0' + v / 10);
+            out[1] = static_cast<char>('0' + v % 10);
+        }
+
+        inline void put4(char *out, std::int64_t y)
+        {
+            const unsigned v = static_cast<unsigned>(y < 0 ? 0 : y > 9999 ? 9999 : y);
+            put2(out, v / 100);
+            put2(out + 2, v % 100);
+        }
+
+        constexpr unsigned daysInMonth(std::int64_t y, unsigned m)
+        {
+            constexpr unsigned kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            const bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+            return kDays[m - 1] + (m == 2 && leap);
+        }
+    }
+
+    std::int64_t coarseNowMs()
+    {
+#if defined(__linux__) && defined(CLOCK_REALTIME_COARSE)
+        timespec ts{};
+        if (clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0)
+            return static_cast<std::int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+#endif
+        using namespace std::chrono;
+        return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+    }
+
+    std::optional<std::int64_t> parseDateTime(std::string_view s)
+    {
+        if (s.size() == kDateTimeSize + 1 && s.back() == 'Z')
+            s.remove_suffix(1);
+        if (s.size() != kDateTimeSize)
+            return std::nullopt;
+
+        // Positions des chiffres de "YYYY-MM-DD HH:MM:SS" : on les teste tous
+        // d'un bloc (un OU) plutôt que caractère par caractère.
+        constexpr int kDigits[14] = {0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18};
+        unsigned d[14];
+        unsigned bad = 0;
+        for (int i = 0; i < 14; ++i)
+        {
+            d[i] = static_cast<unsigned char>(s[kDigits[i]]) - unsigned('0');
+            bad |= d[i] > 9;
+        }
+        bad |= (s[4] != '-') | (s[7] != '-') | (s[10] != ' ' && s[10] != 'T') | (s[13] != ':') | (s[16] != ':');
+        if (bad)
+            return std::nullopt;
+
+        const std::int64_t year = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+        const unsigned month = d[4] * 10 + d[5];
+        const unsigned day = d[6] * 10 + d[7];
+        const unsigned hour = d[8] * 10 + d[9];
+        const unsigned minute = d[10] * 10 + d[11];
+        const unsigned second = d[12] * 10 + d[13];
+
+        if (month - 1 >= 12 || day - 1 >= daysInMonth(year, month) || hour >= 24 || minute >= 60 ||
+            second >= 60)
+            return std::nullopt;
+
+        return daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    }
+
+    void formatDateTime(std::int64_t epochSeconds, char *out, char separator)
+    {
+        const Civil c = civilFromEpoch(epochSeconds);
+        put4(out, c.year);
+        out[4] = '-';
+        put2(out + 5, c.month);
+        out[7] = '-';
+        put2(out + 8, c.day);
+        out[10] = separator;
+        put2(out + 11, c.hour);
+        out[13] = ':';
+        put2(out + 14, c.minute);
+        out[16] = ':';
+        put2(out + 17, c.second);
+    }
+
+    void formatIso8601(std::int64_t epochSeconds, char *out)
+    {
+        formatDateTime(epochSeconds, out, 'T');
+        out[19] = 'Z';
+    }
+
+    void formatHttpDate(std::int64_t epochSeconds, char *out)
+    {
+        static constexpr char kDays[] = "SunMonTueWedThuFriSat";
+        static constexpr char kMonths[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+        const Civil c = civilFromEpoch(epochSeconds);
+        out[0] = kDays[c.weekday * 3];
+        out[1] = kDays[c.weekday * 3 + 1];
+        out[2] = kDays[c.weekday * 3 + 2];
+        out[3] = ',';
+        out[4] = ' ';
+        put2(out + 5, c.day);
+        out[7] = ' ';
+        out[8] = kMonths[(c.month - 1) * 3];
+        out[9] = kMonths[(c.month - 1) * 3 + 1];
+        out[10] = kMonths[(c.month - 1) * 3 + 2];
+        out[11] = ' ';
+        put4(out + 12, c.year);
+        out[16] = ' ';
+        put2(out + 17, c.hour);
+        out[19] = ':';
+        put2(out + 20, c.minute);
+        out[22] = ':';
+        put2(out + 23, c.second);
+        out[25] = ' ';
+        out[26] = 'G';
+        out[27] = 'M';
+        out[28] = 'T';
+    }
+
+    std::string toDateTime(std::int64_t epochSeconds)
+    {
+        std::string out(kDateTimeSize, '\0');
+        formatDateTime(epochSeconds, out.data());
+        return out;
+    }
+
+    std::string toIso8601(std::int64_t epochSeconds)
+    {
+        std::string out(kIso8601Size, '\0');
+        formatIso8601(epochSeconds, out.data());
+        return out;
+    }
+}
@@ -0,0 +1,413 @@
+#include <adastra/tools/time/TimingWheel.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace adastra::tools::time
+{
+    namespace
+    {
+        constexpr std::uint64_t kNoWake = std::numeric_limits<std::uint64_t>::max();
+
+        std::uint64_t nanos(std::chrono::steady_clock::duration d)
+        {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+            return ns > 0 ? static_cast<std::uint64_t>(ns) : 0;
+        }
+    }
+
+    TimingWheel::TimingWheel(TimingWheelOptions options)
+        : options_(options),
+          tickNs_(std::max<std::uint64_t>(1, nanos(options.tick))),
+          start_(Clock::now())
+    {
+        options_.batchSize = std::max<std::size_t>(1, options_.batchSize);
+
+        nodes_.resize(kLevels * kSlots);
+        for (std::uint32_t i = 0; i < nodes_.size(); ++i)
+            nodes_[i] = Node{0, 0, i, i, 0, 0, 0};
+
+        workers_.reserve(options_.workers);
+        for (unsigned i = 0; i < options_.workers; ++i)
+            workers_.emplace_back([this]
+                                  { workerLoop(); });
+        ticker_ = std::thread([this]
+                              { tickerLoop(); });
+    }
+
+    TimingWheel::~TimingWheel()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        tickerCv_.notify_all();
+        ticker_.join();
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            draining_ = true;
+        }
+        queueCv_.notify_all();
+        for (auto &t : workers_)
+            t.join();
+    }
+
+    TimerKind TimingWheel::addHandler(Handler handler)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (handlers_.size() > std::numeric_limits<TimerKind>::max())
+            throw std::length_error("TimingWheel: trop de handlers");
+
+        handlers_.push_back(std::make_shared<const Handler>(std::move(handler)));
+        expiredByKind_.emplace_back();
+        return static_cast<TimerKind>(handlers_.size() - 1);
+    }
+
+    // Premier tick dont le traitement a lieu après now + delay : jamais en avance.
+    std::uint64_t TimingWheel::ticksUntil(Clock::duration delay) const
+    {
+        const std::uint64_t at = nanos(Clock::now() - start_) + nanos(delay);
+        return at / tickNs_ + (at % tickNs_ != 0 ? 1 : 0);
+    }
+
+    std::uint32_t TimingWheel::allocate()
+    {
+        if (freeHead_ != kNil)
+        {
+            const std::uint32_t index = freeHead_;
+            freeHead_ = nodes_[index].next;
+            return index;
+        }
+
+        if (nodes_.size() >= kNil)
+            throw std::length_error("TimingWheel: capacité d'indices épuisée");
+        nodes_.push_back(Node{0, 0, kNil, kNil, 1, 0, 0});
+        return static_cast<std::uint32_t>(nodes_.size() - 1);
+    }
+
+    void TimingWheel::release(std::uint32_t index)
+    {
+        Node &n = nodes_[index];
+        n.live = 0;
+        ++n.generation; // invalide les TimerId encore en circulation
+        n.next = freeHead_;
+        freeHead_ = index;
+    }
+
+    void TimingWheel::link(std::uint32_t index)
+    {
+        Node &n = nodes_[index];
+        if (n.deadline < base_)
+            n.deadline = base_; // déjà dû : servi au prochain tick traité
+        if (n.deadline - base_ > kMaxDelta)
+            n.deadline = base_ + kMaxDelta;
+
+        // Niveau = plus petit l tel que delta < 256^(l+1), case = octet l de l'échéance.
+        const std::uint64_t delta = n.deadline - base_;
+        unsigned level = 0;
+        while (level + 1 < kLevels && delta >= (std::uint64_t{1} << (kSlotBits * (level + 1))))
+            ++level;
+
+        const auto slot = static_cast<std::uint32_t>((n.deadline >> (kSlotBits * level)) & kSlotMask);
+        const std::uint32_t head = level * kSlots + slot;
+
+        n.next = head;
+        n.prev = nodes_[head].prev;
+        nodes_[n.prev].next = index;
+        nodes_[head].prev = index;
+    }
+
+    void TimingWheel::unlink(std::uint32_t index)
+    {
+        Node &n = nodes_[index];
+        nodes_[n.prev].next = n.next;
+        nodes_[n.next].prev = n.prev;
+    }
+
+    std::uint32_t TimingWheel::lookup(TimerId id) const
+    {
+        const auto index = static_cast<std::uint32_t>(id & 0xFFFFFFFFu);
+        const auto generation = static_cast<std::uint32_t>(id >> 32);
+        if (index < kLevels * kSlots || index >= nodes_.size())
+            return kNil;
+
+        const Node &n = nodes_[index];
+        return (n.live && n.generation == generation) ? index : kNil;
+    }
+
+    TimerId TimingWheel::schedule(TimerKind kind, std::uint64_t payload, Clock::duration delay)
+    {
+        const std::uint64_t deadline = ticksUntil(delay);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (kind >= handlers_.size())
+            throw std::invalid_argument("TimingWheel: TimerKind inconnu");
+        if (stopping_ || pending_ >= options_.maxTimers)
+        {
+            ++rejected_;
+            return 0;
+        }
+
+        // Roue vide : la base peut rattraper l'horloge sans cascade.
+        if (pending_ == 0)
+            base_ = std::max(base_, nanos(Clock::now() - start_) / tickNs_);
+
+        const std::uint32_t index = allocate();
+        Node &n = nodes_[index];
+        n.payload = payload;
+        n.deadline = deadline;
+        n.kind = kind;
+        n.live = 1;
+        link(index);
+
+        ++pending_;
+        ++scheduled_;
+        if (n.deadline < wakeTick_)
+            tickerCv_.notify_one();
+
+        return (static_cast<TimerId>(n.generation) << 32) | index;
+    }
+
+    bool TimingWheel::cancel(TimerId id)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::uint32_t index = lookup(id);
+        if (index == kNil)
+            return false;
+
+        unlink(index);
+        release(index);
+        --pending_;
+        ++cancelled_;
+        return true;
+    }
+
+    bool TimingWheel::reschedule(TimerId id, Clock::duration delay)
+    {
+        const std::uint64_t deadline = ticksUntil(delay);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::uint32_t index = lookup(id);
+        if (index == kNil)
+            return false;
+
+        unlink(index);
+        nodes_[index].deadline = deadline;
+        link(index);
+        if (nodes_[index].deadline < wakeTick_)
+            tickerCv_.notify_one();
+        return true;
+    }
+
+    // Redistribue la case courante du niveau `level` vers les niveaux inférieurs.
+    bool TimingWheel::cascade(unsigned level)
+    {
+        const auto slot = static_cast<std::uint32_t>((base_ >> (kSlotBits * level)) & kSlotMask);
+        const std::uint32_t head = level * kSlots + slot;
+
+        std::uint32_t i = nodes_[head].next;
+        nodes_[head].next = nodes_[head].prev = head;
+        while (i != head)
+        {
+            const std::uint32_t next = nodes_[i].next;
+            link(i);
+            ++cascaded_;
+            i = next;
+        }
+        return slot == 0;
+    }
+
+    void TimingWheel::expireSlot()
+    {
+        const auto head = static_cast<std::uint32_t>(base_ & kSlotMask);
+
+        std::uint32_t i = nodes_[head].next;
+        nodes_[head].next = nodes_[head].prev = head;
+        while (i != head)
+        {
+            const std::uint32_t next = nodes_[i].next;
+            expiredByKind_[nodes_[i].kind].push_back(nodes_[i].payload);
+            release(i);
+            --pending_;
+            ++expired_;
+            i = next;
+        }
+    }
+
+    void TimingWheel::advance(std::uint64_t target)
+    {
+        while (base_ <= target)
+        {
+            if (pending_ == 0)
+            {
+                base_ = target + 1;
+                return;
+            }
+
+            if ((base_ & kSlotMask) == 0)
+                for (unsigned level = 1; level < kLevels && cascade(level); ++level)
+                {
+                }
+
+            expireSlot();
+            ++base_;
+        }
+    }
+
+    // Prochain tick à traiter : une case non vide du niveau 0 ou la prochaine cascade.
+    std::uint64_t TimingWheel::nextWakeTick() const
+    {
+        if ((base_ & kSlotMask) == 0)
+            return base_; // cascade due avant de regarder le niveau 0
+
+        const std::uint64_t boundary = (base_ | kSlotMask) + 1;
+        for (std::uint64_t t = base_; t < boundary; ++t)
+        {
+            const auto head = static_cast<std::uint32_t>(t & kSlotMask);
+            if (nodes_[head].next != head)
+                return t;
+        }
+        return boundary;
+    }
+
+    void TimingWheel::collectBatches(std::vector<Batch> &out)
+    {
+        for (std::size_t kind = 0; kind < expiredByKind_.size(); ++kind)
+        {
+            auto &expired = expiredByKind_[kind];
+            if (expired.empty())
+                continue;
+
+            if (expired.size() <= options_.batchSize)
+            {
+                out.push_back({handlers_[kind], std::move(expired)});
+                expired = {};
+            }
+            else
+            {
+                for (std::size_t i = 0; i < expired.size(); i += options_.batchSize)
+                {
+                    const auto end = std::min(expired.size(), i + options_.batchSize);
+                    out.push_back({handlers_[kind], {expired.begin() + i, expired.begin() + end}});
+                }
+                expired.clear();
+            }
+        }
+        batches_ += out.size();
+    }
+
+    void TimingWheel::runBatch(const Batch &batch)
+    {
+        try
+        {
+            (*batch.handler)(batch.payloads);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "[TimingWheel] ⚠️ handler: " << e.what() << "\n";
+        }
+        catch (...)
+        {
+            std::cerr << "[TimingWheel] ⚠️ handler: exception inconnue\n";
+        }
+    }
+
+    void TimingWheel::dispatch(std::vector<Batch> &batches)
+    {
+        if (workers_.empty())
+        {
+            for (const auto &b : batches)
+                runBatch(b);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            for (auto &b : batches)
+                queue_.push_back(std::move(b));
+        }
+        if (batches.size() == 1)
+            queueCv_.notify_one();
+        else
+            queueCv_.notify_all();
+    }
+
+    void TimingWheel::tickerLoop()
+    {
+        std::vector<Batch> ready;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_)
+        {
+            if (pending_ == 0)
+            {
+                wakeTick_ = kNoWake;
+                tickerCv_.wait(lock, [this]
+                               { return stopping_ || pending_ > 0; });
+                continue;
+            }
+
+            advance(nanos(Clock::now() - start_) / tickNs_);
+            collectBatches(ready);
+            if (!ready.empty())
+            {
+                // Les handlers tournent hors du verrou : ils peuvent replanifier.
+                wakeTick_ = 0;
+                lock.unlock();
+                dispatch(ready);
+                ready.clear();
+                lock.lock();
+                continue;
+            }
+
+            if (pending_ == 0)
+                continue;
+
+            wakeTick_ = nextWakeTick();
+            tickerCv_.wait_until(lock, start_ + std::chrono::nanoseconds(wakeTick_ * tickNs_));
+        }
+    }
+
+    void TimingWheel::workerLoop()
+    {
+        for (;;)
+        {
+            Batch batch;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex_);
+                queueCv_.wait(lock, [this]
+                              { return draining_ || !queue_.empty(); });
+                if (queue_.empty())
+                    return; // draining_ et file vidée
+
+                batch = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            runBatch(batch);
+        }
+    }
+
+    TimingWheelStats TimingWheel::stats() const
+    {
+        TimingWheelStats s;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            s.pending = pending_;
+            s.capacity = nodes_.size() - kLevels * kSlots;
+            s.bytesPerTimer = sizeof(Node);
+            s.scheduled = scheduled_;
+            s.cancelled = cancelled_;
+            s.expired = expired_;
+            s.batches = batches_;
+            s.rejected = rejected_;
+            s.cascaded = cascaded_;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            s.queuedBatches = queue_.size();
+        }
+        return s;
+    }
+}
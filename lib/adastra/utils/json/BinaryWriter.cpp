@@ -0,0 +1,158 @@
+#include <adastra/utils/json/BinaryWriter.hpp>
+
+#include <cstring>
+
+namespace adastra::utils::json
+{
+    namespace
+    {
+        std::uint32_t floatBits(float value)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof bits);
+            return bits;
+        }
+    }
+
+    // --- MessagePack ---
+
+    void MsgPackWriter::be(std::uint64_t value, int bytes)
+    {
+        for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+            out_.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+
+    void MsgPackWriter::header(std::uint8_t fix, std::uint8_t fixMax, std::uint8_t b16, std::uint8_t b32, std::size_t size)
+    {
+        if (size <= fixMax)
+        {
+            out_.push_back(static_cast<char>(fix | size));
+        }
+        else if (size <= 0xffff)
+        {
+            out_.push_back(static_cast<char>(b16));
+            be(size, 2);
+        }
+        else
+        {
+            out_.push_back(static_cast<char>(b32));
+            be(size, 4);
+        }
+    }
+
+    void MsgPackWriter::map(std::size_t size) { header(0x80, 15, 0xde, 0xdf, size); }
+
+    void MsgPackWriter::array(std::size_t size) { header(0x90, 15, 0xdc, 0xdd, size); }
+
+    void MsgPackWriter::string(std::string_view value)
+    {
+        const std::size_t n = value.size();
+        if (n <= 31)
+        {
+            out_.push_back(static_cast<char>(0xa0 | n));
+        }
+        else if (n <= 0xff)
+        {
+            out_.push_back(static_cast<char>(0xd9));
+            be(n, 1);
+        }
+        else if (n <= 0xffff)
+        {
+            out_.push_back(static_cast<char>(0xda));
+            be(n, 2);
+        }
+        else
+        {
+            out_.push_back(static_cast<char>(0xdb));
+            be(n, 4);
+        }
+        out_.append(value);
+    }
+
+    void MsgPackWriter::uint(std::uint64_t value)
+    {
+        if (value <= 0x7f)
+        {
+            out_.push_back(static_cast<char>(value));
+        }
+        else if (value <= 0xff)
+        {
+            out_.push_back(static_cast<char>(0xcc));
+            be(value, 1);
+        }
+        else if (value <= 0xffff)
+        {
+            out_.push_back(static_cast<char>(0xcd));
+            be(value, 2);
+        }
+        else if (value <= 0xffffffffULL)
+        {
+            out_.push_back(static_cast<char>(0xce));
+            be(value, 4);
+        }
+        else
+        {
+            out_.push_back(static_cast<char>(0xcf));
+            be(value, 8);
+        }
+    }
+
+    void MsgPackWriter::float32(float value)
+    {
+        out_.push_back(static_cast<char>(0xca));
+        be(floatBits(value), 4);
+    }
+
+    void MsgPackWriter::boolean(bool value) { out_.push_back(static_cast<char>(value ? 0xc3 : 0xc2)); }
+
+    void MsgPackWriter::null() { out_.push_back(static_cast<char>(0xc0)); }
+
+    // --- CBOR ---
+
+    void CborWriter::be(std::uint64_t value, int bytes)
+    {
+        for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8)
+            out_.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+
+    void CborWriter::head(std::uint8_t major, std::uint64_t value)
+    {
+        const auto type = static_cast<std::uint8_t>(major << 5);
+        if (value < 24)
+        {
+            out_.push_back(static_cast<char>(type | value));
+        }
+        else if (value <= 0xff)
+        {
+            out_.push_back(static_cast<char>(type | 24));
+            be(value, 1);
+        }
+        else if (value <= 0xffff)
+        {
+            out_.push_back(static_cast<char>(type | 25));
+            be(value, 2);
+        }
+        else if (value <= 0xffffffffULL)
+        {
+            out_.push_back(static_cast<char>(type | 26));
+            be(value, 4);
+        }
+        else
+        {
+            out_.push_back(static_cast<char>(type | 27));
+            be(value, 8);
+        }
+    }
+
+    void CborWriter::string(std::string_view value)
+    {
+        head(3, value.size());
+        out_.append(value);
+    }
+
+    void CborWriter::float32(float value)
+    {
+        out_.push_back(static_cast<char>(0xfa));
+        be(floatBits(value), 4);
+    }
+}
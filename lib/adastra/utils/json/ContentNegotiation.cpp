@@ -0,0 +1,135 @@
+#include <adastra/utils/json/ContentNegotiation.hpp>
+
+#include <cctype>
+#include <charconv>
+
+namespace adastra::utils::json
+{
+    namespace
+    {
+        std::string_view trim(std::string_view s)
+        {
+            while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front())))
+                s.remove_prefix(1);
+            while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back())))
+                s.remove_suffix(1);
+            return s;
+        }
+
+        bool iequals(std::string_view a, std::string_view b)
+        {
+            if (a.size() != b.size())
+                return false;
+            for (std::size_t i = 0; i < a.size(); ++i)
+            {
+                if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i])))
+                    return false;
+            }
+            return true;
+        }
+
+        // q en millièmes ; 1000 si absent ou illisible.
+        int qualityOf(std::string_view params)
+        {
+            while (!params.empty())
+            {
+                const auto semi = params.find(';');
+                std::string_view param = trim(params.substr(0, semi));
+                params = semi == std::string_view::npos ? std::string_view{} : params.substr(semi + 1);
+
+                if (param.size() < 2 || std::tolower(static_cast<unsigned char>(param[0])) != 'q' || param[1] != '=')
+                    continue;
+
+                double q = 1.0;
+                const auto value = param.substr(2);
+                auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), q);
+                (void)ptr;
+                if (ec != std::errc())
+                    return 1000;
+                if (q <= 0.0)
+                    return 0;
+                return q >= 1.0 ? 1000 : static_cast<int>(q * 1000.0);
+            }
+            return 1000;
+        }
+
+        bool mediaEncoding(std::string_view type, Encoding &out)
+        {
+            if (iequals(type, "application/json") || iequals(type, "*/*") || iequals(type, "application/*"))
+                out = Encoding::Json;
+            else if (iequals(type, "application/msgpack") || iequals(type, "application/x-msgpack") ||
+                     iequals(type, "application/vnd.msgpack"))
+                out = Encoding::MsgPack;
+            else if (iequals(type, "application/cbor"))
+                out = Encoding::Cbor;
+            else
+                return false;
+            return true;
+        }
+    }
+
+    Encoding negotiate(std::string_view accept)
+    {
+        Encoding best = Encoding::Json;
+        int bestQ = -1;
+        bool bestIsWildcard = true;
+
+        while (!accept.empty())
+        {
+            const auto comma = accept.find(',');
+            std::string_view item = accept.substr(0, comma);
+            accept = comma == std::string_view::npos ? std::string_view{} : accept.substr(comma + 1);
+
+            const auto semi = item.find(';');
+            const std::string_view type = trim(item.substr(0, semi));
+            const int q = semi == std::string_view::npos ? 1000 : qualityOf(item.substr(semi + 1));
+
+            Encoding enc;
+            if (q == 0 || !mediaEncoding(type, enc))
+                continue;
+
+            // À qualité égale, un type explicite l'emporte sur un joker.
+            const bool wildcard = type.find('*') != std::string_view::npos;
+            if (q > bestQ || (q == bestQ && bestIsWildcard && !wildcard))
+            {
+                best = enc;
+                bestQ = q;
+                bestIsWildcard = wildcard;
+            }
+        }
+        return best;
+    }
+
+    const char *contentType(Encoding encoding)
+    {
+        switch (encoding)
+        {
+        case Encoding::MsgPack:
+            return "application/msgpack";
+        case Encoding::Cbor:
+            return "application/cbor";
+        case Encoding::Json:
+        default:
+            return "application/json";
+        }
+    }
+
+    std::string encode(const nlohmann::json &value, Encoding encoding)
+    {
+        std::string out;
+        switch (encoding)
+        {
+        case Encoding::MsgPack:
+            nlohmann::json::to_msgpack(value, nlohmann::detail::output_adapter<char>(out));
+            break;
+        case Encoding::Cbor:
+            nlohmann::json::to_cbor(value, nlohmann::detail::output_adapter<char>(out));
+            break;
+        case Encoding::Json:
+        default:
+            out = value.dump();
+            break;
+        }
+        return out;
+    }
+}
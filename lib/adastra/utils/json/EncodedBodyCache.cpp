@@ -0,0 +1,27 @@
+#include <adastra/utils/json/EncodedBodyCache.hpp>
+
+namespace adastra::utils::json
+{
+    EncodedBodyCache::Body EncodedBodyCache::get(std::uint64_t version, Encoding encoding, const Builder &build)
+    {
+        // Construit sous le verrou : les requêtes concurrentes attendent le même corps
+        // au lieu de l'encoder chacune.
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Requête tenant encore un snapshot plus ancien : corps non mis en cache.
+        if (hasVersion_ && version < version_)
+            return std::make_shared<const std::string>(build(encoding));
+
+        if (!hasVersion_ || version_ != version)
+        {
+            bodies_ = {};
+            version_ = version;
+            hasVersion_ = true;
+        }
+
+        auto &slot = bodies_[static_cast<std::size_t>(encoding)];
+        if (!slot)
+            slot = std::make_shared<const std::string>(build(encoding));
+        return slot;
+    }
+}
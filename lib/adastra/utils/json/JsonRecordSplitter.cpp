@@ -0,0 +1,125 @@
+#include <adastra/utils/json/JsonRecordSplitter.hpp>
+
+namespace adastra::utils::json
+{
+    namespace
+    {
+        inline bool isSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        std::string_view trim(std::string_view s)
+        {
+            while (!s.empty() && isSpace(s.front()))
+                s.remove_prefix(1);
+            while (!s.empty() && isSpace(s.back()))
+                s.remove_suffix(1);
+            return s;
+        }
+
+        bool splitArray(std::string_view body, std::vector<std::string_view> &out, std::string &error)
+        {
+            // body commence par '['
+            int depth = 0;
+            bool inString = false;
+            bool escaped = false;
+            std::size_t start = 1;
+
+            for (std::size_t i = 0; i < body.size(); ++i)
+            {
+                const char c = body[i];
+                if (inString)
+                {
+                    if (escaped)
+                        escaped = false;
+                    else if (c == '\\')
+                        escaped = true;
+                    else if (c == '"')
+                        inString = false;
+                    continue;
+                }
+
+                switch (c)
+                {
+                case '"':
+                    inString = true;
+                    break;
+                case '[':
+                case '{':
+                    ++depth;
+                    break;
+                case ']':
+                case '}':
+                    if (--depth < 0)
+                    {
+                        error = "unbalanced brackets at offset " + std::to_string(i);
+                        return false;
+                    }
+                    if (depth == 0)
+                    {
+                        auto last = trim(body.substr(start, i - start));
+                        if (!last.empty())
+                            out.push_back(last);
+                        else if (!out.empty())
+                        {
+                            error = "trailing comma before offset " + std::to_string(i);
+                            return false;
+                        }
+                        if (!trim(body.substr(i + 1)).empty())
+                        {
+                            error = "unexpected data after closing bracket";
+                            return false;
+                        }
+                        return true;
+                    }
+                    break;
+                case ',':
+                    if (depth == 1)
+                    {
+                        auto record = trim(body.substr(start, i - start));
+                        if (record.empty())
+                        {
+                            error = "empty element at offset " + std::to_string(i);
+                            return false;
+                        }
+                        out.push_back(record);
+                        start = i + 1;
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            error = inString ? "unterminated string" : "missing closing bracket";
+            return false;
+        }
+    }
+
+    bool splitJsonRecords(std::string_view body, std::vector<std::string_view> &out, std::string &error)
+    {
+        // BOM UTF-8 éventuel
+        if (body.size() >= 3 && body.substr(0, 3) == "\xEF\xBB\xBF")
+            body.remove_prefix(3);
+
+        body = trim(body);
+        if (body.empty())
+            return true;
+
+        if (body.front() == '[')
+            return splitArray(body, out, error);
+
+        while (!body.empty())
+        {
+            const auto eol = body.find('\n');
+            auto line = trim(body.substr(0, eol));
+            if (!line.empty())
+                out.push_back(line);
+            if (eol == std::string_view::npos)
+                break;
+            body.remove_prefix(eol + 1);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,101 @@
+#include <adastra/utils/string/Base64.hpp>
+
+#include <array>
+
+namespace adastra::utils::string
+{
+    namespace
+    {
+        constexpr char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+        // 0xFF pour les caractères hors alphabet : un OU des quatre valeurs
+        // d'un groupe suffit à détecter une erreur (bit 7).
+        constexpr std::array<std::uint8_t, 256> makeDecodeTable()
+        {
+            std::array<std::uint8_t, 256> t{};
+            for (auto &v : t)
+                v = 0xFF;
+            for (std::uint8_t i = 0; i < 64; ++i)
+                t[static_cast<unsigned char>(kAlphabet[i])] = i;
+            return t;
+        }
+
+        constexpr auto kDecode = makeDecodeTable();
+    }
+
+    std::string base64UrlEncode(std::span<const std::uint8_t> bytes)
+    {
+        std::string out;
+        out.resize((bytes.size() * 4 + 2) / 3);
+
+        const std::uint8_t *p = bytes.data();
+        char *o = out.data();
+        std::size_t i = 0;
+        for (; i + 3 <= bytes.size(); i += 3)
+        {
+            const std::uint32_t v = (std::uint32_t(p[i]) << 16) | (std::uint32_t(p[i + 1]) << 8) | p[i + 2];
+            *o++ = kAlphabet[v >> 18];
+            *o++ = kAlphabet[(v >> 12) & 63];
+            *o++ = kAlphabet[(v >> 6) & 63];
+            *o++ = kAlphabet[v & 63];
+        }
+
+        const std::size_t rest = bytes.size() - i;
+        if (rest > 0)
+        {
+            std::uint32_t v = std::uint32_t(p[i]) << 16;
+            if (rest == 2)
+                v |= std::uint32_t(p[i + 1]) << 8;
+            *o++ = kAlphabet[v >> 18];
+            *o++ = kAlphabet[(v >> 12) & 63];
+            if (rest == 2)
+                *o++ = kAlphabet[(v >> 6) & 63];
+        }
+        return out;
+    }
+
+    bool base64UrlDecode(std::string_view in, std::string &out)
+    {
+        if (in.size() % 4 == 1)
+            return false;
+
+        out.resize(base64UrlDecodedSize(in.size()));
+        const auto *p = reinterpret_cast<const unsigned char *>(in.data());
+        char *o = out.data();
+
+        // Groupes complets de 4 caractères -> 3 octets.
+        const std::size_t full = in.size() / 4 * 4;
+        for (std::size_t i = 0; i < full; i += 4)
+        {
+            const std::uint8_t a = kDecode[p[i]], b = kDecode[p[i + 1]];
+            const std::uint8_t c = kDecode[p[i + 2]], d = kDecode[p[i + 3]];
+            if ((a | b | c | d) & 0x80)
+                return false;
+
+            const std::uint32_t v = (std::uint32_t(a) << 18) | (std::uint32_t(b) << 12) | (std::uint32_t(c) << 6) | d;
+            *o++ = static_cast<char>(v >> 16);
+            *o++ = static_cast<char>(v >> 8);
+            *o++ = static_cast<char>(v);
+        }
+
+        // Queue de 2 ou 3 caractères ; les bits inutilisés doivent être nuls
+        // (encodage canonique, sinon deux jetons différents donneraient les mêmes octets).
+        const std::size_t rest = in.size() - full;
+        if (rest == 0)
+            return true;
+
+        const std::uint8_t a = kDecode[p[full]], b = kDecode[p[full + 1]];
+        const std::uint8_t c = rest == 3 ? kDecode[p[full + 2]] : 0;
+        if ((a | b | c) & 0x80)
+            return false;
+
+        const std::uint32_t v = (std::uint32_t(a) << 18) | (std::uint32_t(b) << 12) | (std::uint32_t(c) << 6);
+        *o++ = static_cast<char>(v >> 16);
+        if (rest == 3)
+        {
+            *o++ = static_cast<char>(v >> 8);
+            return (v & 0xFF) == 0;
+        }
+        return (v & 0xFFFF) == 0;
+    }
+}
@@ -0,0 +1,217 @@
+#include <adastra/utils/validation/JsonSchema.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+namespace adastra::utils::validation
+{
+    namespace
+    {
+        // Même classe que \s dans la regex d'origine.
+        inline bool isSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+        }
+
+        bool parseInteger(std::string_view s, long long &out)
+        {
+            bool negative = false;
+            if (!s.empty() && (s.front() == '+' || s.front() == '-'))
+            {
+                negative = s.front() == '-';
+                s.remove_prefix(1);
+            }
+            if (s.empty() || s.size() > 18)
+                return false;
+
+            long long value = 0;
+            for (char c : s)
+            {
+                if (c < '0' || c > '9')
+                    return false;
+                value = value * 10 + (c - '0');
+            }
+            out = negative ? -value : value;
+            return true;
+        }
+    }
+
+    bool isEmail(std::string_view value)
+    {
+        const auto at = value.find('@');
+        if (at == std::string_view::npos || at == 0 || value.find('@', at + 1) != std::string_view::npos)
+            return false;
+
+        for (char c : value)
+        {
+            if (isSpace(c))
+                return false;
+        }
+
+        // Au moins un point avec un caractère de chaque côté dans le domaine.
+        const auto domain = value.substr(at + 1);
+        const auto dot = domain.find('.', 1);
+        return dot != std::string_view::npos && dot + 1 < domain.size();
+    }
+
+    bool integerValue(const nlohmann::json &value, long long &out)
+    {
+        if (value.is_number_integer() && !value.is_number_unsigned())
+        {
+            out = value.get<long long>();
+            return true;
+        }
+        if (value.is_number_unsigned())
+        {
+            const auto u = value.get<unsigned long long>();
+            if (u > static_cast<unsigned long long>(std::numeric_limits<long long>::max()))
+                return false;
+            out = static_cast<long long>(u);
+            return true;
+        }
+        if (value.is_number_float())
+        {
+            const double d = value.get<double>();
+            if (!std::isfinite(d) || std::trunc(d) != d || std::fabs(d) > 9e15)
+                return false;
+            out = static_cast<long long>(d);
+            return true;
+        }
+        if (value.is_string())
+            return parseInteger(value.get_ref<const std::string &>(), out);
+        return false;
+    }
+
+    bool numberValue(const nlohmann::json &value, double &out)
+    {
+        if (value.is_number())
+        {
+            out = value.get<double>();
+            return std::isfinite(out);
+        }
+        if (!value.is_string())
+            return false;
+
+        const auto &s = value.get_ref<const std::string &>();
+        double d = 0;
+        const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), d);
+        if (ec != std::errc() || ptr != s.data() + s.size() || !std::isfinite(d))
+            return false;
+        out = d;
+        return true;
+    }
+
+    JsonSchema::Field &JsonSchema::Field::string(std::size_t minLength, std::size_t maxLength)
+    {
+        kind_ = Kind::String;
+        minLength_ = minLength;
+        maxLength_ = maxLength;
+        return *this;
+    }
+
+    JsonSchema::Field &JsonSchema::Field::email(std::string message)
+    {
+        kind_ = Kind::Email;
+        message_ = std::move(message);
+        return *this;
+    }
+
+    JsonSchema::Field &JsonSchema::Field::integer(long long min, long long max, std::string label)
+    {
+        kind_ = Kind::Integer;
+        min_ = min;
+        max_ = max;
+        if (!label.empty())
+            label_ = std::move(label);
+        return *this;
+    }
+
+    JsonSchema::Field &JsonSchema::Field::number(double min, double max, std::string label)
+    {
+        kind_ = Kind::Number;
+        minNumber_ = min;
+        maxNumber_ = max;
+        if (!label.empty())
+            label_ = std::move(label);
+        return *this;
+    }
+
+    void JsonSchema::Field::check(const nlohmann::json *value, std::vector<FieldError> &errors) const
+    {
+        const bool missing = !value || value->is_null() ||
+                             (value->is_string() && value->get_ref<const std::string &>().empty());
+        if (missing)
+        {
+            if (required_)
+                errors.push_back({name_, label_ + " is required"});
+            return;
+        }
+
+        switch (kind_)
+        {
+        case Kind::Any:
+            return;
+
+        case Kind::String:
+        {
+            if (!value->is_string())
+            {
+                errors.push_back({name_, label_ + " must be a string"});
+                return;
+            }
+            const auto n = value->get_ref<const std::string &>().size();
+            if (n < minLength_ || n > maxLength_)
+                errors.push_back({name_, label_ + " has an invalid length"});
+            return;
+        }
+
+        case Kind::Email:
+            if (!value->is_string() || !isEmail(value->get_ref<const std::string &>()))
+                errors.push_back({name_, message_});
+            return;
+
+        case Kind::Integer:
+        {
+            long long n = 0;
+            if (!integerValue(*value, n))
+                errors.push_back({name_, label_ + " must be an integer"});
+            else if (n < min_ || n > max_)
+                errors.push_back({name_, label_ + " must be between " + std::to_string(min_) + " and " + std::to_string(max_)});
+            return;
+        }
+
+        case Kind::Number:
+        {
+            double n = 0;
+            if (!numberValue(*value, n))
+                errors.push_back({name_, label_ + " must be a number"});
+            else if (n < minNumber_ || n > maxNumber_)
+                errors.push_back({name_, label_ + " is out of range"});
+            return;
+        }
+        }
+    }
+
+    JsonSchema::Field &JsonSchema::field(std::string name)
+    {
+        return fields_.emplace_back(std::move(name));
+    }
+
+    std::vector<FieldError> JsonSchema::validate(const nlohmann::json &body) const
+    {
+        std::vector<FieldError> errors;
+        if (!body.is_object())
+        {
+            errors.push_back({"body", "Expected a JSON object"});
+            return errors;
+        }
+
+        for (const auto &f : fields_)
+        {
+            auto it = body.find(f.name_);
+            f.check(it == body.end() ? nullptr : &*it, errors);
+        }
+        return errors;
+    }
+}
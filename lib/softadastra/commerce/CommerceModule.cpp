@@ -0,0 +1,37 @@
+#include <softadastra/commerce/CommerceModule.hpp>
+#include <softadastra/commerce/products/ProductController.hpp>
+#include <softadastra/commerce/categories/CategoryController.hpp>
+#include <softadastra/commerce/sizes/SizeController.hpp>
+#include <softadastra/commerce/colors/ColorController.hpp>
+#include <softadastra/commerce/cities/CityController.hpp>
+
+#include <adastra/config/env/EnvLoader.hpp>
+
+#include <filesystem>
+
+#ifndef SA_BACKEND_ROOT
+#define SA_BACKEND_ROOT ""
+#endif
+
+namespace softadastra::commerce
+{
+    std::string resolveDataPath(const std::string &envKey, const std::string &defaultFile)
+    {
+        std::filesystem::path p = adastra::config::env::EnvLoader::get(envKey, "");
+        if (p.empty())
+            p = std::filesystem::path("config") / "data" / defaultFile;
+        if (p.is_relative())
+            p = std::filesystem::path(SA_BACKEND_ROOT) / p;
+        return p.lexically_normal().string();
+    }
+
+    void CommerceModule(Vix::App &app)
+    {
+        // ProductController charge le .env : il doit rester le premier.
+        products::ProductController(app);
+        categories::CategoryController(app);
+        sizes::SizeController(app);
+        colors::ColorController(app);
+        cities::CityController(app);
+    }
+}
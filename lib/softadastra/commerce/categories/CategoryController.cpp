@@ -0,0 +1,106 @@
+#include <softadastra/commerce/categories/CategoryController.hpp>
+#include <softadastra/commerce/categories/CategoryService.hpp>
+#include <softadastra/commerce/categories/CategoryServiceFromCache.hpp>
+#include <softadastra/commerce/CommerceModule.hpp>
+
+#include <adastra/utils/json/ContentNegotiation.hpp>
+#include <adastra/utils/json/EncodedBodyCache.hpp>
+
+#include <charconv>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+namespace softadastra::commerce::categories
+{
+    namespace
+    {
+        using adastra::utils::json::Encoding;
+
+        constexpr std::size_t DEFAULT_LEAF_LIMIT = 100;
+        constexpr std::size_t MAX_LEAF_LIMIT = 1000;
+
+        std::once_flag g_loadFlag;
+        std::unique_ptr<CategoryServiceFromCache> g_service;
+        adastra::utils::json::EncodedBodyCache g_allBodies;
+        adastra::utils::json::EncodedBodyCache g_topBodies;
+
+        const CategoryServiceFromCache &service(const std::string &path)
+        {
+            std::call_once(g_loadFlag, [&]
+                           {
+                auto svc = std::make_unique<CategoryServiceFromCache>(CategoryService(path).getAllCategories());
+                // Construit les caches paresseux maintenant : ensuite, lectures seules entre threads.
+                svc->getTopLevelCategories();
+                svc->getLeafCategories(0, 0);
+                g_service = std::move(svc); });
+            return *g_service;
+        }
+
+        std::size_t query_size(const std::string &s, std::size_t fallback)
+        {
+            std::size_t value = fallback;
+            auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+            return (ec != std::errc() || ptr != s.data() + s.size()) ? fallback : value;
+        }
+
+        template <typename Res>
+        void send_encoded(Res &res, Encoding enc, const std::string &body)
+        {
+            res.header("Content-Type", adastra::utils::json::contentType(enc));
+            res.header("Vary", "Accept");
+            res.send(body);
+        }
+
+        template <typename Res>
+        void send_error(Res &res, const std::exception &e)
+        {
+            std::cerr << "[CategoryController] " << e.what() << "\n";
+            res.status(http::status::internal_server_error)
+                .json(Vix::json::o("error", e.what()));
+        }
+    }
+
+    void CategoryController(Vix::App &app)
+    {
+        const std::string path = resolveDataPath("CATEGORY_JSON_PATH", "all_categories.json");
+
+        app.get("/api/categories", [path](auto &req, auto &res)
+                {
+            try {
+                const auto &svc = service(path);
+                const Encoding enc = adastra::utils::json::negotiate(req.header("Accept"));
+                auto body = g_allBodies.get(1, enc, [&](Encoding e)
+                                            { return adastra::utils::json::encodeList(svc.getAllCategories(), e); });
+                send_encoded(res, enc, *body);
+            } catch (const std::exception& e) {
+                send_error(res, e);
+            } });
+
+        app.get("/api/categories/top", [path](auto &req, auto &res)
+                {
+            try {
+                const auto &svc = service(path);
+                const Encoding enc = adastra::utils::json::negotiate(req.header("Accept"));
+                auto body = g_topBodies.get(1, enc, [&](Encoding e)
+                                            { return adastra::utils::json::encodeList(svc.getTopLevelCategories(), e); });
+                send_encoded(res, enc, *body);
+            } catch (const std::exception& e) {
+                send_error(res, e);
+            } });
+
+        // ?offset=&limit= (limit <= 1000)
+        app.get("/api/categories/leaf", [path](auto &req, auto &res)
+                {
+            try {
+                const auto &svc = service(path);
+                const std::size_t offset = query_size(req.query_value("offset", ""), 0);
+                const std::size_t limit = std::min(query_size(req.query_value("limit", ""), DEFAULT_LEAF_LIMIT), MAX_LEAF_LIMIT);
+
+                const Encoding enc = adastra::utils::json::negotiate(req.header("Accept"));
+                send_encoded(res, enc, adastra::utils::json::encodeList(svc.getLeafCategories(offset, limit), enc));
+            } catch (const std::exception& e) {
+                send_error(res, e);
+            } });
+    }
+}
@@ -0,0 +1,47 @@
+#include <softadastra/commerce/cities/CityController.hpp>
+#include <softadastra/commerce/cities/CityService.hpp>
+#include <softadastra/commerce/CommerceModule.hpp>
+
+#include <adastra/utils/json/ContentNegotiation.hpp>
+#include <adastra/utils/json/EncodedBodyCache.hpp>
+
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace softadastra::commerce::cities
+{
+    namespace
+    {
+        using adastra::utils::json::Encoding;
+
+        std::once_flag g_loadFlag;
+        std::vector<City> g_items;
+        adastra::utils::json::EncodedBodyCache g_bodies;
+    }
+
+    void CityController(Vix::App &app)
+    {
+        const std::string path = resolveDataPath("CITY_JSON_PATH", "all_cities.json");
+
+        app.get("/api/cities", [path](auto &req, auto &res)
+                {
+            try {
+                std::call_once(g_loadFlag, [&]
+                               { g_items = CityService(path).getAll(); });
+
+                // Données statiques : une seule version, encodée une fois par format.
+                const Encoding enc = adastra::utils::json::negotiate(req.header("Accept"));
+                auto body = g_bodies.get(1, enc, [](Encoding e)
+                                         { return adastra::utils::json::encodeList(g_items, e); });
+
+                res.header("Content-Type", adastra::utils::json::contentType(enc));
+                res.header("Vary", "Accept");
+                res.send(*body);
+            } catch (const std::exception& e) {
+                std::cerr << "[CityController] " << e.what() << "\n";
+                res.status(http::status::internal_server_error)
+                   .json(Vix::json::o("error", e.what()));
+            } });
+    }
+}
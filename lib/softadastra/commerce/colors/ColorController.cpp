@@ -0,0 +1,47 @@
+#include <softadastra/commerce/colors/ColorController.hpp>
+#include <softadastra/commerce/colors/ColorService.hpp>
+#include <softadastra/commerce/CommerceModule.hpp>
+
+#include <adastra/utils/json/ContentNegotiation.hpp>
+#include <adastra/utils/json/EncodedBodyCache.hpp>
+
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace softadastra::commerce::colors
+{
+    namespace
+    {
+        using adastra::utils::json::Encoding;
+
+        std::once_flag g_loadFlag;
+        std::vector<Color> g_items;
+        adastra::utils::json::EncodedBodyCache g_bodies;
+    }
+
+    void ColorController(Vix::App &app)
+    {
+        const std::string path = resolveDataPath("COLOR_JSON_PATH", "all_colors.json");
+
+        app.get("/api/colors", [path](auto &req, auto &res)
+                {
+            try {
+                std::call_once(g_loadFlag, [&]
+                               { g_items = ColorService(path).getAllColors(); });
+
+                // Données statiques : une seule version, encodée une fois par format.
+                const Encoding enc = adastra::utils::json::negotiate(req.header("Accept"));
+                auto body = g_bodies.get(1, enc, [](Encoding e)
+                                         { return adastra::utils::json::encodeList(g_items, e); });
+
+                res.header("Content-Type", adastra::utils::json::contentType(enc));
+                res.header("Vary", "Accept");
+                res.send(*body);
+            } catch (const std::exception& e) {
+                std::cerr << "[ColorController] " << e.what() << "\n";
+                res.status(http::status::internal_server_error)
+                   .json(Vix::json::o("error", e.what()));
+            } });
+    }
+}
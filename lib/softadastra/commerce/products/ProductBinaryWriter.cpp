@@ -0,0 +1,158 @@
+#include <softadastra/commerce/products/ProductBinaryWriter.hpp>
+
+#include <adastra/tools/time/TImestampUtils.hpp>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        template <typename W>
+        void writeStrings(W &w, const std::vector<std::string> &values)
+        {
+            w.array(values.size());
+            for (const auto &v : values)
+                w.string(v);
+        }
+
+        template <typename W>
+        void write(W &w, const Product &p)
+        {
+            const bool hasPrice = p.getConvertedPriceValue() > 0.0f;
+            const bool hasShipping = p.getPriceWithShipping() > 0.0f;
+
+            // Même sélection de champs que Product::toJson().
+            std::size_t fields = 9; // id, title, image_url, city_name, country_image_url, currency, formatted_price, converted_price, boost
+            fields += hasPrice + hasShipping;
+            fields += p.getOriginalPrice().has_value() + p.getBrandId().has_value() + p.getAverageRating().has_value();
+            fields += !p.getSizes().empty() + !p.getColors().empty();
+            fields += !p.getConditionName().empty() + !p.getBrandName().empty() + !p.getPackageFormatName().empty();
+            fields += (p.getCategoryId() != 0) + (p.getViews() > 0) + (p.getReviewCount() > 0) + (p.getCreatedAt() != 0);
+            fields += !p.getSimilarProducts().empty() + !p.getImages().empty() + !p.getCustomFields().empty();
+
+            w.map(fields);
+            w.string("id");
+            w.string(std::to_string(p.getId())); // chaîne, comme toJson()
+            w.string("title");
+            w.string(p.getTitle());
+            w.string("image_url");
+            w.string(p.getImageUrl());
+            w.string("city_name");
+            w.string(p.getCityName());
+            w.string("country_image_url");
+            w.string(p.getCountryImageUrl());
+            w.string("currency");
+            w.string(p.getCurrency());
+            w.string("formatted_price");
+            w.string(p.getFormattedPrice());
+            w.string("converted_price");
+            w.string(p.getConvertedPrice());
+
+            if (hasPrice)
+            {
+                w.string("converted_price_value");
+                w.float32(p.getConvertedPriceValue());
+            }
+            if (hasShipping)
+            {
+                w.string("price_with_shipping_value");
+                w.float32(p.getPriceWithShipping());
+            }
+            if (p.getOriginalPrice())
+            {
+                w.string("original_price");
+                w.string(*p.getOriginalPrice());
+            }
+            if (p.getBrandId())
+            {
+                w.string("brand_id");
+                w.uint(*p.getBrandId());
+            }
+            if (p.getAverageRating())
+            {
+                w.string("average_rating");
+                w.float32(*p.getAverageRating());
+            }
+
+            if (!p.getSizes().empty())
+            {
+                w.string("sizes");
+                writeStrings(w, p.getSizes());
+            }
+            if (!p.getColors().empty())
+            {
+                w.string("colors");
+                writeStrings(w, p.getColors());
+            }
+            if (!p.getConditionName().empty())
+            {
+                w.string("condition_name");
+                w.string(p.getConditionName());
+            }
+            if (!p.getBrandName().empty())
+            {
+                w.string("brand_name");
+                w.string(p.getBrandName());
+            }
+            if (!p.getPackageFormatName().empty())
+            {
+                w.string("package_format_name");
+                w.string(p.getPackageFormatName());
+            }
+            if (p.getCategoryId() != 0)
+            {
+                w.string("category_id");
+                w.uint(p.getCategoryId());
+            }
+            if (p.getViews() > 0)
+            {
+                w.string("views");
+                w.uint(p.getViews());
+            }
+            if (p.getReviewCount() > 0)
+            {
+                w.string("review_count");
+                w.uint(p.getReviewCount());
+            }
+            if (p.getCreatedAt() != 0)
+            {
+                char text[adastra::tools::time::kDateTimeSize];
+                adastra::tools::time::formatDateTime(p.getCreatedAt(), text);
+                w.string("created_at");
+                w.string(std::string_view(text, sizeof(text)));
+            }
+
+            w.string("boost");
+            w.boolean(p.isBoosted());
+
+            if (!p.getSimilarProducts().empty())
+            {
+                w.string("similar_products");
+                w.array(p.getSimilarProducts().size());
+                for (auto id : p.getSimilarProducts())
+                    w.uint(id);
+            }
+            if (!p.getImages().empty())
+            {
+                w.string("images");
+                writeStrings(w, p.getImages());
+            }
+            if (!p.getCustomFields().empty())
+            {
+                w.string("custom_fields");
+                w.array(p.getCustomFields().size());
+                for (const auto &[name, value] : p.getCustomFields())
+                {
+                    w.map(2);
+                    w.string("name");
+                    w.string(name);
+                    w.string("value");
+                    w.string(value);
+                }
+            }
+        }
+    }
+
+    void writeProduct(adastra::utils::json::MsgPackWriter &w, const Product &p) { write(w, p); }
+
+    void writeProduct(adastra::utils::json::CborWriter &w, const Product &p) { write(w, p); }
+}
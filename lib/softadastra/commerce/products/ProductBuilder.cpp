@@ -4,7 +4,7 @@ namespace softadastra::commerce::products
 {
     ProductBuilder::ProductBuilder() : product() {}
 
-    ProductBuilder &ProductBuilder::setId(uint32_t id)
+    ProductBuilder &ProductBuilder::setId(std::uint64_t id)
     {
         product.setId(id);
         return *this;
@@ -104,6 +104,11 @@ namespace softadastra::commerce::products
         product.setBoost(boost);
         return *this;
     }
+    ProductBuilder &ProductBuilder::setCreatedAt(std::int64_t epochSeconds)
+    {
+        product.setCreatedAt(epochSeconds);
+        return *this;
+    }
     ProductBuilder &ProductBuilder::setOriginalPrice(const std::optional<std::string> &originalPrice)
     {
         product.setOriginalPrice(originalPrice);
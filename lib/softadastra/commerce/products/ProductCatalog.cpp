@@ -0,0 +1,189 @@
+#include <softadastra/commerce/products/ProductCatalog.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        // Upserts (nouveaux ids ou corps modifiés) puis deletes (ids disparus).
+        std::vector<ProductChange> diff(const ProductSnapshot &before, const ProductSnapshot &after)
+        {
+            std::vector<ProductChange> out;
+            for (std::size_t i = 0; i < after.products.size(); ++i)
+            {
+                const auto id = after.products[i].getId();
+                if (id == 0 || after.slotOf(id) != i)
+                    continue;
+
+                const auto old = before.slotOf(id);
+                if (old == ProductSnapshot::npos || before.bodies[old] != after.bodies[i])
+                    out.push_back({0, id, ChangeOp::Upsert});
+            }
+
+            for (std::size_t i = 0; i < before.products.size(); ++i)
+            {
+                const auto id = before.products[i].getId();
+                if (id != 0 && before.slotOf(id) == i && after.slotOf(id) == ProductSnapshot::npos)
+                    out.push_back({0, id, ChangeOp::Delete});
+            }
+            return out;
+        }
+    }
+
+    ProductCatalog::ProductCatalog(ProductCache &cache, ProductIngestLog *log)
+        : cache_(&cache), log_(log) {}
+
+    ProductCatalog::ProductCatalog(ProductRepository &store)
+        : cache_(nullptr), log_(nullptr), store_(&store)
+    {
+        // Un backend non incrémental n'écrit rien avant flush() : les lots publiés
+        // seraient perdus au redémarrage.
+        if (!store.backend()->incremental())
+            throw std::invalid_argument("ProductCatalog: le dépôt doit avoir un backend incrémental (base SQLite)");
+    }
+
+    std::vector<Product> ProductCatalog::loadAll()
+    {
+        if (store_)
+        {
+            // Lu directement sur le backend : le dépôt ne garde pas de seconde copie.
+            std::vector<Product> items;
+            for (const auto &doc : store_->backend()->loadAll())
+                items.push_back(Product::fromJson(doc));
+            return items;
+        }
+
+        std::vector<Product> items = cache_->getAll();
+        if (log_)
+        {
+            auto ingested = log_->replay();
+            items.reserve(items.size() + ingested.size());
+            std::move(ingested.begin(), ingested.end(), std::back_inserter(items));
+        }
+        return items;
+    }
+
+    void ProductCatalog::install(std::shared_ptr<ProductSnapshot> next, const std::vector<ProductChange> &changes,
+                                 bool relayout)
+    {
+        // La version est enregistrée avant la publication : un lecteur qui voit le
+        // snapshot trouve toujours ses changements dans changes_.
+        next->version = changes_.record(changes);
+        if (relayout)
+            next->layout = next->version;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        current_ = std::move(next);
+    }
+
+    ProductSnapshotPtr ProductCatalog::currentOrLoad()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (current_)
+                return current_;
+        }
+
+        auto first = std::make_shared<ProductSnapshot>(loadAll());
+        first->version = first->layout = changes_.version();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        current_ = first;
+        return first;
+    }
+
+    ProductSnapshotPtr ProductCatalog::snapshot()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (current_)
+                return current_;
+        }
+
+        std::lock_guard<std::mutex> write(writeMutex_);
+        return currentOrLoad();
+    }
+
+    ProductSnapshotPtr ProductCatalog::refresh()
+    {
+        std::lock_guard<std::mutex> write(writeMutex_);
+
+        ProductSnapshotPtr before;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            before = current_;
+        }
+
+        auto next = std::make_shared<ProductSnapshot>(loadAll());
+        if (!before)
+        {
+            next->version = next->layout = changes_.version();
+            std::lock_guard<std::mutex> lock(mutex_);
+            current_ = next;
+            return next;
+        }
+
+        install(next, diff(*before, *next), true);
+        return next;
+    }
+
+    ProductSnapshotPtr ProductCatalog::publish(std::vector<Product> added)
+    {
+        const std::size_t count = added.size();
+        PublishReport report = publishBatches(std::move(added), count);
+        if (!report.error.empty())
+            throw std::runtime_error(report.error);
+        return report.snapshot;
+    }
+
+    PublishReport ProductCatalog::publishBatches(std::vector<Product> added, std::size_t batchSize)
+    {
+        std::lock_guard<std::mutex> write(writeMutex_);
+
+        // Le snapshot de base doit exister avant l'écriture : sinon le premier
+        // chargement rejouerait ces lots, qui seraient ensuite ajoutés une seconde fois.
+        PublishReport report;
+        auto base = currentOrLoad();
+        report.snapshot = base;
+
+        const std::size_t step = std::max<std::size_t>(1, batchSize);
+        std::vector<Product> batch;
+        while (report.persisted < added.size())
+        {
+            const auto first = added.begin() + static_cast<std::ptrdiff_t>(report.persisted);
+            const auto last = added.begin() + static_cast<std::ptrdiff_t>(std::min(added.size(), report.persisted + step));
+            batch.assign(std::make_move_iterator(first), std::make_move_iterator(last));
+            try
+            {
+                if (store_)
+                    store_->addAll(batch);
+                else if (log_)
+                    log_->append(batch);
+            }
+            catch (const std::exception &e)
+            {
+                report.error = e.what();
+                break;
+            }
+            std::move(batch.begin(), batch.end(), first);
+            report.persisted += batch.size();
+            ++report.batches;
+        }
+        if (report.persisted == 0)
+            return report;
+        added.erase(added.begin() + static_cast<std::ptrdiff_t>(report.persisted), added.end());
+
+        std::vector<ProductChange> changes;
+        changes.reserve(added.size());
+        for (const auto &p : added)
+            changes.push_back({0, p.getId(), ChangeOp::Upsert});
+
+        auto next = std::make_shared<ProductSnapshot>(*base, std::move(added));
+        install(next, changes);
+        report.snapshot = next;
+        return report;
+    }
+}
@@ -0,0 +1,111 @@
+#include <softadastra/commerce/products/ProductChangeLog.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        std::uint64_t startVersion()
+        {
+            using namespace std::chrono;
+            return static_cast<std::uint64_t>(
+                duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+        }
+    }
+
+    ProductChangeLog::ProductChangeLog(std::size_t capacity)
+        : ring_(std::max<std::size_t>(capacity, 1)),
+          version_(startVersion()),
+          floor_(version_) {}
+
+    std::uint64_t ProductChangeLog::version() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return version_;
+    }
+
+    std::uint64_t ProductChangeLog::floor() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return floor_;
+    }
+
+    void ProductChangeLog::push(const ProductChange &change)
+    {
+        if (size_ == ring_.size())
+        {
+            // L'entrée évincée rend sa version incomplète : les clients plus anciens resynchronisent.
+            floor_ = std::max(floor_, ring_[head_].version);
+            head_ = (head_ + 1) % ring_.size();
+            --size_;
+        }
+        ring_[(head_ + size_) % ring_.size()] = change;
+        ++size_;
+    }
+
+    std::uint64_t ProductChangeLog::record(const std::vector<ProductChange> &changes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::uint64_t v = ++version_;
+
+        if (changes.size() > ring_.size())
+        {
+            head_ = 0;
+            size_ = 0;
+            floor_ = v;
+            return v;
+        }
+
+        for (const auto &c : changes)
+            push({v, c.id, c.op});
+        return v;
+    }
+
+    ProductDelta ProductChangeLog::since(std::uint64_t since, std::uint64_t upTo) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        ProductDelta delta;
+        delta.version = std::min(upTo, version_);
+        if (since < floor_ || since > delta.version)
+        {
+            delta.expired = true;
+            return delta;
+        }
+
+        // Les entrées sont triées par version : recherche du premier > since.
+        std::size_t lo = 0, hi = size_;
+        while (lo < hi)
+        {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (at(mid).version <= since)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        std::unordered_map<std::uint64_t, ChangeOp> latest;
+        std::vector<std::uint64_t> order;
+        for (std::size_t i = lo; i < size_ && at(i).version <= delta.version; ++i)
+        {
+            const auto &c = at(i);
+            auto [it, inserted] = latest.try_emplace(c.id, c.op);
+            if (inserted)
+                order.push_back(c.id);
+            else
+                it->second = c.op;
+        }
+
+        for (auto id : order)
+        {
+            if (latest[id] == ChangeOp::Delete)
+                delta.deletes.push_back(id);
+            else
+                delta.upserts.push_back(id);
+        }
+        return delta;
+    }
+}
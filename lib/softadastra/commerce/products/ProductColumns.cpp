@@ -0,0 +1,106 @@
+#include <softadastra/commerce/products/ProductColumns.hpp>
+
+#include <limits>
+#include <stdexcept>
+
+namespace softadastra::commerce::products
+{
+    namespace col = adastra::core::columnar;
+
+    ProductColumns::ProductColumns(const std::vector<Product> &products)
+    {
+        const std::size_t n = products.size();
+        converted_price_value.reserve(n);
+        price_with_shipping_value.reserve(n);
+        average_rating.reserve(n);
+        views.reserve(n);
+        review_count.reserve(n);
+        category_id.reserve(n);
+        boost.reserve(n);
+        created_at.reserve(n);
+
+        for (const auto &p : products)
+        {
+            converted_price_value.push_back(p.getConvertedPriceValue());
+            price_with_shipping_value.push_back(p.getPriceWithShipping());
+            average_rating.push_back(p.getAverageRating().value_or(std::numeric_limits<float>::quiet_NaN()));
+            views.push_back(p.getViews());
+            review_count.push_back(p.getReviewCount());
+            category_id.push_back(p.getCategoryId());
+            boost.push_back(p.isBoosted() ? 1 : 0);
+
+            const std::int64_t created = p.getCreatedAt();
+            created_at.push_back(created <= 0 ? 0u
+                                 : created > std::numeric_limits<std::uint32_t>::max()
+                                     ? std::numeric_limits<std::uint32_t>::max()
+                                     : static_cast<std::uint32_t>(created));
+        }
+    }
+
+    namespace
+    {
+        void addFloatRange(std::vector<col::Predicate> &preds, const std::vector<float> &column,
+                           const std::optional<float> &lo, const std::optional<float> &hi)
+        {
+            if (!lo && !hi)
+                return;
+
+            const float from = lo.value_or(-std::numeric_limits<float>::infinity());
+            const float to = hi.value_or(std::numeric_limits<float>::infinity());
+            preds.push_back([&column, from, to](std::size_t begin, std::size_t rows,
+                                                std::span<std::uint64_t> words, col::MaskOp op)
+                            { col::maskRange(std::span<const float>(column).subspan(begin, rows), from, to, words, op); });
+        }
+
+        void addMinU32(std::vector<col::Predicate> &preds, std::span<const std::uint32_t> column,
+                       const std::optional<std::uint32_t> &lo)
+        {
+            if (!lo)
+                return;
+
+            const std::uint32_t from = *lo;
+            preds.push_back([column, from](std::size_t begin, std::size_t rows,
+                                           std::span<std::uint64_t> words, col::MaskOp op)
+                            { col::maskRange(column.subspan(begin, rows),
+                                             from, std::numeric_limits<std::uint32_t>::max(), words, op); });
+        }
+    }
+
+    Selection ProductColumns::select(const ProductFilter &filter) const
+    {
+        return select(filter, views);
+    }
+
+    Selection ProductColumns::select(const ProductFilter &filter, std::span<const std::uint32_t> liveViews) const
+    {
+        if (liveViews.size() != size())
+            throw std::invalid_argument("ProductColumns::select: colonne de vues de taille différente");
+
+        std::vector<col::Predicate> preds;
+
+        // Les prédicats les plus sélectifs en premier : les suivants ne font qu'affiner le masque.
+        if (filter.categoryId)
+        {
+            const std::uint32_t id = *filter.categoryId;
+            preds.push_back([this, id](std::size_t begin, std::size_t rows,
+                                       std::span<std::uint64_t> words, col::MaskOp op)
+                            { col::maskEqual(std::span<const std::uint32_t>(category_id).subspan(begin, rows), id, words, op); });
+        }
+        if (filter.boosted)
+        {
+            const std::uint8_t flag = *filter.boosted ? 1 : 0;
+            preds.push_back([this, flag](std::size_t begin, std::size_t rows,
+                                         std::span<std::uint64_t> words, col::MaskOp op)
+                            { col::maskEqual(std::span<const std::uint8_t>(boost).subspan(begin, rows), flag, words, op); });
+        }
+
+        addFloatRange(preds, converted_price_value, filter.minPrice, filter.maxPrice);
+        addFloatRange(preds, price_with_shipping_value, filter.minShippingPrice, filter.maxShippingPrice);
+        addFloatRange(preds, average_rating, filter.minRating, filter.maxRating);
+        addMinU32(preds, liveViews, filter.minViews);
+        addMinU32(preds, review_count, filter.minReviewCount);
+        addMinU32(preds, created_at, filter.createdSince);
+
+        return col::select(size(), preds);
+    }
+}
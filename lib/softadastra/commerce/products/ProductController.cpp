@@ -1,12 +1,27 @@
 #include <softadastra/commerce/products/ProductController.hpp>
 #include <softadastra/commerce/products/ProductCache.hpp>
+#include <softadastra/commerce/products/ProductBinaryWriter.hpp>
+#include <softadastra/commerce/products/ProductCatalog.hpp>
+#include <softadastra/commerce/products/ProductExporter.hpp>
+#include <softadastra/commerce/products/ProductIngestor.hpp>
+#include <softadastra/commerce/products/ProductLiveCounters.hpp>
 #include <softadastra/commerce/products/ProductService.hpp>
+#include <softadastra/commerce/products/ProductStats.hpp>
 #include <softadastra/commerce/products/ProductRecommender.hpp>
 #include <softadastra/commerce/products/ProductValidator.hpp>
 #include <softadastra/commerce/products/ProductFactory.hpp>
 
+#include <softadastra/core/auth/JwtAuth.hpp>
+
 #include <adastra/config/env/EnvLoader.hpp>
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+#include <adastra/tools/id/SnowflakeGenerator.hpp>
+#include <adastra/tools/time/TImestampUtils.hpp>
+#include <adastra/tools/time/TimeHelper.hpp>
+#include <adastra/utils/json/ContentNegotiation.hpp>
+#include <adastra/utils/json/EncodedBodyCache.hpp>
 #include <adastra/utils/json/JsonUtils.hpp>
+#include <adastra/utils/validation/JsonSchema.hpp>
 
 #include <cstdlib>
 #include <memory>
@@ -21,6 +36,9 @@
 #include <unordered_set>
 
 #include <cstdint> // int64_t
+#include <charconv>
+#include <optional>
+#include <limits>
 
 #ifndef SA_BACKEND_ROOT
 #define SA_BACKEND_ROOT ""
@@ -34,18 +52,73 @@
 
 using namespace adastra::utils::json;
 using namespace Vix::json;
+using adastra::utils::json::Encoding;
 
 namespace softadastra::commerce::products
 {
     static std::unique_ptr<ProductCache> g_productCache;
+    static std::unique_ptr<ProductCatalog> g_catalog;
+    static std::unique_ptr<ProductIngestLog> g_ingestLog;
+    static std::unique_ptr<ProductRepository> g_productStore; // PRODUCT_DB_PATH
+    static std::unique_ptr<ProductStats> g_productStats;
+    static std::unique_ptr<ProductLiveCounters> g_liveCounters; // corps et filtre min_views des listes
+    static std::unique_ptr<ProductIngestor> g_ingestor;
+    static adastra::utils::json::EncodedBodyCache g_allBodies; // /all sans filtre, par LiveCounters::generation
     static std::once_flag init_flag;
     [[maybe_unused]] static std::once_flag dotenv_flag;
     [[maybe_unused]] constexpr int DEFAULT_LIMIT = 10;
     [[maybe_unused]] constexpr int DEFAULT_OFFSET = 0;
+    constexpr std::size_t MAX_BATCH_GET = 500;
+    constexpr std::size_t MAX_REPORTED_ERRORS = 1000;
+    constexpr std::size_t MAX_TOP = 100;
 
+    // Les compteurs du Product sont ceux du catalogue au chargement ; ceux de
+    // ProductStats, tenus à jour par /view, les remplacent (lecture directe, pour
+    // les réponses construites en DOM : top, first).
     static Json product_to_json(const Product &p)
     {
-        return p.toJson();
+        if (!g_productStats)
+            return p.toJson();
+        auto counters = g_productStats->counters(p.getId());
+        return ProductLiveCounters::overlay(p, counters) ? ProductLiveCounters::toJson(p, counters) : p.toJson();
+    }
+
+    // Schémas compilés une fois à l'enregistrement des routes, comme pour /users.
+    static adastra::utils::validation::JsonSchema make_create_schema()
+    {
+        adastra::utils::validation::JsonSchema schema;
+        schema.field("title").required().string(1, 500);
+        schema.field("content").string(0, 20000);
+        schema.field("price").number(0, 1e12, "Price");
+        return schema;
+    }
+
+    // Enregistrement de /bulk, après coerce_product_json ; ProductValidator
+    // vérifie ensuite les règles propres au produit.
+    static adastra::utils::validation::JsonSchema make_bulk_item_schema()
+    {
+        constexpr long long maxU32 = std::numeric_limits<std::uint32_t>::max();
+        adastra::utils::validation::JsonSchema schema;
+        schema.field("title").required().string(1, 500);
+        schema.field("currency").required().string(1, 16);
+        schema.field("category_id").required().integer(1, maxU32, "Category");
+        for (const char *key : {"image_url", "city_name", "country_image_url", "formatted_price",
+                                "condition_name", "brand_name", "package_format_name"})
+            schema.field(key).string(0, 2048);
+        schema.field("converted_price_value").number(0, 1e12);
+        schema.field("price_with_shipping_value").number(0, 1e12);
+        schema.field("views").integer(0, maxU32);
+        schema.field("review_count").integer(0, maxU32);
+        return schema;
+    }
+
+    // {"errors": {"<champ>": "<message>"}}, comme /users.
+    static Json schema_errors_json(const std::vector<adastra::utils::validation::FieldError> &errors)
+    {
+        Json fields = Json::object();
+        for (const auto &e : errors)
+            fields[e.field] = e.message;
+        return o("errors", fields);
     }
 
     [[maybe_unused]] inline std::string to_lower_copy(std::string s)
@@ -73,7 +146,7 @@ namespace softadastra::commerce::products
     // ----------------------------------------------------------------------
     // La fonction de coercition :
     // ----------------------------------------------------------------------
-    [[maybe_unused]] inline void coerce_product_json(Vix::json::Json &obj)
+    inline void coerce_product_json(Vix::json::Json &obj)
     {
         using Json = Vix::json::Json;
         if (!obj.is_object())
@@ -151,6 +224,147 @@ namespace softadastra::commerce::products
         }
     }
 
+    template <typename T>
+    static std::optional<T> parse_number(const std::string &s)
+    {
+        if (s.empty())
+            return std::nullopt;
+        T value{};
+        auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+        if (ec != std::errc() || ptr != s.data() + s.size())
+            return std::nullopt;
+        return value;
+    }
+
+    // ?min_price=&max_price=&min_shipping=&max_shipping=&min_rating=&max_rating=
+    // &category_id=&min_views=&min_reviews=&boosted=0|1
+    // &created_since=<epoch s | YYYY-MM-DD HH:MM:SS>
+    template <typename Req>
+    static ProductFilter parse_filter(const Req &req)
+    {
+        ProductFilter f;
+        f.minPrice = parse_number<float>(req.query_value("min_price", ""));
+        f.maxPrice = parse_number<float>(req.query_value("max_price", ""));
+        f.minShippingPrice = parse_number<float>(req.query_value("min_shipping", ""));
+        f.maxShippingPrice = parse_number<float>(req.query_value("max_shipping", ""));
+        f.minRating = parse_number<float>(req.query_value("min_rating", ""));
+        f.maxRating = parse_number<float>(req.query_value("max_rating", ""));
+        f.categoryId = parse_number<std::uint32_t>(req.query_value("category_id", ""));
+        f.minViews = parse_number<std::uint32_t>(req.query_value("min_views", ""));
+        f.minReviewCount = parse_number<std::uint32_t>(req.query_value("min_reviews", ""));
+        if (auto b = parse_number<int>(req.query_value("boosted", "")))
+            f.boosted = (*b != 0);
+
+        const std::string since = req.query_value("created_since", "");
+        std::optional<std::int64_t> epoch = parse_number<std::int64_t>(since);
+        if (!epoch)
+            epoch = adastra::tools::time::parseDateTime(since);
+        if (epoch)
+            f.createdSince = static_cast<std::uint32_t>(
+                std::clamp<std::int64_t>(*epoch, 0, std::numeric_limits<std::uint32_t>::max()));
+        return f;
+    }
+
+    // min_views porte sur les vues vivantes de `live`, celles que les corps affichent.
+    static Selection select_products(const ProductSnapshot &snap, const LiveCounters &live, const ProductFilter &filter)
+    {
+        return snap.columns.select(filter, live.views);
+    }
+
+    // Produit du slot dans une réponse binaire : DOM réécrit s'il a des compteurs vivants.
+    template <typename W>
+    static void write_product(W &w, const ProductSnapshot &snap, const LiveCounters &live, std::uint32_t slot, Encoding enc)
+    {
+        if (const auto *patched = live.find(slot))
+            w.raw(adastra::utils::json::encode(patched->dom, enc));
+        else
+            writeProduct(w, snap.products[slot]);
+    }
+
+    template <typename Req>
+    static Encoding response_encoding(const Req &req)
+    {
+        return adastra::utils::json::negotiate(req.header("Accept"));
+    }
+
+    // Corps déjà encodé (snapshot, cache) : évite de repasser par un DOM.
+    // Date : chaîne reformatée une fois par seconde et par thread.
+    template <typename Res>
+    static void send_encoded(Res &res, Encoding enc, const std::string &body)
+    {
+        res.header("Content-Type", adastra::utils::json::contentType(enc));
+        res.header("Vary", "Accept");
+        res.header("Date", std::string(adastra::tools::time::httpDateNow()));
+        res.send(body);
+    }
+
+    template <typename Res>
+    static void send_json_body(Res &res, const std::string &body)
+    {
+        send_encoded(res, Encoding::Json, body);
+    }
+
+    template <typename Res>
+    static void send_dom(Res &res, Encoding enc, const Json &value)
+    {
+        if (enc == Encoding::Json)
+            res.json(value);
+        else
+            send_encoded(res, enc, adastra::utils::json::encode(value, enc));
+    }
+
+    // Appelle fn(writer) avec l'écrivain binaire correspondant à enc (MsgPack ou CBOR).
+    template <typename Fn>
+    static std::string write_binary(Encoding enc, Fn &&fn)
+    {
+        std::string out;
+        if (enc == Encoding::MsgPack)
+        {
+            adastra::utils::json::MsgPackWriter w(out);
+            fn(w);
+        }
+        else
+        {
+            adastra::utils::json::CborWriter w(out);
+            fn(w);
+        }
+        return out;
+    }
+
+    // {"count":n,"data":[...]} pour tous les slots (rows == nullptr) ou une sélection.
+    static std::string encode_product_list(const ProductSnapshot &snap, const LiveCounters &live,
+                                           const Selection *rows, Encoding enc)
+    {
+        const std::size_t n = rows ? rows->size() : snap.products.size();
+        auto slotAt = [&](std::size_t i)
+        { return static_cast<std::uint32_t>(rows ? (*rows)[i] : i); };
+
+        if (enc != Encoding::Json)
+        {
+            return write_binary(enc, [&](auto &w)
+                                {
+                w.map(2);
+                w.string("count");
+                w.uint(n);
+                w.string("data");
+                w.array(n);
+                for (std::size_t i = 0; i < n; ++i)
+                    write_product(w, snap, live, slotAt(i), enc); });
+        }
+
+        std::string out = "{\"count\":";
+        out += std::to_string(n);
+        out += ",\"data\":[";
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (i > 0)
+                out += ',';
+            out += live.body(snap, slotAt(i));
+        }
+        out += "]}";
+        return out;
+    }
+
     static std::string resolveProductPath(std::string p)
     {
         std::filesystem::path pp(p);
@@ -323,75 +537,267 @@ namespace softadastra::commerce::products
                 []() -> std::vector<Product> { return {}; },
                 serializer,
                 deserializer
-            ); });
+            );
 
-        app.post("/api/products/create", [](auto &req, auto &res)
-                 {
-            auto body = Json::parse(req.body());
-
-            std::string title   = body.value("title", "");
-            std::string content = body.value("content", "");
-            double      price   = body.value("price", 0.0);
-
-            res.status(http::status::created).json({
-                "action", "created",
-                "status", "created",
-                "user", Vix::json::obj({
-                    "title",   title,
-                    "content", content,
-                    "price",   price
-                })
+            std::string logPath = adastra::config::env::EnvLoader::get("PRODUCT_INGEST_LOG_PATH", "");
+            logPath = logPath.empty()
+                ? std::filesystem::path(path).replace_filename("products.ingest.ndjson").string()
+                : resolveProductPath(logPath);
+
+            const std::string dbPath = adastra::config::env::EnvLoader::get("PRODUCT_DB_PATH", "");
+            if (!dbPath.empty())
+            {
+                // Catalogue en base SQLite : chaque publication n'écrit que ses lignes.
+                // Une base vide est d'abord remplie depuis le fichier JSON et le
+                // journal d'ingestion, comme le catalogue sans base les aurait chargés.
+                g_productStore = std::make_unique<ProductRepository>(makeProductBackend(resolveProductPath(dbPath)));
+                if (g_productStore->backend()->count() == 0)
+                {
+                    ProductIngestLog log(logPath);
+                    g_productStore->addAll(ProductCatalog(*g_productCache, &log).snapshot()->products);
+                }
+                g_catalog = std::make_unique<ProductCatalog>(*g_productStore);
+            }
+            else
+            {
+                g_ingestLog = std::make_unique<ProductIngestLog>(logPath);
+                g_catalog = std::make_unique<ProductCatalog>(*g_productCache, g_ingestLog.get());
+            }
+            g_ingestor = std::make_unique<ProductIngestor>(
+                *g_catalog,
+                adastra::tools::id::SnowflakeGenerator::shared(),
+                [schema = make_bulk_item_schema()](Json &item) {
+                    coerce_product_json(item);
+                    const auto errors = schema.validate(item);
+                    if (!errors.empty()) {
+                        std::string message;
+                        for (const auto &e : errors)
+                            message += (message.empty() ? "" : "; ") + e.field + ": " + e.message;
+                        throw std::invalid_argument(message);
+                    }
+                    // Nombres acceptés en chaîne par le schéma : ProductFactory lit des nombres.
+                    for (const char *key : {"converted_price_value", "price_with_shipping_value"}) {
+                        double value = 0;
+                        if (auto it = item.find(key); it != item.end() && it->is_string() &&
+                                                      adastra::utils::validation::numberValue(*it, value))
+                            *it = value;
+                    }
+                }
+            );
+
+            std::string statsDir = adastra::config::env::EnvLoader::get("PRODUCT_STATS_DIR", "");
+            statsDir = statsDir.empty()
+                ? std::filesystem::path(path).replace_filename("products.stats").string()
+                : resolveProductPath(statsDir);
+            g_productStats = std::make_unique<ProductStats>(statsDir);
+            // Retard maximal des listes sur /view (0 : vue reconstruite à chaque écriture).
+            g_liveCounters = std::make_unique<ProductLiveCounters>(
+                *g_productStats,
+                std::chrono::milliseconds(std::max(0, adastra::config::env::EnvLoader::getInt("PRODUCT_STATS_REFRESH_MS", 1000))));
+
+            // Premier snapshot (lecture du cache + colonnes + corps JSON) construit en
+            // tâche de fond : la première requête n'en paie plus le coût. Les compteurs
+            // des produits encore inconnus des statistiques sont repris du catalogue.
+            adastra::core::concurrency::TaskScheduler::shared().post([] {
+                auto snap = g_catalog->snapshot();
+                try {
+                    g_productStats->seed(snap->products);
+                } catch (const std::exception &e) {
+                    std::cerr << "[ProductController] ⚠️ statistiques : " << e.what() << "\n";
+                }
             }); });
 
-        app.get("/api/products/status", [](auto &, auto &res)
+        app.post("/api/products/create", softadastra::core::auth::requireAuth([schema = make_create_schema()](auto &req, auto &res, const auto &)
+                 {
+            Json body;
+            try {
+                body = Json::parse(req.body());
+            } catch (...) {
+                res.status(http::status::bad_request).json(o("error", "Invalid JSON"));
+                return;
+            }
+
+            const auto errors = schema.validate(body);
+            if (!errors.empty()) {
+                res.status(http::status::bad_request).json(schema_errors_json(errors));
+                return;
+            }
+
+            try {
+                // Champs validés : présents avec le bon type, ou absents / null.
+                const auto text = [&](const char *key) {
+                    const auto it = body.find(key);
+                    return it != body.end() && it->is_string() ? it->get<std::string>() : std::string{};
+                };
+                const std::string title = text("title");
+                const std::string content = text("content");
+                double price = 0.0;
+                if (const auto it = body.find("price"); it != body.end() && !it->is_null())
+                    adastra::utils::validation::numberValue(*it, price);
+
+                res.status(http::status::created).json({
+                    "action", "created",
+                    "status", "created",
+                    "user", Vix::json::obj({
+                        "title",   title,
+                        "content", content,
+                        "price",   price
+                    })
+                });
+            } catch (const nlohmann::json::exception &e) {
+                res.status(http::status::bad_request).json(o("error", e.what()));
+            } }));
+
+        // Import en masse : corps NDJSON ou tableau JSON. Les erreurs sont rapportées
+        // par enregistrement, les enregistrements valides sont acceptés quand même.
+        app.post("/api/products/bulk", softadastra::core::auth::requireAuth([](auto &req, auto &res, const auto &)
+                 {
+            IngestReport report;
+            try {
+                report = g_ingestor->ingest(req.body());
+            } catch (const std::invalid_argument& e) {
+                res.status(http::status::bad_request).json(o("error", e.what()));
+                return;
+            }
+
+            Json errors = Json::array();
+            const std::size_t shown = std::min(report.errors.size(), MAX_REPORTED_ERRORS);
+            for (std::size_t i = 0; i < shown; ++i)
+                errors.push_back(o("index", report.errors[i].index, "error", report.errors[i].message));
+
+            Json ids = Json::array();
+            for (const auto id : report.ids)
+                ids.push_back(std::to_string(id));
+
+            Json out = o(
+                "received", report.received,
+                "accepted", report.accepted,
+                "rejected", report.errors.size(),
+                "batches", report.batches,
+                "ids", ids,
+                "errors", errors,
+                "errors_truncated", report.errors.size() > shown
+            );
+
+            if (!report.persistError.empty()) {
+                out["persist_error"] = report.persistError;
+                res.status(http::status::internal_server_error).json(out);
+                return;
+            }
+            res.json(out); }));
+
+        app.get("/api/products/status", [](auto &req, auto &res)
                 {
     try {
-        const auto& items = g_productCache->getAll();
-        res.json(Vix::json::o(
+        auto snap = g_catalog->snapshot();
+        send_dom(res, response_encoding(req), Vix::json::o(
             "path",  adastra::config::env::EnvLoader::get("PRODUCT_JSON_PATH", ""),
-            "count", items.size()
+            "count", snap->products.size(),
+            "version", snap->version,
+            "scan_isa", adastra::core::columnar::activeIsa(),
+            "server_time", std::string(adastra::tools::time::iso8601Now())
         ));
     } catch (const std::exception& e) {
         res.status(http::status::internal_server_error)
            .json(Vix::json::o("error", e.what()));
     } });
 
-        app.get("/api/products/all", [](auto &, auto &res)
+        // Compteur de vues : écrit dans ProductStats, le catalogue n'est pas réécrit.
+        app.post("/api/products/{id}/view", [](auto &req, auto &res)
+                 {
+            const auto id = parse_number<std::uint64_t>(req.param("id", ""));
+            if (!id || *id == 0 || g_catalog->snapshot()->slotOf(*id) == ProductSnapshot::npos) {
+                res.status(http::status::not_found).json(o("error", "Product not found"));
+                return;
+            }
+            try {
+                res.json(o("id", std::to_string(*id), "views", g_productStats->add(*id, ProductCounter::Views)));
+            } catch (const std::exception &e) {
+                res.status(http::status::internal_server_error).json(o("error", e.what()));
+            } });
+
+        // ?counter=views|likes_count|orders_count|review_count|unique_buyers_count&limit=N
+        app.get("/api/products/top", [](auto &req, auto &res)
+                {
+            const std::string name = req.query_value("counter", "views");
+            std::optional<ProductCounter> counter;
+            for (std::size_t i = 0; i < kProductCounters; ++i)
+                if (name == counterName(static_cast<ProductCounter>(i)))
+                    counter = static_cast<ProductCounter>(i);
+            if (!counter) {
+                res.status(http::status::bad_request).json(o("error", "Unknown counter", "counter", name));
+                return;
+            }
+            const std::size_t limit = std::clamp<std::size_t>(
+                parse_number<std::size_t>(req.query_value("limit", "")).value_or(DEFAULT_LIMIT), 1, MAX_TOP);
+
+            auto snap = g_catalog->snapshot();
+            Json items = Json::array();
+            // Des produits retirés du catalogue peuvent encore avoir des compteurs.
+            for (const auto &[id, value] : g_productStats->top(*counter, limit + MAX_TOP)) {
+                const auto slot = snap->slotOf(id);
+                if (slot == ProductSnapshot::npos)
+                    continue;
+                Json item = product_to_json(snap->products[slot]);
+                item[name] = value;
+                items.push_back(std::move(item));
+                if (items.size() == limit)
+                    break;
+            }
+            send_dom(res, response_encoding(req), o("counter", name, "data", items)); });
+
+        app.get("/api/products/all", [](auto &req, auto &res)
                 {
             try {
-                const auto& items = g_productCache->getAll();
-                Json arr = Json::array();
+                auto snap = g_catalog->snapshot();
+                const auto live = g_liveCounters->view(snap);
+                const ProductFilter filter = parse_filter(req);
+                const Encoding enc = response_encoding(req);
+                const bool newest = req.query_value("sort", "") == "newest";
 
-                for(const auto& p: items)
-                    arr.push_back(product_to_json(p));
+                if (filter.empty() && newest) {
+                    send_encoded(res, enc, encode_product_list(*snap, *live, &snap->newest, enc));
+                    return;
+                }
 
-                res.json(o(
-                    "count", items.size(),
-                    "data", arr
-                ));
+                if (filter.empty()) {
+                    auto body = g_allBodies.get(live->generation, enc, [&](Encoding e)
+                                                { return encode_product_list(*snap, *live, nullptr, e); });
+                    send_encoded(res, enc, *body);
+                    return;
+                }
+
+                Selection rows = select_products(*snap, *live, filter);
+                if (newest) {
+                    const auto &created = snap->columns.created_at;
+                    std::stable_sort(rows.begin(), rows.end(), [&](std::uint32_t a, std::uint32_t b)
+                                     { return created[a] > created[b]; });
+                }
+                send_encoded(res, enc, encode_product_list(*snap, *live, &rows, enc));
             } catch (const std::exception& e) {
                 res.json(o("error", std::string("Invalid cache JSON: ") + e.what()));
             } });
 
-        app.get("/api/products/first", [](auto &, auto &res)
+        app.get("/api/products/first", [](auto &req, auto &res)
                 {
-        const auto& items = g_productCache->getAll();
-        if (items.empty()) {
-            res.json(Vix::json::o("empty", true));
+        auto snap = g_catalog->snapshot();
+        const Encoding enc = response_encoding(req);
+        if (snap->products.empty()) {
+            send_dom(res, enc, Vix::json::o("empty", true));
             return;
         }
-        res.json(Vix::json::o("sample", product_to_json(items.front()))); });
+        send_dom(res, enc, Vix::json::o("sample", product_to_json(snap->products.front()))); });
 
-        app.post("/api/products/reload", [](auto &, auto &res)
+        app.post("/api/products/reload", softadastra::core::auth::requireAuth([](auto &, auto &res, const auto &)
                  {
         try {
             g_productCache->reload(); // force loadFromFile()
-            const auto& items = g_productCache->getAll();
-            res.json(Vix::json::o("reloaded", true, "count", items.size()));
+            auto snap = g_catalog->refresh();
+            res.json(Vix::json::o("reloaded", true, "count", snap->products.size()));
         } catch (const std::exception& e) {
             res.status(http::status::internal_server_error)
             .json(Vix::json::o("error", e.what()));
-        } });
+        } }));
 
         app.get("/api/products/raw", [path](auto &, auto &res)
                 {
@@ -404,6 +810,229 @@ namespace softadastra::commerce::products
         res.status(http::status::internal_server_error)
            .json(Vix::json::o("error", e.what(), "path", path));
     } });
+
+        // Export NDJSON paginé : ?cursor=&category_id=&updated_since=<epoch ms>&page_bytes=
+        // Les en-têtes X-Next-Cursor / X-Export-Done indiquent la page suivante ;
+        // 410 si le catalogue a été rechargé depuis (l'export reprend au début).
+        app.get("/api/products/export", [](auto &req, auto &res)
+                {
+            ExportOptions options;
+            const std::string cursor = req.query_value("cursor", "");
+            const std::string category = req.query_value("category_id", "");
+            const std::string since = req.query_value("updated_since", "");
+            const std::string pageBytes = req.query_value("page_bytes", "");
+
+            const auto c = ExportCursor::parse(cursor);
+            const auto cat = parse_number<std::uint32_t>(category);
+            const auto ts = parse_number<std::int64_t>(since);
+            const auto pb = parse_number<std::size_t>(pageBytes);
+            if ((!cursor.empty() && !c) || (!category.empty() && !cat) ||
+                (!since.empty() && !ts) || (!pageBytes.empty() && !pb)) {
+                res.status(http::status::bad_request).json(o("error", "Invalid export parameters"));
+                return;
+            }
+
+            options.cursor = c;
+            options.categoryId = cat;
+            options.updatedSinceMs = ts;
+            if (pb) options.maxBytes = *pb;
+
+            auto snap = g_catalog->snapshot();
+            ExportPage page = ProductExporter::page(*snap, options);
+            if (page.expired) {
+                res.status(http::status::gone).json(o(
+                    "error", "Export cursor expired: the catalog was reloaded, restart the export"));
+                return;
+            }
+
+            res.header("Content-Type", "application/x-ndjson");
+            res.header("X-Export-Records", std::to_string(page.records));
+            res.header("X-Next-Cursor", page.nextCursor.str());
+            res.header("X-Export-Done", page.done ? "true" : "false");
+            res.send(page.body); });
+
+        // Delta depuis une version : 410 si elle n'est plus dans l'anneau (resynchronisation complète).
+        app.get("/api/products/changes", [](auto &req, auto &res)
+                {
+            const auto since = parse_number<std::uint64_t>(req.query_value("since", ""));
+            if (!since) {
+                res.status(http::status::bad_request).json(o("error", "Missing or invalid 'since' version"));
+                return;
+            }
+
+            auto snap = g_catalog->snapshot();
+            const ProductDelta delta = g_catalog->changes().since(*since, snap->version);
+            if (delta.expired) {
+                res.status(http::status::gone).json(o(
+                    "error", "Version expired, full resync required",
+                    "version", snap->version,
+                    "resync", "/api/products/export"
+                ));
+                return;
+            }
+
+            std::vector<std::uint32_t> slots;
+            slots.reserve(delta.upserts.size());
+            for (auto id : delta.upserts) {
+                const auto slot = snap->slotOf(id);
+                if (slot != ProductSnapshot::npos)
+                    slots.push_back(slot);
+            }
+
+            const Encoding enc = response_encoding(req);
+            if (enc != Encoding::Json) {
+                send_encoded(res, enc, write_binary(enc, [&](auto &w) {
+                    w.map(4);
+                    w.string("version");
+                    w.uint(delta.version);
+                    w.string("since");
+                    w.uint(*since);
+                    w.string("upserts");
+                    w.array(slots.size());
+                    for (auto slot : slots)
+                        writeProduct(w, snap->products[slot]);
+                    w.string("deletes");
+                    w.array(delta.deletes.size());
+                    for (auto id : delta.deletes)
+                        w.string(std::to_string(id));
+                }));
+                return;
+            }
+
+            std::string out = "{\"version\":";
+            out += std::to_string(delta.version);
+            out += ",\"since\":";
+            out += std::to_string(*since);
+            out += ",\"upserts\":[";
+            for (std::size_t i = 0; i < slots.size(); ++i) {
+                if (i > 0)
+                    out += ',';
+                out += snap->bodies[slots[i]];
+            }
+            out += "],\"deletes\":[";
+            for (std::size_t i = 0; i < delta.deletes.size(); ++i) {
+                if (i > 0)
+                    out += ',';
+                out += '"';
+                out += std::to_string(delta.deletes[i]);
+                out += '"';
+            }
+            out += "]}";
+
+            send_json_body(res, out); });
+
+        // body : {"ids":["1","2",3]} ou ["1","2",3] (ids en chaîne, comme dans les réponses, ou en nombre)
+        app.post("/api/products/batch-get", [](auto &req, auto &res)
+                 {
+            Json body;
+            try {
+                body = Json::parse(req.body());
+            } catch (...) {
+                res.status(http::status::bad_request).json(o("error", "Invalid JSON"));
+                return;
+            }
+
+            const Json* ids = nullptr;
+            if (body.is_array())
+                ids = &body;
+            else if (body.is_object() && body.contains("ids") && body["ids"].is_array())
+                ids = &body["ids"];
+
+            if (!ids) {
+                res.status(http::status::bad_request).json(o("error", "Expected {\"ids\":[...]}"));
+                return;
+            }
+            if (ids->size() > MAX_BATCH_GET) {
+                res.status(http::status::payload_too_large)
+                   .json(o("error", "Too many ids", "max", MAX_BATCH_GET));
+                return;
+            }
+
+            auto snap = g_catalog->snapshot();
+            const auto live = g_liveCounters->view(snap);
+            Json missing = Json::array();
+            std::vector<std::uint32_t> slots;
+            slots.reserve(ids->size());
+
+            for (const auto& v : *ids) {
+                std::uint32_t slot = ProductSnapshot::npos;
+                if (v.is_number_unsigned() || (v.is_number_integer() && v.get<long long>() > 0))
+                    slot = snap->slotOf(v.get<std::uint64_t>());
+                else if (v.is_string())
+                    if (const auto id = parse_number<std::uint64_t>(v.get_ref<const std::string &>()))
+                        slot = snap->slotOf(*id);
+
+                if (slot == ProductSnapshot::npos)
+                    missing.push_back(v);
+                else
+                    slots.push_back(slot);
+            }
+
+            const Encoding enc = response_encoding(req);
+            if (enc != Encoding::Json) {
+                send_encoded(res, enc, write_binary(enc, [&](auto &w) {
+                    w.map(3);
+                    w.string("data");
+                    w.array(slots.size());
+                    for (auto slot : slots)
+                        write_product(w, *snap, *live, slot, enc);
+                    w.string("count");
+                    w.uint(slots.size());
+                    w.string("missing");
+                    w.raw(adastra::utils::json::encode(missing, enc));
+                }));
+                return;
+            }
+
+            std::string out = "{\"data\":[";
+            for (std::size_t i = 0; i < slots.size(); ++i) {
+                if (i > 0)
+                    out += ',';
+                out += live->body(*snap, slots[i]);
+            }
+            out += "],\"count\":";
+            out += std::to_string(slots.size());
+            out += ",\"missing\":";
+            out += missing.dump();
+            out += '}';
+
+            send_json_body(res, out); });
+
+        // Déclarée en dernier : les routes statiques /api/products/<nom> restent prioritaires.
+        app.get("/api/products/{id}", [](auto &req, auto &res)
+                {
+            const auto id = parse_number<std::uint64_t>(req.param("id", ""));
+            if (!id || *id == 0) {
+                res.status(http::status::bad_request).json(o("error", "Invalid product id"));
+                return;
+            }
+
+            auto snap = g_catalog->snapshot();
+            const auto slot = snap->slotOf(*id);
+            if (slot == ProductSnapshot::npos) {
+                res.status(http::status::not_found).json(o("error", "Product not found", "id", std::to_string(*id)));
+                return;
+            }
+
+            const Encoding enc = response_encoding(req);
+            // Corps avec les compteurs vivants, réécrit une fois par LiveCounters.
+            const auto live = g_liveCounters->view(snap);
+            if (enc != Encoding::Json) {
+                send_encoded(res, enc, write_binary(enc, [&](auto &w) {
+                    w.map(1);
+                    w.string("data");
+                    write_product(w, *snap, *live, slot, enc);
+                }));
+                return;
+            }
+
+            const std::string& product = live->body(*snap, slot);
+            std::string out;
+            out.reserve(product.size() + 9);
+            out += "{\"data\":";
+            out += product;
+            out += '}';
+            send_json_body(res, out); });
     }
 
 }
@@ -0,0 +1,65 @@
+#include <softadastra/commerce/products/ProductExporter.hpp>
+
+#include <algorithm>
+#include <charconv>
+
+namespace softadastra::commerce::products
+{
+    std::string ExportCursor::str() const
+    {
+        return std::to_string(layout) + "." + std::to_string(slot);
+    }
+
+    std::optional<ExportCursor> ExportCursor::parse(std::string_view text)
+    {
+        const auto dot = text.find('.');
+        if (dot == std::string_view::npos)
+            return std::nullopt;
+
+        ExportCursor c;
+        const char *end = text.data() + text.size();
+        auto [p1, e1] = std::from_chars(text.data(), text.data() + dot, c.layout);
+        auto [p2, e2] = std::from_chars(text.data() + dot + 1, end, c.slot);
+        if (e1 != std::errc() || p1 != text.data() + dot || e2 != std::errc() || p2 != end)
+            return std::nullopt;
+        return c;
+    }
+
+    ExportPage ProductExporter::page(const ProductSnapshot &snap, const ExportOptions &options)
+    {
+        const std::size_t budget = std::clamp(options.maxBytes, MIN_PAGE_BYTES, MAX_PAGE_BYTES);
+        const std::size_t n = snap.products.size();
+        const auto &categories = snap.columns.category_id;
+
+        ExportPage out;
+        out.nextCursor.layout = snap.layout;
+        if (options.cursor && options.cursor->layout != snap.layout)
+        {
+            out.expired = true;
+            return out;
+        }
+        out.body.reserve(budget);
+
+        std::size_t slot = options.cursor ? std::min(options.cursor->slot, n) : 0;
+        for (; slot < n; ++slot)
+        {
+            if (options.categoryId && categories[slot] != *options.categoryId)
+                continue;
+            if (options.updatedSinceMs && snap.updatedAtMs[slot] < *options.updatedSinceMs)
+                continue;
+
+            const std::string &line = snap.bodies[slot];
+            // Page pleine : on s'arrête avant la ligne qui dépasserait le budget.
+            if (out.records > 0 && out.body.size() + line.size() + 1 > budget)
+                break;
+
+            out.body += line;
+            out.body += '\n';
+            ++out.records;
+        }
+
+        out.nextCursor.slot = slot;
+        out.done = slot >= n;
+        return out;
+    }
+}
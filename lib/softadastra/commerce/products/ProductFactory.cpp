@@ -1,6 +1,7 @@
 #include <softadastra/commerce/products/ProductFactory.hpp>
 #include <softadastra/commerce/products/ProductBuilder.hpp>
 #include <softadastra/commerce/products/ProductValidator.hpp>
+#include <adastra/tools/time/TImestampUtils.hpp>
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -55,6 +56,52 @@ namespace
         return def;
     }
 
+    // Ids produits : 64 bits (Snowflake), acceptés en nombre ou en chaîne.
+    inline std::uint64_t json_u64(const nlohmann::json &j, const char *key, std::uint64_t def = 0)
+    {
+        try
+        {
+            if (!j.contains(key))
+                return def;
+
+            const auto &v = j.at(key);
+            if (v.is_number_unsigned())
+                return v.get<std::uint64_t>();
+            if (v.is_number_integer())
+            {
+                long long s = v.get<long long>();
+                return s <= 0 ? 0u : static_cast<std::uint64_t>(s);
+            }
+            if (v.is_string())
+            {
+                const auto s = v.get<std::string>();
+                std::size_t pos = 0;
+                unsigned long long u = std::stoull(s, &pos);
+                if (pos != s.size())
+                    return def;
+                return u;
+            }
+        }
+        catch (...)
+        {
+        }
+        return def;
+    }
+
+    // created_at : "YYYY-MM-DD HH:MM:SS" (UTC) ou secondes epoch, converti une
+    // fois au chargement ; 0 si absent ou illisible.
+    inline std::int64_t json_epoch(const nlohmann::json &j, const char *key)
+    {
+        auto it = j.find(key);
+        if (it == j.end())
+            return 0;
+        if (it->is_string())
+            return adastra::tools::time::parseDateTime(it->get_ref<const std::string &>()).value_or(0);
+        if (it->is_number_integer())
+            return it->get<std::int64_t>();
+        return 0;
+    }
+
     static std::string as_string_flexible(const nlohmann::json &j, const char *key)
     {
         if (!j.contains(key))
@@ -176,7 +223,8 @@ namespace softadastra::commerce::products
                 colors.erase(colors.begin());
 
             ProductBuilder builder;
-            builder.setTitle(data.value("title", ""))
+            builder.setId(json_u64(data, "id"))
+                .setTitle(data.value("title", ""))
                 .setImageUrl(data.value("image_url", ""))
                 .setCityName(data.value("city_name", ""))
                 .setCountryImageUrl(data.value("country_image_url", ""))
@@ -192,6 +240,7 @@ namespace softadastra::commerce::products
                 .setCategoryId(json_u32(data, "category_id"))
                 .setViews(json_u32(data, "views"))
                 .setReviewCount(json_u32(data, "review_count"))
+                .setCreatedAt(json_epoch(data, "created_at"))
                 .setBoost(data.value("boost", false))
                 .setConvertedPriceValue(data.value("converted_price_value", 0.0f))
                 .setOriginalPrice(as_string_flexible(data, "original_price"))
@@ -228,7 +277,7 @@ namespace softadastra::commerce::products
         try
         {
             ProductBuilder builder;
-            builder.setId(json_u32(data, "id"))
+            builder.setId(json_u64(data, "id"))
                 .setTitle(data.value("title", ""))
                 .setImageUrl(data.value("image_url", ""))
                 .setCityName(data.value("city_name", ""))
@@ -245,6 +294,7 @@ namespace softadastra::commerce::products
                 .setCategoryId(json_u32(data, "category_id"))
                 .setViews(json_u32(data, "views"))
                 .setReviewCount(json_u32(data, "review_count"))
+                .setCreatedAt(json_epoch(data, "created_at"))
                 .setBoost(data.value("boost", false))
                 .setConvertedPriceValue(data.value("converted_price_value", 0.0f))
                 .setOriginalPrice(as_string_flexible(data, "original_price"))
@@ -0,0 +1,92 @@
+#include <softadastra/commerce/products/ProductIngestLog.hpp>
+#include <softadastra/commerce/products/ProductFactory.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace softadastra::commerce::products
+{
+    ProductIngestLog::ProductIngestLog(std::string path)
+        : path_(std::move(path)) {}
+
+    void ProductIngestLog::append(const std::vector<Product> &batch)
+    {
+        if (batch.empty())
+            return;
+
+        std::string buffer;
+        for (const auto &p : batch)
+        {
+            buffer += p.toJson().dump();
+            buffer += '\n';
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::FILE *f = std::fopen(path_.c_str(), "ab");
+        if (!f)
+            throw std::runtime_error("Impossible d'ouvrir le journal d'ingestion : " + path_);
+
+#ifndef _WIN32
+        // Sans tampon : après un échec, fclose() n'a plus rien à écrire derrière la troncature.
+        std::setvbuf(f, nullptr, _IONBF, 0);
+        struct stat st{};
+        const bool sized = ::fstat(fileno(f), &st) == 0;
+#endif
+        const bool written = std::fwrite(buffer.data(), 1, buffer.size(), f) == buffer.size() &&
+                             std::fflush(f) == 0;
+#ifndef _WIN32
+        const bool synced = written && ::fsync(fileno(f)) == 0;
+        // Lot refusé : ses lignes déjà écrites ne doivent pas être rejouées au redémarrage.
+        if (!synced && (!sized || ::ftruncate(fileno(f), st.st_size) != 0))
+            std::cerr << "[ProductIngestLog] ⚠️ impossible de tronquer " << path_ << " après un échec d'écriture\n";
+#else
+        const bool synced = written;
+#endif
+        std::fclose(f);
+
+        if (!synced)
+            throw std::runtime_error("Échec d'écriture du journal d'ingestion : " + path_);
+    }
+
+    std::vector<Product> ProductIngestLog::replay() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<Product> out;
+        if (!std::filesystem::exists(path_))
+            return out;
+
+        std::ifstream in(path_);
+        std::string line;
+        std::size_t bad = 0;
+        while (std::getline(in, line))
+        {
+            if (line.empty())
+                continue;
+            try
+            {
+                auto p = ProductFactory::createFromInternalJson(nlohmann::json::parse(line));
+                if (p)
+                    out.push_back(std::move(*p));
+                else
+                    ++bad;
+            }
+            catch (const std::exception &)
+            {
+                ++bad;
+            }
+        }
+
+        std::cerr << "[ProductIngestLog] Rejoué ok=" << out.size() << " bad=" << bad << " depuis " << path_ << "\n";
+        return out;
+    }
+}
@@ -0,0 +1,132 @@
+#include <softadastra/commerce/products/ProductIngestor.hpp>
+#include <softadastra/commerce/products/ProductFactory.hpp>
+#include <softadastra/commerce/products/ProductValidator.hpp>
+
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+#include <adastra/utils/json/JsonRecordSplitter.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        // En dessous, la répartition sur le pool coûte plus qu'elle ne rapporte.
+        constexpr std::size_t kParallelThreshold = 256;
+        constexpr std::size_t kParseGrain = 64;
+
+        struct Parsed
+        {
+            std::optional<Product> product;
+            std::string error;
+        };
+
+        void parseRange(const std::vector<std::string_view> &records, std::vector<Parsed> &out,
+                        std::size_t begin, std::size_t end, const ProductIngestor::Normalizer &normalize)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                try
+                {
+                    auto item = nlohmann::json::parse(records[i].begin(), records[i].end());
+                    if (!item.is_object())
+                        throw std::runtime_error("record is not a JSON object");
+                    if (normalize)
+                        normalize(item);
+
+                    ProductValidator::validate(item, "createFromJson");
+                    auto product = ProductFactory::createFromJson(item);
+                    if (!product)
+                        throw std::runtime_error("invalid product");
+                    out[i].product = std::move(*product);
+                }
+                catch (const std::exception &e)
+                {
+                    out[i].error = e.what();
+                }
+            }
+        }
+    }
+
+    ProductIngestor::ProductIngestor(ProductCatalog &catalog,
+                                     adastra::tools::id::SnowflakeGenerator &ids,
+                                     Normalizer normalize,
+                                     std::size_t batchSize)
+        : catalog_(catalog),
+          ids_(ids),
+          normalize_(std::move(normalize)),
+          batchSize_(std::max<std::size_t>(1, batchSize)) {}
+
+    IngestReport ProductIngestor::ingest(std::string_view body)
+    {
+        std::vector<std::string_view> records;
+        std::string splitError;
+        if (!adastra::utils::json::splitJsonRecords(body, records, splitError))
+            throw std::invalid_argument("Malformed body: " + splitError);
+
+        IngestReport report;
+        report.received = records.size();
+        if (records.empty())
+            return report;
+
+        // 1) Parsing + validation en parallèle : chaque tâche écrit ses propres cases.
+        std::vector<Parsed> parsed(records.size());
+        if (records.size() < kParallelThreshold)
+        {
+            parseRange(records, parsed, 0, records.size(), normalize_);
+        }
+        else
+        {
+            adastra::core::concurrency::TaskScheduler::shared().parallelFor(
+                0, records.size(), [&](std::size_t begin, std::size_t end)
+                { parseRange(records, parsed, begin, end, normalize_); },
+                {kParseGrain});
+        }
+
+        // 2) Ids, puis persistance par lots et un seul snapshot pour toute la requête.
+        std::vector<Product> accepted;
+        std::vector<std::size_t> acceptedIndexes;
+        accepted.reserve(records.size());
+
+        for (std::size_t i = 0; i < parsed.size(); ++i)
+        {
+            if (!parsed[i].product)
+            {
+                report.errors.push_back({i, std::move(parsed[i].error)});
+                continue;
+            }
+
+            Product &p = *parsed[i].product;
+            p.setId(ids_.nextLocal());
+            // Date de création absente du JSON : celle encodée dans l'id.
+            if (p.getCreatedAt() == 0)
+                p.setCreatedAt(static_cast<std::int64_t>(
+                    adastra::tools::id::SnowflakeGenerator::timestampMs(p.getId()) / 1000));
+            report.ids.push_back(p.getId());
+            accepted.push_back(std::move(p));
+            acceptedIndexes.push_back(i);
+        }
+
+        if (!accepted.empty())
+        {
+            const PublishReport published = catalog_.publishBatches(std::move(accepted), batchSize_);
+            report.accepted = published.persisted;
+            report.batches = published.batches;
+            report.ids.resize(published.persisted);
+            report.persistError = published.error;
+
+            // Le lot en échec n'est pas écrit, les suivants ne sont pas tentés.
+            for (std::size_t k = published.persisted; k < acceptedIndexes.size(); ++k)
+                report.errors.push_back({acceptedIndexes[k], k < published.persisted + batchSize_
+                                                                 ? "not persisted: " + published.error
+                                                                 : "skipped: a previous batch was not persisted"});
+        }
+
+        std::sort(report.errors.begin(), report.errors.end(),
+                  [](const IngestError &a, const IngestError &b)
+                  { return a.index < b.index; });
+        return report;
+    }
+}
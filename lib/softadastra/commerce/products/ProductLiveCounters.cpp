@@ -0,0 +1,123 @@
+#include <softadastra/commerce/products/ProductLiveCounters.hpp>
+
+#include <algorithm>
+
+namespace softadastra::commerce::products
+{
+    ProductLiveCounters::ProductLiveCounters(const ProductStats &stats, std::chrono::milliseconds maxAge)
+        : stats_(stats), maxAge_(std::max(maxAge, std::chrono::milliseconds{0})) {}
+
+    bool ProductLiveCounters::overlay(const Product &p, ProductStats::Counters &counters)
+    {
+        // Avant seed(), un slot ne compte que les mises à jour depuis le démarrage.
+        auto &views = counters[static_cast<std::size_t>(ProductCounter::Views)];
+        auto &reviews = counters[static_cast<std::size_t>(ProductCounter::Reviews)];
+        views = std::max<std::uint32_t>(views, p.getViews());
+        reviews = std::max<std::uint32_t>(reviews, p.getReviewCount());
+
+        for (std::size_t i = 0; i < kProductCounters; ++i)
+        {
+            const auto counter = static_cast<ProductCounter>(i);
+            if (counter != ProductCounter::Views && counter != ProductCounter::Reviews && counters[i] > 0)
+                return true;
+        }
+        return views != p.getViews() || reviews != p.getReviewCount();
+    }
+
+    nlohmann::json ProductLiveCounters::toJson(const Product &p, const ProductStats::Counters &counters)
+    {
+        nlohmann::json j = p.toJson();
+        for (std::size_t i = 0; i < kProductCounters; ++i)
+            if (counters[i] > 0)
+                j[counterName(static_cast<ProductCounter>(i))] = counters[i];
+        return j;
+    }
+
+    bool ProductLiveCounters::fresh(const LiveCounters &view, const ProductSnapshot &snap) const
+    {
+        if (view.version != snap.version)
+            return false;
+        return view.epoch == stats_.epoch() || std::chrono::steady_clock::now() - view.builtAt < maxAge_;
+    }
+
+    LiveCountersPtr ProductLiveCounters::view(const ProductSnapshotPtr &snap)
+    {
+        LiveCountersPtr current;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            current = current_;
+        }
+        if (current && fresh(*current, *snap))
+            return current;
+
+        // Même snapshot : pendant qu'un autre thread reconstruit, la vue précédente suffit.
+        std::unique_lock<std::mutex> building(buildMutex_, std::defer_lock);
+        if (current && current->version == snap->version)
+        {
+            if (!building.try_lock())
+                return current;
+        }
+        else
+        {
+            building.lock();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            current = current_;
+        }
+        if (current && fresh(*current, *snap))
+            return current;
+
+        auto next = build(*snap, current && current->version == snap->version ? current.get() : nullptr);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Requête commencée avant une publication : sa vue n'est pas installée.
+        if (!current_ || current_->version <= next->version)
+            current_ = next;
+        return next;
+    }
+
+    LiveCountersPtr ProductLiveCounters::build(const ProductSnapshot &snap, const LiveCounters *previous)
+    {
+        auto next = std::make_shared<LiveCounters>();
+        next->version = snap.version;
+        // Lu avant les compteurs : une écriture concurrente rendra cette vue périmée.
+        next->epoch = stats_.epoch();
+        next->builtAt = std::chrono::steady_clock::now();
+        next->views = snap.columns.views;
+
+        for (auto &[id, counters] : stats_.all())
+        {
+            const auto slot = snap.slotOf(id);
+            if (slot == ProductSnapshot::npos)
+                continue;
+            const Product &p = snap.products[slot];
+            if (!overlay(p, counters))
+                continue;
+
+            next->views[slot] = counters[static_cast<std::size_t>(ProductCounter::Views)];
+
+            // Compteurs inchangés depuis la vue précédente : corps repris tel quel.
+            if (previous)
+            {
+                const auto old = previous->patched.find(slot);
+                if (old != previous->patched.end() && old->second->counters == counters)
+                {
+                    next->patched.emplace(slot, old->second);
+                    continue;
+                }
+            }
+
+            auto patch = std::make_shared<LiveCounters::Patched>();
+            patch->counters = counters;
+            patch->dom = toJson(p, counters);
+            patch->body = patch->dom.dump();
+            next->patched.emplace(slot, std::move(patch));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        next->generation = ++generation_;
+        return next;
+    }
+}
@@ -0,0 +1,24 @@
+#include <softadastra/commerce/products/ProductRepository.hpp>
+#include <adastra/storage/database/LocalDBBackend.hpp>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        bool endsWith(const std::string &s, const std::string &suffix)
+        {
+            return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+        }
+    }
+
+    std::shared_ptr<adastra::core::repository::RepositoryBackend> makeProductBackend(const std::string &path)
+    {
+        using namespace adastra::storage::database;
+
+        if (endsWith(path, ".db") || endsWith(path, ".sqlite") || endsWith(path, ".sqlite3"))
+            return std::make_shared<LocalDBBackend>(std::make_shared<LocalDB>(path), "products",
+                                                    std::vector<std::string>{"category_id", "city_name", "brand_id"});
+
+        return std::make_shared<adastra::core::repository::JsonFileBackend>(path, "data");
+    }
+}
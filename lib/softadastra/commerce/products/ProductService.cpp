@@ -3,13 +3,23 @@
 namespace softadastra::commerce::products
 {
     ProductService::ProductService(const std::string &path)
-        : repo(path, "data") {}
+        : repo(makeProductBackend(path)) {}
 
     std::vector<Product> ProductService::getAllProducts() const
     {
         return repo.getAll();
     }
 
+    std::optional<Product> ProductService::getProduct(std::uint64_t id) const
+    {
+        return repo.findById(id);
+    }
+
+    std::vector<Product> ProductService::getByCategory(std::uint32_t categoryId, std::size_t limit, std::size_t offset) const
+    {
+        return repo.findBy("category_id", categoryId, limit, offset);
+    }
+
     void ProductService::reload()
     {
         repo.reload();
@@ -0,0 +1,95 @@
+#include <softadastra/commerce/products/ProductSnapshot.hpp>
+
+#include <adastra/core/concurrency/TaskScheduler.hpp>
+#include <adastra/tools/time/TImestampUtils.hpp>
+
+#include <iostream>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        adastra::core::structures::IdSlotIndex buildIndex(const std::vector<Product> &products)
+        {
+            std::vector<std::uint64_t> ids;
+            ids.reserve(products.size());
+            for (const auto &p : products)
+                ids.push_back(p.getId());
+
+            adastra::core::structures::IdSlotIndex index(ids);
+            if (index.duplicates() > 0)
+                std::cerr << "[ProductSnapshot] ⚠️ " << index.duplicates() << " id(s) en double ignoré(s)\n";
+            return index;
+        }
+
+        std::vector<Product> concat(const std::vector<Product> &base, std::vector<Product> added)
+        {
+            std::vector<Product> out;
+            out.reserve(base.size() + added.size());
+            out.insert(out.end(), base.begin(), base.end());
+            std::move(added.begin(), added.end(), std::back_inserter(out));
+            return out;
+        }
+
+        // Sérialise products[from, end) dans bodies[from, end), en parallèle sur les gros lots.
+        void serializeBodies(const std::vector<Product> &products, std::vector<std::string> &bodies, std::size_t from)
+        {
+            constexpr std::size_t kGrain = 512;
+
+            bodies.resize(products.size());
+            auto range = [&](std::size_t lo, std::size_t hi)
+            {
+                for (std::size_t i = lo; i < hi; ++i)
+                    bodies[i] = products[i].toJson().dump();
+            };
+
+            if (products.size() - from < 2 * kGrain)
+                range(from, products.size());
+            else
+                adastra::core::concurrency::TaskScheduler::shared().parallelFor(from, products.size(), range, {kGrain});
+        }
+
+        // Tri stable : à date égale, l'ordre du catalogue est conservé.
+        std::vector<std::uint32_t> newestFirst(const ProductColumns &columns)
+        {
+            std::vector<std::uint32_t> order(columns.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b)
+                             { return columns.created_at[a] > columns.created_at[b]; });
+            return order;
+        }
+    }
+
+    ProductSnapshot::ProductSnapshot(std::vector<Product> items)
+        : products(std::move(items)),
+          columns(products),
+          index(buildIndex(products))
+    {
+        serializeBodies(products, bodies, 0);
+
+        const std::int64_t now = adastra::tools::time::coarseNowMs();
+        updatedAtMs.reserve(products.size());
+        for (const auto &p : products)
+            updatedAtMs.push_back(p.getCreatedAt() > 0 ? p.getCreatedAt() * 1000 : now);
+        newest = newestFirst(columns);
+    }
+
+    ProductSnapshot::ProductSnapshot(const ProductSnapshot &base, std::vector<Product> added)
+        : products(concat(base.products, std::move(added))),
+          columns(products),
+          index(buildIndex(products)),
+          layout(base.layout)
+    {
+        bodies.reserve(products.size());
+        bodies.insert(bodies.end(), base.bodies.begin(), base.bodies.end());
+        serializeBodies(products, bodies, base.products.size());
+
+        updatedAtMs.reserve(products.size());
+        updatedAtMs.insert(updatedAtMs.end(), base.updatedAtMs.begin(), base.updatedAtMs.end());
+        updatedAtMs.resize(products.size(), adastra::tools::time::coarseNowMs());
+        newest = newestFirst(columns);
+    }
+}
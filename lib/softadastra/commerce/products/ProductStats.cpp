@@ -0,0 +1,225 @@
+#include <softadastra/commerce/products/ProductStats.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace softadastra::commerce::products
+{
+    namespace
+    {
+        // Colonne qui suit les compteurs : 1 une fois le slot repris par seed().
+        constexpr std::size_t kSeededColumn = kProductCounters;
+
+        std::vector<std::string> columnNames()
+        {
+            std::vector<std::string> names;
+            for (std::size_t i = 0; i < kProductCounters; ++i)
+                names.emplace_back(counterName(static_cast<ProductCounter>(i)));
+            names.emplace_back("seeded");
+            return names;
+        }
+    }
+
+    const char *counterName(ProductCounter counter)
+    {
+        switch (counter)
+        {
+        case ProductCounter::Views:
+            return "views";
+        case ProductCounter::Likes:
+            return "likes_count";
+        case ProductCounter::Orders:
+            return "orders_count";
+        case ProductCounter::Reviews:
+            return "review_count";
+        case ProductCounter::UniqueBuyers:
+            return "unique_buyers_count";
+        }
+        return "unknown";
+    }
+
+    ProductStats::ProductStats(std::string directory, adastra::storage::database::MetadataStoreOptions options)
+        : idsPath_((std::filesystem::path(directory) / "slots.ids").string()),
+          store_(std::move(directory), columnNames(), options)
+    {
+        std::ifstream in(idsPath_, std::ios::binary);
+        std::uint64_t id = 0;
+        // Un id incomplet en fin de fichier (crash pendant l'ajout) est ignoré et
+        // sera écrasé par le prochain ajout.
+        while (in.read(reinterpret_cast<char *>(&id), sizeof(id)))
+        {
+            slots_.emplace(id, static_cast<std::uint32_t>(ids_.size()));
+            ids_.push_back(id);
+        }
+    }
+
+    void ProductStats::appendIds(const std::vector<std::uint64_t> &ids)
+    {
+        const int fd = ::open(idsPath_.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("ProductStats: impossible d'ouvrir " + idsPath_);
+
+        const off_t at = static_cast<off_t>(ids_.size() * sizeof(std::uint64_t));
+        const std::size_t length = ids.size() * sizeof(std::uint64_t);
+        std::size_t written = 0;
+        while (written < length)
+        {
+            const ssize_t n = ::pwrite(fd, reinterpret_cast<const char *>(ids.data()) + written, length - written,
+                                       at + static_cast<off_t>(written));
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            written += static_cast<std::size_t>(n);
+        }
+        const bool ok = written == length && ::ftruncate(fd, at + static_cast<off_t>(length)) == 0 && ::fdatasync(fd) == 0;
+        ::close(fd);
+        if (!ok)
+            throw std::runtime_error("ProductStats: écriture de " + idsPath_ + " a échoué");
+    }
+
+    std::uint32_t ProductStats::slotOf(std::uint64_t productId) const
+    {
+        std::shared_lock<std::shared_mutex> lock(slotsMutex_);
+        const auto it = slots_.find(productId);
+        return it != slots_.end() ? it->second : npos;
+    }
+
+    std::uint32_t ProductStats::slotFor(std::uint64_t productId)
+    {
+        if (const auto slot = slotOf(productId); slot != npos)
+            return slot;
+
+        std::unique_lock<std::shared_mutex> lock(slotsMutex_);
+        if (const auto it = slots_.find(productId); it != slots_.end())
+            return it->second;
+
+        appendIds({productId});
+        const auto slot = static_cast<std::uint32_t>(ids_.size());
+        slots_.emplace(productId, slot);
+        ids_.push_back(productId);
+        return slot;
+    }
+
+    std::uint32_t ProductStats::add(std::uint64_t productId, ProductCounter counter, std::int64_t delta)
+    {
+        const auto value = store_.add(static_cast<std::size_t>(counter), slotFor(productId), delta);
+        epoch_.fetch_add(1, std::memory_order_release);
+        return value;
+    }
+
+    std::uint32_t ProductStats::get(std::uint64_t productId, ProductCounter counter) const
+    {
+        const auto slot = slotOf(productId);
+        return slot == npos ? 0 : store_.get(static_cast<std::size_t>(counter), slot);
+    }
+
+    ProductStats::Counters ProductStats::counters(std::uint64_t productId) const
+    {
+        Counters out{};
+        const auto slot = slotOf(productId);
+        if (slot != npos)
+            for (std::size_t i = 0; i < kProductCounters; ++i)
+                out[i] = store_.get(i, slot);
+        return out;
+    }
+
+    std::vector<std::pair<std::uint64_t, ProductStats::Counters>> ProductStats::all() const
+    {
+        std::vector<std::pair<std::uint64_t, Counters>> out;
+        {
+            std::shared_lock<std::shared_mutex> lock(slotsMutex_);
+            out.reserve(ids_.size());
+            for (const auto id : ids_)
+                out.emplace_back(id, Counters{});
+        }
+
+        std::vector<std::uint32_t> column(out.size());
+        for (std::size_t c = 0; c < kProductCounters; ++c)
+        {
+            store_.read(c, 0, column);
+            for (std::size_t slot = 0; slot < out.size(); ++slot)
+                out[slot].second[c] = column[slot];
+        }
+        return out;
+    }
+
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> ProductStats::top(ProductCounter counter, std::size_t k) const
+    {
+        const auto ranked = store_.top(static_cast<std::size_t>(counter), k);
+
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> out;
+        out.reserve(ranked.size());
+        std::shared_lock<std::shared_mutex> lock(slotsMutex_);
+        for (const auto &[slot, value] : ranked)
+            out.emplace_back(ids_[slot], value);
+        return out;
+    }
+
+    std::size_t ProductStats::seed(const std::vector<Product> &products)
+    {
+        std::vector<std::pair<std::uint32_t, const Product *>> seeded;
+        {
+            std::unique_lock<std::shared_mutex> lock(slotsMutex_);
+            std::vector<std::uint32_t> done(ids_.size());
+            store_.read(kSeededColumn, 0, done);
+
+            std::vector<std::uint64_t> added;
+            for (const auto &p : products)
+            {
+                if (p.getId() == 0)
+                    continue;
+                if (const auto it = slots_.find(p.getId()); it != slots_.end())
+                {
+                    // Slot créé par add() avant la reprise : la base s'ajoute aux vues déjà comptées.
+                    if (it->second < done.size() && done[it->second] == 0)
+                    {
+                        done[it->second] = 1;
+                        seeded.emplace_back(it->second, &p);
+                    }
+                    continue;
+                }
+                const auto slot = static_cast<std::uint32_t>(ids_.size() + added.size());
+                slots_.emplace(p.getId(), slot);
+                added.push_back(p.getId());
+                seeded.emplace_back(slot, &p);
+            }
+
+            if (!added.empty())
+            {
+                try
+                {
+                    appendIds(added);
+                }
+                catch (...)
+                {
+                    for (const auto id : added)
+                        slots_.erase(id);
+                    throw;
+                }
+                ids_.insert(ids_.end(), added.begin(), added.end());
+            }
+        }
+        if (seeded.empty())
+            return 0;
+
+        // add() et non set() : une vue comptée entre-temps sur le même slot est conservée.
+        for (const auto &[slot, p] : seeded)
+        {
+            if (p->getViews() > 0)
+                store_.add(static_cast<std::size_t>(ProductCounter::Views), slot, p->getViews());
+            if (p->getReviewCount() > 0)
+                store_.add(static_cast<std::size_t>(ProductCounter::Reviews), slot, p->getReviewCount());
+            store_.set(kSeededColumn, slot, 1);
+        }
+        epoch_.fetch_add(1, std::memory_order_release);
+        store_.flush();
+        return seeded.size();
+    }
+}
@@ -1,4 +1,6 @@
 #include <softadastra/commerce/products/ProductValidator.hpp>
+#include <charconv>
+#include <cstdint>
 #include <stdexcept>
 #include <iostream>
 
@@ -57,10 +59,22 @@ namespace softadastra::commerce::products
         const bool isUpdate = (source == "update");
         const bool isInternal = (source == "createFromInternalJson");
 
-        // id : requis UNIQUEMENT hors create
+        // id : requis UNIQUEMENT hors create ; nombre ou chaîne de chiffres (toJson l'écrit en chaîne)
         if (isUpdate || isInternal)
         {
-            require_number_min("id", 1, /*integer_only=*/true);
+            const auto it = item.find("id");
+            if (it != item.end() && it->is_string())
+            {
+                const auto &s = it->get_ref<const std::string &>();
+                std::uint64_t id = 0;
+                const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), id);
+                if (ec != std::errc() || ptr != s.data() + s.size() || id == 0)
+                    throw std::runtime_error("Produit invalide : clé 'id' invalide dans : " + source);
+            }
+            else
+            {
+                require_number_min("id", 1, /*integer_only=*/true);
+            }
         }
 
         // Champs MINIMAUX pour une création
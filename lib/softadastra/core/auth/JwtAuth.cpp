@@ -0,0 +1,87 @@
+#include <softadastra/core/auth/JwtAuth.hpp>
+
+#include <adastra/config/env/EnvLoader.hpp>
+#include <adastra/crypto/hash/HashUtils.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+namespace softadastra::core::auth
+{
+    namespace
+    {
+        using adastra::config::env::EnvLoader;
+        using namespace adastra::crypto;
+
+        jwt::JwtVerifier *makeVerifier()
+        {
+            jwt::JwtOptions options;
+            options.issuer = EnvLoader::get("JWT_ISSUER", "");
+            options.audience = EnvLoader::get("JWT_AUDIENCE", "");
+
+            auto *verifier = new jwt::JwtVerifier(options);
+            bool any = false;
+
+            const std::string secret = EnvLoader::get("JWT_HS256_SECRET", "");
+            if (!secret.empty())
+            {
+                if (secret.size() < 32)
+                    std::cerr << "[JwtAuth] ⚠️ JWT_HS256_SECRET fait moins de 32 octets\n";
+                verifier->addHmacKey("", secret);
+                any = true;
+            }
+
+            const std::string publicHex = EnvLoader::get("JWT_ED25519_PUBLIC_KEY", "");
+            if (!publicHex.empty())
+            {
+                auto bytes = hash::fromHex(publicHex);
+                signature::PublicKey key;
+                if (!bytes || bytes->size() != key.size())
+                    std::cerr << "[JwtAuth] ❌ JWT_ED25519_PUBLIC_KEY invalide (64 caractères hex attendus)\n";
+                else
+                {
+                    std::copy(bytes->begin(), bytes->end(), key.begin());
+                    // Une seule clé sans kid : si les deux sont définies, Ed25519
+                    // répond aux jetons qui portent kid = "ed25519".
+                    verifier->addEd25519Key(any ? "ed25519" : "", key);
+                    any = true;
+                }
+            }
+
+            if (!any)
+                std::cerr << "[JwtAuth] ⚠️ aucune clé JWT configurée : les routes protégées renverront 401\n";
+            return verifier;
+        }
+    }
+
+    adastra::crypto::jwt::JwtVerifier &jwtVerifier()
+    {
+        // Jamais détruit : des requêtes peuvent encore arriver pendant l'arrêt.
+        static jwt::JwtVerifier *verifier = makeVerifier();
+        return *verifier;
+    }
+
+    std::string_view bearerToken(std::string_view authorization)
+    {
+        constexpr std::string_view scheme = "Bearer ";
+        if (authorization.size() <= scheme.size())
+            return {};
+
+        // Le schéma est insensible à la casse (RFC 7235 §2.1).
+        for (std::size_t i = 0; i < scheme.size(); ++i)
+        {
+            const char c = authorization[i];
+            const char lower = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+            const char expected = (scheme[i] >= 'A' && scheme[i] <= 'Z') ? static_cast<char>(scheme[i] - 'A' + 'a') : scheme[i];
+            if (lower != expected)
+                return {};
+        }
+
+        std::string_view token = authorization.substr(scheme.size());
+        while (!token.empty() && token.front() == ' ')
+            token.remove_prefix(1);
+        while (!token.empty() && (token.back() == ' ' || token.back() == '\r'))
+            token.remove_suffix(1);
+        return token;
+    }
+}
@@ -0,0 +1,163 @@
+#include <softadastra/users/CredentialHashingService.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace softadastra::users
+{
+    namespace
+    {
+        // Efface le mot de passe en clair avant de libérer la chaîne.
+        void wipe(std::string &s)
+        {
+            volatile char *p = s.data();
+            for (std::size_t i = 0; i < s.size(); ++i)
+                p[i] = 0;
+            s.clear();
+        }
+
+        std::uint64_t micros(std::chrono::steady_clock::duration d)
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+        }
+    }
+
+    CredentialHashingService::CredentialHashingService(PasswordHasher hasher, CredentialPoolOptions options)
+        : hasher_(std::move(hasher)),
+          options_(options)
+    {
+        const unsigned n = std::max(1u, options_.threads);
+        workers_.reserve(n);
+        for (unsigned i = 0; i < n; ++i)
+            workers_.emplace_back([this]
+                                  { workerLoop(); });
+    }
+
+    CredentialHashingService::~CredentialHashingService()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto &t : workers_)
+            t.join();
+    }
+
+    bool CredentialHashingService::submit(std::function<void()> run)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_ || queue_.size() >= options_.queueCapacity)
+            {
+                ++rejected_;
+                return false;
+            }
+            queue_.push_back({std::move(run), Clock::now()});
+            ++submitted_;
+        }
+        cv_.notify_one();
+        return true;
+    }
+
+    std::optional<std::future<std::string>> CredentialHashingService::hash(std::string password)
+    {
+        auto promise = std::make_shared<std::promise<std::string>>();
+        auto future = promise->get_future();
+
+        // Le mot de passe vit dans un shared_ptr : std::function exige une capture copiable.
+        auto secret = std::make_shared<std::string>(std::move(password));
+        const bool queued = submit([this, promise, secret]
+                                   {
+            try
+            {
+                promise->set_value(hasher_.hash(*secret));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+            wipe(*secret); });
+
+        if (!queued)
+        {
+            wipe(*secret);
+            return std::nullopt;
+        }
+        return future;
+    }
+
+    std::optional<std::future<bool>> CredentialHashingService::verify(std::string password, std::string encoded)
+    {
+        auto promise = std::make_shared<std::promise<bool>>();
+        auto future = promise->get_future();
+
+        auto secret = std::make_shared<std::string>(std::move(password));
+        auto stored = std::make_shared<std::string>(std::move(encoded));
+        const bool queued = submit([this, promise, secret, stored]
+                                   {
+            try
+            {
+                promise->set_value(hasher_.verify(*secret, *stored));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+            wipe(*secret); });
+
+        if (!queued)
+        {
+            wipe(*secret);
+            return std::nullopt;
+        }
+        return future;
+    }
+
+    void CredentialHashingService::workerLoop()
+    {
+        for (;;)
+        {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]
+                         { return stopping_ || !queue_.empty(); });
+                if (queue_.empty())
+                    return; // stopping_ et file vidée
+
+                task = std::move(queue_.front());
+                queue_.pop_front();
+                ++running_;
+            }
+
+            const auto start = Clock::now();
+            task.run();
+            const auto end = Clock::now();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            --running_;
+            ++completed_;
+            waitUs_.record(micros(start - task.enqueuedAt));
+            runUs_.record(micros(end - start));
+        }
+    }
+
+    CredentialMetrics CredentialHashingService::metrics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CredentialMetrics m;
+        m.workers = static_cast<unsigned>(workers_.size());
+        m.queueDepth = queue_.size();
+        m.queueCapacity = options_.queueCapacity;
+        m.running = running_;
+        m.submitted = submitted_;
+        m.completed = completed_;
+        m.rejected = rejected_;
+        m.waitP50Us = waitUs_.valueAtPercentile(50.0);
+        m.waitP99Us = waitUs_.valueAtPercentile(99.0);
+        m.runP50Us = runUs_.valueAtPercentile(50.0);
+        m.runP99Us = runUs_.valueAtPercentile(99.0);
+        return m;
+    }
+}
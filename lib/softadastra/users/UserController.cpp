@@ -0,0 +1,208 @@
+#include <softadastra/users/UserController.hpp>
+#include <softadastra/users/CredentialHashingService.hpp>
+#include <softadastra/users/UserStore.hpp>
+
+#include <softadastra/core/auth/JwtAuth.hpp>
+
+#include <adastra/config/env/EnvLoader.hpp>
+#include <adastra/utils/validation/JsonSchema.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#ifndef SA_BACKEND_ROOT
+#define SA_BACKEND_ROOT ""
+#endif
+
+namespace softadastra::users
+{
+    namespace
+    {
+        std::unique_ptr<UserStore> g_users;
+        std::unique_ptr<CredentialHashingService> g_credentials;
+
+        // Au-delà, la requête rend la main (503) ; le hash se termine quand même.
+        constexpr auto HASH_TIMEOUT = std::chrono::seconds(5);
+
+        std::string resolveJournalPath()
+        {
+            std::filesystem::path p = adastra::config::env::EnvLoader::get("USER_JOURNAL_PATH", "");
+            if (p.empty())
+                p = std::filesystem::path("config") / "data" / "users.ndjson";
+            if (p.is_relative())
+                p = std::filesystem::path(SA_BACKEND_ROOT) / p;
+            return p.lexically_normal().string();
+        }
+
+        // Compilé une fois à l'enregistrement de la route.
+        adastra::utils::validation::JsonSchema makeUserSchema()
+        {
+            adastra::utils::validation::JsonSchema schema;
+            schema.field("name").required().string(1, 200);
+            schema.field("email").required().email("Invalid email");
+            schema.field("age").required().integer(1, 150, "Age");
+            schema.field("password").string(8, 1024);
+            return schema;
+        }
+
+        // Appelé après validation : les champs requis sont présents et typés.
+        User parseUser(const nlohmann::json &j)
+        {
+            User out;
+            out.name = j.at("name").get<std::string>();
+            out.email = j.at("email").get<std::string>();
+
+            long long age = 0;
+            adastra::utils::validation::integerValue(j.at("age"), age);
+            out.age = static_cast<int>(age);
+            return out;
+        }
+    }
+
+    void UserController(Vix::App &app)
+    {
+        if (!g_users)
+        {
+            g_users = std::make_unique<UserStore>(
+                std::make_unique<UserJournal>(resolveJournalPath()),
+                adastra::tools::id::SnowflakeGenerator::shared());
+            g_users->load();
+        }
+
+        if (!g_credentials)
+        {
+            // Pool dédié : les hashs (dizaines de ms) ne prennent pas plus de
+            // `threads` cœurs, quel que soit le nombre d'inscriptions simultanées.
+            using adastra::config::env::EnvLoader;
+            CredentialPoolOptions options;
+            options.threads = static_cast<unsigned>(std::max(1, EnvLoader::getInt("CREDENTIAL_HASH_THREADS", 2)));
+            options.queueCapacity = static_cast<std::size_t>(std::max(1, EnvLoader::getInt("CREDENTIAL_HASH_QUEUE", 64)));
+            g_credentials = std::make_unique<CredentialHashingService>(CredentialHashingService::PasswordHasher(), options);
+        }
+
+        app.post("/users", core::auth::requireAuth([schema = makeUserSchema()](auto &req, auto &res, const auto &)
+                 {
+                 nlohmann::json body;
+                 try
+                 {
+                     body = nlohmann::json::parse(req.body());
+                 }
+                 catch (...)
+                 {
+                     res.status(http::status::bad_request).json({"error", "Invalid JSON"});
+                     return;
+                 }
+
+                 const auto errors = schema.validate(body);
+                 if (!errors.empty())
+                 {
+                     std::vector<Vix::json::token> flat;
+                     flat.reserve(errors.size() * 2);
+
+                     for (const auto &e : errors)
+                     {
+                         flat.emplace_back(e.field);
+                         flat.emplace_back(e.message);
+                     }
+
+                     res.status(http::status::bad_request).json({"errors", Vix::json::obj(std::move(flat))});
+
+                     return;
+                 }
+
+                 User user = parseUser(body);
+                 if (auto pw = body.find("password"); pw != body.end())
+                 {
+                     // Email déjà pris : inutile de payer le hash.
+                     if (g_users->findByEmail(user.email))
+                     {
+                         res.status(http::status::conflict).json({"error", "Email already registered"});
+                         return;
+                     }
+
+                     auto pending = g_credentials->hash(pw->get<std::string>());
+                     if (!pending || pending->wait_for(HASH_TIMEOUT) != std::future_status::ready)
+                     {
+                         res.status(http::status::service_unavailable)
+                             .header("Retry-After", "1")
+                             .json({"error", "Signup temporarily overloaded"});
+                         return;
+                     }
+
+                     try
+                     {
+                         user.passwordHash = pending->get();
+                     }
+                     catch (const std::exception &e)
+                     {
+                         std::cerr << "[UserController] " << e.what() << "\n";
+                         res.status(http::status::internal_server_error).json({"error", "Could not hash password"});
+                         return;
+                     }
+                 }
+
+                 CreateResult result;
+                 try
+                 {
+                     result = g_users->create(std::move(user));
+                 }
+                 catch (const std::exception &e)
+                 {
+                     std::cerr << "[UserController] " << e.what() << "\n";
+                     res.status(http::status::internal_server_error).json({"error", "Could not persist user"});
+                     return;
+                 }
+
+                 if (result.status == CreateStatus::EmailTaken)
+                 {
+                     res.status(http::status::conflict).json({"error", "Email already registered"});
+                     return;
+                 }
+
+                 res.status(http::status::created).json(Vix::json::o(
+                    "status", "created",
+                    "user", result.user.toJson()
+                 )); }));
+
+        app.get("/metrics/credentials", [](auto &, auto &res)
+                {
+                 const auto m = g_credentials->metrics();
+                 res.json(Vix::json::o(
+                    "workers", m.workers,
+                    "queue_depth", m.queueDepth,
+                    "queue_capacity", m.queueCapacity,
+                    "running", m.running,
+                    "submitted", m.submitted,
+                    "completed", m.completed,
+                    "rejected", m.rejected,
+                    "wait_p50_us", m.waitP50Us,
+                    "wait_p99_us", m.waitP99Us,
+                    "hash_p50_us", m.runP50Us,
+                    "hash_p99_us", m.runP99Us
+                 )); });
+
+        app.get("/users/{id}", [](auto &req, auto &res)
+                {
+                 const std::string raw = req.param("id", "");
+                 std::uint64_t id = 0;
+                 auto [ptr, ec] = std::from_chars(raw.data(), raw.data() + raw.size(), id);
+                 if (ec != std::errc() || ptr != raw.data() + raw.size() || id == 0)
+                 {
+                     res.status(http::status::bad_request).json({"error", "Invalid user id"});
+                     return;
+                 }
+
+                 auto user = g_users->findById(id);
+                 if (!user)
+                 {
+                     res.status(http::status::not_found).json({"error", "User not found"});
+                     return;
+                 }
+                 res.json(Vix::json::o("user", user->toJson())); });
+    }
+}
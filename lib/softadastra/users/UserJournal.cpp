@@ -0,0 +1,134 @@
+#include <softadastra/users/UserJournal.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace softadastra::users
+{
+    UserJournal::UserJournal(std::string path)
+        : path_(std::move(path)),
+          open_(std::make_shared<Group>())
+    {
+        file_ = std::fopen(path_.c_str(), "ab");
+        if (!file_)
+            throw std::runtime_error("Impossible d'ouvrir le journal des utilisateurs : " + path_);
+        // Les groupes sont déjà assemblés en mémoire : sans tampon stdio, un échec
+        // ne laisse aucun reste qui serait écrit avec le groupe suivant.
+        std::setvbuf(file_, nullptr, _IONBF, 0);
+    }
+
+    UserJournal::~UserJournal()
+    {
+        if (file_)
+            std::fclose(file_);
+    }
+
+    bool UserJournal::writeDurable(const std::string &lines)
+    {
+#ifndef _WIN32
+        const int fd = fileno(file_);
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+            return false;
+
+        const bool ok = std::fwrite(lines.data(), 1, lines.size(), file_) == lines.size() &&
+                        std::fflush(file_) == 0 && ::fsync(fd) == 0;
+        if (!ok)
+        {
+            // Retour à la fin du dernier groupe réussi : une ligne partielle ne doit
+            // pas précéder les groupes suivants (ouvert en "ab", on écrit toujours à la fin).
+            std::clearerr(file_);
+            if (::ftruncate(fd, st.st_size) != 0)
+                std::cerr << "[UserJournal] ⚠️ impossible de tronquer " << path_ << " après un échec d'écriture\n";
+        }
+        return ok;
+#else
+        const bool ok = std::fwrite(lines.data(), 1, lines.size(), file_) == lines.size() &&
+                        std::fflush(file_) == 0;
+        if (!ok)
+            std::clearerr(file_);
+        return ok;
+#endif
+    }
+
+    void UserJournal::append(const User &user)
+    {
+        nlohmann::json j = {
+            {"id", user.id},
+            {"name", user.name},
+            {"email", user.email},
+            {"age", user.age}};
+        if (!user.passwordHash.empty())
+            j["password_hash"] = user.passwordHash;
+        std::string line = j.dump();
+        line += '\n';
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto group = open_;
+        group->lines += line;
+
+        while (!group->done)
+        {
+            if (flushing_)
+            {
+                flushed_.wait(lock);
+                continue;
+            }
+
+            // Aucun fsync en cours : ce thread synchronise tout le groupe ouvert
+            // (le sien) pendant que les suivants remplissent un nouveau groupe.
+            flushing_ = true;
+            auto batch = open_;
+            open_ = std::make_shared<Group>();
+            lock.unlock();
+
+            const bool ok = writeDurable(batch->lines);
+
+            lock.lock();
+            batch->done = true;
+            batch->ok = ok;
+            flushing_ = false;
+            flushed_.notify_all();
+        }
+
+        if (!group->ok)
+            throw std::runtime_error("Échec d'écriture du journal des utilisateurs : " + path_);
+    }
+
+    std::size_t UserJournal::replay(const std::function<void(User)> &apply) const
+    {
+        std::ifstream in(path_);
+        std::string line;
+        std::size_t ok = 0, bad = 0;
+        while (std::getline(in, line))
+        {
+            if (line.empty())
+                continue;
+            try
+            {
+                const auto j = nlohmann::json::parse(line);
+                User u;
+                u.id = j.at("id").get<std::uint64_t>();
+                u.name = j.at("name").get<std::string>();
+                u.email = j.at("email").get<std::string>();
+                u.age = j.value("age", 0);
+                u.passwordHash = j.value("password_hash", "");
+                apply(std::move(u));
+                ++ok;
+            }
+            catch (const std::exception &)
+            {
+                ++bad;
+            }
+        }
+
+        std::cerr << "[UserJournal] Rejoué ok=" << ok << " bad=" << bad << " depuis " << path_ << "\n";
+        return ok;
+    }
+}
@@ -0,0 +1,160 @@
+#include <softadastra/users/UserStore.hpp>
+
+#include <cctype>
+#include <functional>
+
+namespace softadastra::users
+{
+    namespace
+    {
+        std::size_t roundUpPow2(std::size_t n)
+        {
+            std::size_t p = 1;
+            while (p < n)
+                p <<= 1;
+            return p;
+        }
+
+        // Les bits bas d'un Snowflake sont la séquence : on mélange avant de répartir.
+        inline std::uint64_t mix(std::uint64_t x)
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 33;
+            return x;
+        }
+    }
+
+    UserStore::UserStore(std::unique_ptr<UserJournal> journal,
+                         adastra::tools::id::SnowflakeGenerator &ids,
+                         std::size_t stripes)
+        : journal_(std::move(journal)),
+          ids_(ids),
+          mask_(roundUpPow2(stripes == 0 ? 1 : stripes) - 1),
+          users_(std::make_unique<UserStripe[]>(mask_ + 1)),
+          emails_(std::make_unique<EmailStripe[]>(mask_ + 1)) {}
+
+    std::string UserStore::normalizeEmail(std::string_view email)
+    {
+        while (!email.empty() && std::isspace(static_cast<unsigned char>(email.front())))
+            email.remove_prefix(1);
+        while (!email.empty() && std::isspace(static_cast<unsigned char>(email.back())))
+            email.remove_suffix(1);
+
+        std::string out(email);
+        for (auto &c : out)
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        return out;
+    }
+
+    UserStore::UserStripe &UserStore::userStripe(std::uint64_t id) const
+    {
+        return users_[mix(id) & mask_];
+    }
+
+    UserStore::EmailStripe &UserStore::emailStripe(const std::string &email) const
+    {
+        return emails_[std::hash<std::string>{}(email) & mask_];
+    }
+
+    void UserStore::put(User user)
+    {
+        {
+            const std::string key = normalizeEmail(user.email);
+            auto &es = emailStripe(key);
+            std::lock_guard<std::mutex> lock(es.mutex);
+            es.ids[key] = user.id;
+        }
+
+        auto &us = userStripe(user.id);
+        std::lock_guard<std::mutex> lock(us.mutex);
+        us.users[user.id] = std::move(user);
+    }
+
+    std::size_t UserStore::load()
+    {
+        if (!journal_)
+            return 0;
+        return journal_->replay([this](User u)
+                                { put(std::move(u)); });
+    }
+
+    CreateResult UserStore::create(User user)
+    {
+        const std::string key = normalizeEmail(user.email);
+        auto &es = emailStripe(key);
+
+        // Réserve l'email avant de journaliser : deux inscriptions concurrentes avec
+        // le même email ne peuvent pas passer toutes les deux.
+        {
+            std::lock_guard<std::mutex> lock(es.mutex);
+            auto it = es.ids.find(key);
+            if (it != es.ids.end())
+            {
+                CreateResult taken{CreateStatus::EmailTaken, {}};
+                if (auto existing = findById(it->second))
+                    taken.user = std::move(*existing);
+                return taken;
+            }
+            user.id = ids_.next();
+            es.ids.emplace(key, user.id);
+        }
+
+        if (journal_)
+        {
+            try
+            {
+                journal_->append(user);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(es.mutex);
+                es.ids.erase(key);
+                throw;
+            }
+        }
+
+        {
+            auto &us = userStripe(user.id);
+            std::lock_guard<std::mutex> lock(us.mutex);
+            us.users.emplace(user.id, user);
+        }
+        return {CreateStatus::Created, std::move(user)};
+    }
+
+    std::optional<User> UserStore::findById(std::uint64_t id) const
+    {
+        auto &us = userStripe(id);
+        std::lock_guard<std::mutex> lock(us.mutex);
+        auto it = us.users.find(id);
+        if (it == us.users.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    std::optional<User> UserStore::findByEmail(std::string_view email) const
+    {
+        const std::string key = normalizeEmail(email);
+        std::uint64_t id = 0;
+        {
+            auto &es = emailStripe(key);
+            std::lock_guard<std::mutex> lock(es.mutex);
+            auto it = es.ids.find(key);
+            if (it == es.ids.end())
+                return std::nullopt;
+            id = it->second;
+        }
+        return findById(id);
+    }
+
+    std::size_t UserStore::size() const
+    {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(users_[i].mutex);
+            n += users_[i].users.size();
+        }
+        return n;
+    }
+}
@@ -0,0 +1,272 @@
+#include "HttpConnection.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace sa::loadgen
+{
+    namespace
+    {
+        bool iequalsPrefix(std::string_view line, std::string_view name)
+        {
+            if (line.size() < name.size())
+                return false;
+            for (std::size_t i = 0; i < name.size(); ++i)
+            {
+                if (std::tolower(static_cast<unsigned char>(line[i])) != name[i])
+                    return false;
+            }
+            return true;
+        }
+
+        std::string_view headerValue(std::string_view line, std::size_t nameLength)
+        {
+            line.remove_prefix(nameLength);
+            while (!line.empty() && (line.front() == ' ' || line.front() == '\t'))
+                line.remove_prefix(1);
+            return line;
+        }
+    }
+
+    HttpConnection::HttpConnection(std::string host, std::uint16_t port, int timeoutMs)
+        : host_(std::move(host)), port_(port), timeoutMs_(timeoutMs) {}
+
+    HttpConnection::~HttpConnection() { close(); }
+
+    void HttpConnection::close()
+    {
+        if (fd_ >= 0)
+            ::close(fd_);
+        fd_ = -1;
+        buffer_.clear();
+        pos_ = 0;
+    }
+
+    void HttpConnection::connect()
+    {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo *res = nullptr;
+        const std::string port = std::to_string(port_);
+        if (::getaddrinfo(host_.c_str(), port.c_str(), &hints, &res) != 0 || !res)
+            throw std::runtime_error("résolution impossible : " + host_);
+
+        for (auto *ai = res; ai; ai = ai->ai_next)
+        {
+            fd_ = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+            if (fd_ < 0)
+                continue;
+            if (::connect(fd_, ai->ai_addr, ai->ai_addrlen) == 0)
+                break;
+            ::close(fd_);
+            fd_ = -1;
+        }
+        ::freeaddrinfo(res);
+
+        if (fd_ < 0)
+            throw std::runtime_error("connexion refusée : " + host_ + ":" + port);
+
+        int one = 1;
+        ::setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+
+        timeval tv{};
+        tv.tv_sec = timeoutMs_ / 1000;
+        tv.tv_usec = (timeoutMs_ % 1000) * 1000;
+        ::setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
+        ::setsockopt(fd_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof tv);
+    }
+
+    void HttpConnection::sendAll(const std::string &data)
+    {
+        std::size_t sent = 0;
+        while (sent < data.size())
+        {
+            const auto n = ::send(fd_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0)
+            {
+                if (n < 0 && errno == EINTR)
+                    continue;
+                throw std::runtime_error(std::string("send: ") + std::strerror(errno));
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+    }
+
+    bool HttpConnection::fill()
+    {
+        if (pos_ > 0 && pos_ == buffer_.size())
+        {
+            buffer_.clear();
+            pos_ = 0;
+        }
+
+        char chunk[16384];
+        for (;;)
+        {
+            const auto n = ::recv(fd_, chunk, sizeof chunk, 0);
+            if (n > 0)
+            {
+                buffer_.append(chunk, static_cast<std::size_t>(n));
+                return true;
+            }
+            if (n == 0)
+                return false;
+            if (errno == EINTR)
+                continue;
+            throw std::runtime_error(std::string("recv: ") + std::strerror(errno));
+        }
+    }
+
+    std::string HttpConnection::readLine()
+    {
+        for (;;)
+        {
+            const auto eol = buffer_.find("\r\n", pos_);
+            if (eol != std::string::npos)
+            {
+                std::string line = buffer_.substr(pos_, eol - pos_);
+                pos_ = eol + 2;
+                return line;
+            }
+            if (!fill())
+                throw std::runtime_error("connexion fermée pendant l'en-tête");
+        }
+    }
+
+    std::size_t HttpConnection::readBody(std::size_t length)
+    {
+        while (buffer_.size() - pos_ < length)
+        {
+            if (!fill())
+                throw std::runtime_error("connexion fermée pendant le corps");
+        }
+        pos_ += length;
+        return length;
+    }
+
+    std::size_t HttpConnection::readChunked()
+    {
+        std::size_t total = 0;
+        for (;;)
+        {
+            const std::string sizeLine = readLine();
+            const std::size_t size = std::stoul(sizeLine, nullptr, 16);
+            if (size == 0)
+            {
+                // Trailers éventuels jusqu'à la ligne vide.
+                while (!readLine().empty())
+                {
+                }
+                return total;
+            }
+            total += readBody(size);
+            readLine();
+        }
+    }
+
+    std::size_t HttpConnection::readUntilClose()
+    {
+        while (fill())
+        {
+        }
+        const std::size_t n = buffer_.size() - pos_;
+        pos_ = buffer_.size();
+        return n;
+    }
+
+    HttpResponse HttpConnection::request(std::string_view method,
+                                         std::string_view path,
+                                         std::string_view body,
+                                         std::string_view accept,
+                                         std::string_view bearer)
+    {
+        std::string req;
+        req.reserve(256 + body.size());
+        req.append(method).append(" ").append(path).append(" HTTP/1.1\r\n");
+        req.append("Host: ").append(host_).append(":").append(std::to_string(port_)).append("\r\n");
+        req.append("Connection: keep-alive\r\n");
+        req.append("Accept: ").append(accept).append("\r\n");
+        if (!bearer.empty())
+            req.append("Authorization: Bearer ").append(bearer).append("\r\n");
+        if (!body.empty() || method == "POST")
+        {
+            req.append("Content-Type: application/json\r\n");
+            req.append("Content-Length: ").append(std::to_string(body.size())).append("\r\n");
+        }
+        req.append("\r\n").append(body);
+
+        // Une connexion keep-alive réutilisée peut avoir été fermée par le serveur :
+        // un seul nouvel essai dans ce cas, jamais sur une connexion neuve.
+        const bool reused = fd_ >= 0;
+        for (int attempt = 0;; ++attempt)
+        {
+            try
+            {
+                if (fd_ < 0)
+                    connect();
+                sendAll(req);
+
+                HttpResponse res;
+                const std::string status = readLine();
+                if (status.size() < 12 || status.compare(0, 5, "HTTP/") != 0)
+                    throw std::runtime_error("ligne de statut invalide");
+                res.status = std::atoi(status.c_str() + 9);
+
+                std::size_t contentLength = 0;
+                bool hasLength = false, chunked = false, closeAfter = false;
+                for (std::string line = readLine(); !line.empty(); line = readLine())
+                {
+                    if (iequalsPrefix(line, "content-length:"))
+                    {
+                        contentLength = std::stoul(std::string(headerValue(line, 15)));
+                        hasLength = true;
+                    }
+                    else if (iequalsPrefix(line, "transfer-encoding:"))
+                    {
+                        chunked = headerValue(line, 18).find("chunked") != std::string_view::npos;
+                    }
+                    else if (iequalsPrefix(line, "connection:"))
+                    {
+                        auto v = std::string(headerValue(line, 11));
+                        std::transform(v.begin(), v.end(), v.begin(), [](unsigned char c)
+                                       { return static_cast<char>(std::tolower(c)); });
+                        closeAfter = v.find("close") != std::string::npos;
+                    }
+                }
+
+                if (chunked)
+                    res.bodyBytes = readChunked();
+                else if (hasLength)
+                    res.bodyBytes = readBody(contentLength);
+                else if (res.status >= 200 && res.status != 204 && res.status != 304)
+                {
+                    res.bodyBytes = readUntilClose();
+                    closeAfter = true;
+                }
+
+                if (closeAfter)
+                    close();
+                return res;
+            }
+            catch (const std::exception &)
+            {
+                close();
+                if (!reused || attempt >= 1)
+                    throw;
+            }
+        }
+    }
+}
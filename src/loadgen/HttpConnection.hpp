@@ -0,0 +1,52 @@
+#ifndef SA_LOADGEN_HTTP_CONNECTION_HPP
+#define SA_LOADGEN_HTTP_CONNECTION_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace sa::loadgen
+{
+    struct HttpResponse
+    {
+        int status = 0;
+        std::size_t bodyBytes = 0;
+    };
+
+    // Connexion HTTP/1.1 keep-alive minimale (un seul échange à la fois).
+    // Reconnecte automatiquement ; lance std::runtime_error en cas d'échec réseau.
+    class HttpConnection
+    {
+    public:
+        HttpConnection(std::string host, std::uint16_t port, int timeoutMs);
+        ~HttpConnection();
+
+        HttpConnection(const HttpConnection &) = delete;
+        HttpConnection &operator=(const HttpConnection &) = delete;
+
+        HttpResponse request(std::string_view method,
+                             std::string_view path,
+                             std::string_view body = {},
+                             std::string_view accept = "application/json",
+                             std::string_view bearer = {});
+
+    private:
+        void connect();
+        void close();
+        void sendAll(const std::string &data);
+        bool fill(); // lit dans buffer_ ; false si la connexion est fermée
+        std::string readLine();
+        std::size_t readBody(std::size_t length);
+        std::size_t readChunked();
+        std::size_t readUntilClose();
+
+        std::string host_;
+        std::uint16_t port_;
+        int timeoutMs_;
+        int fd_ = -1;
+        std::string buffer_;
+        std::size_t pos_ = 0;
+    };
+}
+
+#endif // SA_LOADGEN_HTTP_CONNECTION_HPP
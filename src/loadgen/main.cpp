@@ -0,0 +1,392 @@
+// sa_loadgen : générateur de charge HTTP pour softadastra-backend-vix.
+//
+//   sa_loadgen --mode closed --connections 64 --duration 30 --mix all=1,first=4,status=4,users=1
+//   sa_loadgen --mode open --rate 5000 --connections 128 --duration 60 --out report.json
+//
+// closed : chaque connexion enchaîne les requêtes (concurrence fixe).
+// open   : requêtes planifiées à débit fixe ; la latence est mesurée depuis l'instant
+//          prévu d'envoi, pas l'instant réel, pour ne pas masquer l'attente
+//          (coordinated omission).
+
+#include "HttpConnection.hpp"
+
+#include <adastra/tools/metrics/HdrHistogram.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using adastra::tools::metrics::HdrHistogram;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    constexpr std::uint64_t HIGHEST_LATENCY_US = 60'000'000; // 60 s
+
+    struct Route
+    {
+        std::string name;
+        std::string method;
+        std::string path;
+        bool isSignup = false; // POST /users : corps avec email unique
+    };
+
+    const std::vector<Route> &knownRoutes()
+    {
+        static const std::vector<Route> routes = {
+            {"all", "GET", "/api/products/all", false},
+            {"first", "GET", "/api/products/first", false},
+            {"status", "GET", "/api/products/status", false},
+            {"users", "POST", "/users", true},
+        };
+        return routes;
+    }
+
+    struct Options
+    {
+        std::string host = "127.0.0.1";
+        std::uint16_t port = 8080;
+        std::string mode = "closed";
+        unsigned connections = 16;
+        double rate = 1000.0; // req/s, mode open
+        double durationSec = 10.0;
+        double warmupSec = 2.0;
+        int timeoutMs = 5000;
+        std::string mix = "all=1,first=4,status=4,users=1";
+        std::string accept = "application/json";
+        std::string token; // JWT envoyé en Bearer (routes d'écriture)
+        std::string out;
+        std::uint64_t seed = 42;
+    };
+
+    struct WeightedRoute
+    {
+        const Route *route;
+        double weight;
+    };
+
+    // Résultats d'un thread, fusionnés à la fin.
+    struct RouteStats
+    {
+        HdrHistogram latency{HIGHEST_LATENCY_US};
+        std::uint64_t errors = 0;
+        std::uint64_t bytes = 0;
+        std::map<int, std::uint64_t> statuses;
+    };
+
+    [[noreturn]] void usage(const char *msg = nullptr)
+    {
+        if (msg)
+            std::cerr << "sa_loadgen: " << msg << "\n\n";
+        std::cerr << "usage: sa_loadgen [options]\n"
+                     "  --host H            (127.0.0.1)\n"
+                     "  --port P            (8080)\n"
+                     "  --mode closed|open  (closed)\n"
+                     "  --connections N     (16)\n"
+                     "  --rate R            req/s en mode open (1000)\n"
+                     "  --duration S        secondes mesurées (10)\n"
+                     "  --warmup S          secondes ignorées au début (2)\n"
+                     "  --timeout-ms T      (5000)\n"
+                     "  --mix a=w,b=w       routes : all, first, status, users\n"
+                     "  --accept TYPE       en-tête Accept (application/json)\n"
+                     "  --token JWT         Authorization: Bearer (requis pour users)\n"
+                     "  --seed N            graine du tirage des routes\n"
+                     "  --out FILE          rapport JSON (stdout sinon)\n";
+        std::exit(2);
+    }
+
+    Options parseArgs(int argc, char **argv)
+    {
+        Options o;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg == "-h" || arg == "--help")
+                usage();
+            if (i + 1 >= argc)
+                usage(("valeur manquante pour " + arg).c_str());
+            const std::string v = argv[++i];
+
+            try
+            {
+                if (arg == "--host")
+                    o.host = v;
+                else if (arg == "--port")
+                    o.port = static_cast<std::uint16_t>(std::stoul(v));
+                else if (arg == "--mode")
+                    o.mode = v;
+                else if (arg == "--connections")
+                    o.connections = static_cast<unsigned>(std::stoul(v));
+                else if (arg == "--rate")
+                    o.rate = std::stod(v);
+                else if (arg == "--duration")
+                    o.durationSec = std::stod(v);
+                else if (arg == "--warmup")
+                    o.warmupSec = std::stod(v);
+                else if (arg == "--timeout-ms")
+                    o.timeoutMs = std::stoi(v);
+                else if (arg == "--mix")
+                    o.mix = v;
+                else if (arg == "--accept")
+                    o.accept = v;
+                else if (arg == "--token")
+                    o.token = v;
+                else if (arg == "--seed")
+                    o.seed = std::stoull(v);
+                else if (arg == "--out")
+                    o.out = v;
+                else
+                    usage(("option inconnue " + arg).c_str());
+            }
+            catch (const std::logic_error &)
+            {
+                usage(("valeur invalide pour " + arg).c_str());
+            }
+        }
+
+        if (o.mode != "closed" && o.mode != "open")
+            usage("--mode doit être closed ou open");
+        if (o.connections == 0 || o.durationSec <= 0 || o.warmupSec < 0 || (o.mode == "open" && o.rate <= 0))
+            usage("paramètres hors plage");
+        return o;
+    }
+
+    std::vector<WeightedRoute> parseMix(const std::string &mix)
+    {
+        std::vector<WeightedRoute> out;
+        std::size_t start = 0;
+        while (start <= mix.size())
+        {
+            const auto comma = mix.find(',', start);
+            const std::string item = mix.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+            start = comma == std::string::npos ? mix.size() + 1 : comma + 1;
+            if (item.empty())
+                continue;
+
+            const auto eq = item.find('=');
+            const std::string name = item.substr(0, eq);
+            const double weight = eq == std::string::npos ? 1.0 : std::stod(item.substr(eq + 1));
+
+            const Route *route = nullptr;
+            for (const auto &r : knownRoutes())
+            {
+                if (r.name == name)
+                    route = &r;
+            }
+            if (!route)
+                usage(("route inconnue dans --mix : " + name).c_str());
+            if (weight > 0)
+                out.push_back({route, weight});
+        }
+        if (out.empty())
+            usage("--mix vide");
+        return out;
+    }
+
+    nlohmann::json latencyJson(const HdrHistogram &h)
+    {
+        return {
+            {"count", h.count()},
+            {"min", h.min()},
+            {"mean", h.mean()},
+            {"p50", h.valueAtPercentile(50.0)},
+            {"p90", h.valueAtPercentile(90.0)},
+            {"p99", h.valueAtPercentile(99.0)},
+            {"p999", h.valueAtPercentile(99.9)},
+            {"max", h.max()}};
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const Options opt = parseArgs(argc, argv);
+    const std::vector<WeightedRoute> mix = parseMix(opt.mix);
+    const bool open = opt.mode == "open";
+
+    std::vector<double> weights;
+    for (const auto &w : mix)
+        weights.push_back(w.weight);
+
+    const auto start = Clock::now() + std::chrono::milliseconds(100);
+    const auto measureFrom = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(opt.warmupSec));
+    const auto stopAt = measureFrom + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(opt.durationSec));
+
+    // Mode open : chaque connexion porte rate / connections req/s, décalées entre elles.
+    const auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(opt.connections / (open ? opt.rate : 1.0)));
+
+    std::vector<std::vector<RouteStats>> perThread(opt.connections, std::vector<RouteStats>(mix.size()));
+    std::vector<std::uint64_t> transportErrors(opt.connections, 0);
+    std::vector<std::thread> threads;
+    const auto pid = static_cast<long>(::getpid());
+
+    for (unsigned t = 0; t < opt.connections; ++t)
+    {
+        threads.emplace_back([&, t]
+                             {
+            sa::loadgen::HttpConnection conn(opt.host, opt.port, opt.timeoutMs);
+            std::mt19937_64 rng(opt.seed + t);
+            std::discrete_distribution<std::size_t> pick(weights.begin(), weights.end());
+            std::uint64_t signups = 0;
+
+            auto intended = start + (open ? interval * t / opt.connections : Clock::duration::zero());
+            std::this_thread::sleep_until(start);
+
+            for (;;)
+            {
+                if (open)
+                {
+                    std::this_thread::sleep_until(intended);
+                    if (intended >= stopAt)
+                        break;
+                }
+                const auto sentAt = open ? intended : Clock::now();
+                if (sentAt >= stopAt)
+                    break;
+
+                const std::size_t r = pick(rng);
+                const Route &route = *mix[r].route;
+
+                std::string body;
+                if (route.isSignup)
+                {
+                    body = "{\"name\":\"loadgen\",\"email\":\"lg-" + std::to_string(pid) + "-" + std::to_string(t) + "-" +
+                           std::to_string(signups++) + "@loadgen.test\",\"age\":30}";
+                }
+
+                bool ok = true;
+                sa::loadgen::HttpResponse res;
+                try
+                {
+                    res = conn.request(route.method, route.path, body, opt.accept, opt.token);
+                }
+                catch (const std::exception &)
+                {
+                    ok = false;
+                }
+                const auto done = Clock::now();
+
+                if (sentAt >= measureFrom)
+                {
+                    auto &stats = perThread[t][r];
+                    if (!ok)
+                    {
+                        ++transportErrors[t];
+                        ++stats.errors;
+                    }
+                    else
+                    {
+                        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(done - sentAt).count();
+                        stats.latency.record(static_cast<std::uint64_t>(us));
+                        stats.bytes += res.bodyBytes;
+                        ++stats.statuses[res.status];
+                        if (res.status < 200 || res.status >= 300)
+                            ++stats.errors;
+                    }
+                }
+
+                if (open)
+                    intended += interval;
+            } });
+    }
+
+    for (auto &th : threads)
+        th.join();
+
+    // Fusion par route puis globale.
+    HdrHistogram total(HIGHEST_LATENCY_US);
+    std::uint64_t errors = 0, bytes = 0, transport = 0;
+    std::map<int, std::uint64_t> statuses;
+    nlohmann::json routes = nlohmann::json::object();
+
+    for (std::size_t r = 0; r < mix.size(); ++r)
+    {
+        RouteStats merged;
+        for (const auto &thread : perThread)
+        {
+            merged.latency.merge(thread[r].latency);
+            merged.errors += thread[r].errors;
+            merged.bytes += thread[r].bytes;
+            for (const auto &[code, n] : thread[r].statuses)
+                merged.statuses[code] += n;
+        }
+
+        total.merge(merged.latency);
+        errors += merged.errors;
+        bytes += merged.bytes;
+        nlohmann::json codes = nlohmann::json::object();
+        for (const auto &[code, n] : merged.statuses)
+        {
+            statuses[code] += n;
+            codes[std::to_string(code)] = n;
+        }
+
+        routes[mix[r].route->name] = {
+            {"method", mix[r].route->method},
+            {"path", mix[r].route->path},
+            {"weight", mix[r].weight},
+            {"errors", merged.errors},
+            {"bytes", merged.bytes},
+            {"status", codes},
+            {"latency_us", latencyJson(merged.latency)}};
+    }
+    for (auto n : transportErrors)
+        transport += n;
+
+    nlohmann::json codes = nlohmann::json::object();
+    for (const auto &[code, n] : statuses)
+        codes[std::to_string(code)] = n;
+
+    const double seconds = opt.durationSec;
+    nlohmann::json report = {
+        {"target", opt.host + ":" + std::to_string(opt.port)},
+        {"mode", opt.mode},
+        {"connections", opt.connections},
+        {"duration_s", opt.durationSec},
+        {"warmup_s", opt.warmupSec},
+        {"requests", total.count() + transport},
+        {"completed", total.count()},
+        {"errors", errors},
+        {"transport_errors", transport},
+        {"throughput_rps", static_cast<double>(total.count()) / seconds},
+        {"bytes_per_s", static_cast<double>(bytes) / seconds},
+        {"status", codes},
+        {"latency_us", latencyJson(total)},
+        {"routes", routes}};
+    if (open)
+        report["target_rate_rps"] = opt.rate;
+
+    const std::string text = report.dump(2);
+    if (opt.out.empty())
+    {
+        std::cout << text << "\n";
+    }
+    else
+    {
+        std::ofstream out(opt.out);
+        if (!out)
+        {
+            std::cerr << "sa_loadgen: impossible d'écrire " << opt.out << "\n";
+            return 1;
+        }
+        out << text << "\n";
+    }
+
+    std::cerr << "[sa_loadgen] " << opt.mode << " " << total.count() << " req, "
+              << static_cast<std::uint64_t>(static_cast<double>(total.count()) / seconds) << " req/s, p50="
+              << total.valueAtPercentile(50.0) << "us p99=" << total.valueAtPercentile(99.0)
+              << "us p99.9=" << total.valueAtPercentile(99.9) << "us, erreurs=" << errors << "\n";
+    return errors == 0 ? 0 : 1;
+}